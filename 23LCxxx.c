@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    23LCxxx.c
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.1.0
- * @date    04/01/2025
+ * @version 1.2.0
+ * @date    16/10/2026
  * @brief   Generic SRAM 23LCxxx driver
  * @details Generic driver for Microchip (c) Serial SRAM 23LCxxx. Works with:
  *   23A640/23K640: 64K SPI Bus Low-Power Serial SRAM
@@ -30,7 +30,7 @@ extern "C" {
 //-----------------------------------------------------------------------------
 
 #ifdef USE_DYNAMIC_INTERFACE
-#  define GET_I2C_INTERFACE  pComp->SPI
+#  define GET_SPI_INTERFACE  pComp->SPI
 #else
 #  define GET_SPI_INTERFACE  &pComp->SPI
 #endif
@@ -73,17 +73,26 @@ const SRAM23LCxxx_Conf SRAM23LCV1024_Conf = { .ModeSet = SRAM23LCxxx_SPI | SRAM2
 //=============================================================================
 // Prototypes for private functions
 //=============================================================================
-/*! @brief Write address of the SRAM23LCxxx device
+/*! @brief Format the instruction and the address of the SRAM23LCxxx device
  *
- * This function asserts the device, write the instruction and send the address. The function takes care of dummy byte on read on SDI and SQI modes
- * The device remains asserted after this function
  * @param[in] *pComp Is the pointed structure of the device to be used
- * @param[in] instruction Is the instruction to send
- * @param[in] address Is the address to send
+ * @param[in] instruction Is the instruction to format
+ * @param[in] address Is the address to format
  * @param[in] onlyInstruction Indicate if only the instruction have to be sent
+ * @param[out] *pAddress Is where the instruction and the address will be stored (up to 5 bytes)
+ * @return Returns the count of bytes to send
+ */
+static uint8_t __SRAM23LCxxx_FormatAddress(SRAM23LCxxx *pComp, const uint8_t instruction, const uint32_t address, const bool onlyInstruction, uint8_t* pAddress);
+
+/*! @brief Transfer segments to the SRAM23LCxxx device under one chip select assertion
+ *
+ * This function uses the SPI_Interface.fnSPI_TransferV if available, else it calls SPI_Interface.fnSPI_Transfer for each segment
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in,out] *pPacketsDesc Is the array of the segment descriptions to transfer
+ * @param[in] count Is the count of segments in the array
  * @return Returns an #eERRORRESULT value enum
  */
-static eERRORRESULT __SRAM23LCxxx_WriteAddress(SRAM23LCxxx *pComp, const uint8_t instruction, const uint32_t address, const bool onlyInstruction);
+static eERRORRESULT __SRAM23LCxxx_TransferV(SRAM23LCxxx *pComp, SPIInterface_Packet* const pPacketsDesc, size_t count);
 
 /*! @brief Read data from the SRAM23LCxxx device
  *
@@ -167,14 +176,23 @@ eERRORRESULT Init_SRAM23LCxxx(SRAM23LCxxx *pComp, const SRAM23LCxxx_Config* pCon
 
 //**********************************************************************************************************************************************************
 //=============================================================================
-// [STATIC] Write address of the SRAM23LCxxx device
+// [STATIC] Format the instruction and the address of the SRAM23LCxxx device
 //=============================================================================
-eERRORRESULT __SRAM23LCxxx_WriteAddress(SRAM23LCxxx *pComp, const uint8_t instruction, const uint32_t address, const bool onlyInstruction)
+uint8_t __SRAM23LCxxx_FormatAddress(SRAM23LCxxx *pComp, const uint8_t instruction, const uint32_t address, const bool onlyInstruction, uint8_t* pAddress)
+{
+  const uint8_t AddrBytes = (onlyInstruction ? 0 : pComp->Conf->AddressBytes); // Up to 32-bits address
+  pAddress[0] = instruction;
+  for (int_fast8_t z = AddrBytes; --z >=0;) pAddress[z + 1] = (uint8_t)((address >> ((AddrBytes - z - 1) * 8)) & 0xFF);
+  return (1 + AddrBytes);
+}
+
+
+
+//=============================================================================
+// [STATIC] Transfer segments to the SRAM23LCxxx device under one chip select assertion
+//=============================================================================
+eERRORRESULT __SRAM23LCxxx_TransferV(SRAM23LCxxx *pComp, SPIInterface_Packet* const pPacketsDesc, size_t count)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-  if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-#endif
   SPI_Interface* pSPI = GET_SPI_INTERFACE;
 #if defined(CHECK_NULL_PARAM)
 # if defined(USE_DYNAMIC_INTERFACE)
@@ -182,14 +200,15 @@ eERRORRESULT __SRAM23LCxxx_WriteAddress(SRAM23LCxxx *pComp, const uint8_t instru
 # endif
   if (pSPI->fnSPI_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
+  if (pSPI->fnSPI_TransferV != NULL) return pSPI->fnSPI_TransferV(pSPI, pPacketsDesc, count); // All the segments in one call
+  eERRORRESULT Error = ERR_NONE;
 
-  //--- Create address ---
-  uint8_t Address[1/*Instruction*/ + 4/*Bytes address*/] = { instruction, 0, 0, 0, 0 }; // Up to 32-bits address
-  const uint8_t AddrBytes = (onlyInstruction ? 0 : pComp->Conf->AddressBytes);
-  for (int_fast8_t z = AddrBytes; --z >=0;) Address[z + 1] = (uint8_t)((address >> ((AddrBytes - z - 1) * 8)) & 0xFF);
-  //--- Send the address ---
-  SPIInterface_Packet PacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address[0], (1 + AddrBytes), false);
-  return pSPI->fnSPI_Transfer(pSPI, &PacketDesc); // Transfer the address
+  for (size_t zPacket = 0; zPacket < count; ++zPacket)
+  {
+    Error = pSPI->fnSPI_Transfer(pSPI, &pPacketsDesc[zPacket]); // Continue the transfer with the next segment
+    if (Error != ERR_NONE) break;                               // The transfer stops at the first segment in error
+  }
+  return Error;
 }
 
 
@@ -205,35 +224,23 @@ eERRORRESULT __SRAM23LCxxx_ReadData(SRAM23LCxxx *pComp, const eSRAM23LCxxx_Instr
 #ifdef CHECK_NULL_PARAM
   if ((pComp == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
   if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-#endif
-  SPI_Interface* pSPI = GET_SPI_INTERFACE;
-#if defined(CHECK_NULL_PARAM)
-# if defined(USE_DYNAMIC_INTERFACE)
-  if (pSPI == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-# endif
-  if (pSPI->fnSPI_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
   if ((address + (uint32_t)size) > pComp->Conf->ArrayByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
   const eSRAM23LCxxx_IOmodes IOmode = SRAM23LCxxx_IO_MODE_GET(pComp->InternalConfig);
-  eERRORRESULT Error;
+  const bool UseDummyByte = ((IOmode != SRAM23LCxxx_SPI) && (instruction != SRAM23LCxxx_RDSR)); // In SDI or SQI?
+  uint8_t Address[1/*Instruction*/ + 4/*Bytes address*/];
+  uint8_t DummyByte;
 
   //--- Read data ---
-  Error = __SRAM23LCxxx_WriteAddress(pComp, instruction, address, (instruction == SRAM23LCxxx_RDSR)); // Start a write at address with the device
-  if (Error == ERR_NONE)                               // If there is no error while writing address then
+  const uint8_t AddressSize = __SRAM23LCxxx_FormatAddress(pComp, instruction, address, (instruction == SRAM23LCxxx_RDSR), &Address[0]);
+  SPIInterface_Packet PacketsDesc[3] =
   {
-    SPIInterface_Packet PacketDesc = SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, data, size, true);
-    if ((IOmode != SRAM23LCxxx_SPI) && (instruction != SRAM23LCxxx_RDSR)) // In SDI or SQI?
-    {
-      PacketDesc.DataSize  = 1;
-      PacketDesc.Terminate = false;
-      Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc); // Continue the transfer by reading the dummy byte
-      if (Error != ERR_NONE) return Error;             // If there is an error while calling fnSPI_Transfer() then return the error
-      PacketDesc.DataSize  = size;
-      PacketDesc.Terminate = true;
-    }
-    Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);   // Continue the transfer by reading the data and stop transfer
-  }
-  return Error;
+    SPI_INTERFACE_TX_DATA_DESC(&Address[0], AddressSize, false),                           // Start a read at address with the device
+    SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, &DummyByte, sizeof(DummyByte), false), // Continue the transfer by reading the dummy byte
+    SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, data, size, true),                     // Continue the transfer by reading the data and stop transfer
+  };
+  if (UseDummyByte == false) PacketsDesc[1] = PacketsDesc[2];                     // No dummy byte in SPI
+  return __SRAM23LCxxx_TransferV(pComp, &PacketsDesc[0], (UseDummyByte ? 3 : 2)); // Transfer all the segments under one chip select assertion
 }
 
 
@@ -286,26 +293,18 @@ eERRORRESULT __SRAM23LCxxx_WriteData(SRAM23LCxxx *pComp, const eSRAM23LCxxx_Inst
 #ifdef CHECK_NULL_PARAM
   if ((pComp == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
   if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-#endif
-  SPI_Interface* pSPI = GET_SPI_INTERFACE;
-#if defined(CHECK_NULL_PARAM)
-# if defined(USE_DYNAMIC_INTERFACE)
-  if (pSPI == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-# endif
-  if (pSPI->fnSPI_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
   if ((address + (uint32_t)size) > pComp->Conf->ArrayByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
-  uint8_t* pData = (uint8_t*)data;
-  eERRORRESULT Error;
+  uint8_t Address[1/*Instruction*/ + 4/*Bytes address*/];
 
   //--- Write data ---
-  Error = __SRAM23LCxxx_WriteAddress(pComp, instruction, address, (instruction == SRAM23LCxxx_WRSR)); // Start a write at address with the device
-  if (Error == ERR_NONE)                             // If there is no error while writing address then
+  const uint8_t AddressSize = __SRAM23LCxxx_FormatAddress(pComp, instruction, address, (instruction == SRAM23LCxxx_WRSR), &Address[0]);
+  SPIInterface_Packet PacketsDesc[2] =
   {
-    SPIInterface_Packet PacketDesc = SPI_INTERFACE_TX_DATA_DESC(pData, size, true);
-    Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc); // Continue the transfer by sending the data and stop transfer
-  }
-  return Error;
+    SPI_INTERFACE_TX_DATA_DESC(&Address[0], AddressSize, false), // Start a write at address with the device
+    SPI_INTERFACE_TX_DATA_DESC(data, size, true),                // Continue the transfer by sending the data and stop transfer
+  };
+  return __SRAM23LCxxx_TransferV(pComp, &PacketsDesc[0], 2);     // Transfer all the segments under one chip select assertion
 }
 
 
@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    23LCxxx.h
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.1.0
- * @date    04/01/2025
+ * @version 1.2.0
+ * @date    16/10/2026
  * @brief   Generic SRAM 23LCxxx driver
  * @details Generic driver for Microchip (c) Serial SRAM 23LCxxx. Works with:
  *   23A640/23K640: 64K SPI Bus Low-Power Serial SRAM
@@ -42,6 +42,7 @@
  *****************************************************************************/
 
 /* Revision history:
+ * 1.2.0    Transfer the instruction, address, dummy byte, and data under one chip select assertion with SPI_Interface.fnSPI_TransferV
  * 1.1.0    Update following "SPI_Interface.h" version 2.0.0
  *          Update error management to add context
  * 1.0.0    Release version
@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    47x16.c
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.2.1
- * @date    04/01/2025
+ * @version 1.3.0
+ * @date    16/10/2026
  * @brief   EERAM47x16 driver
  * @details I2C-Compatible (2-wire) 16-Kbit (2kB x 8) Serial EERAM
  * Follow datasheet 47L04/47C04/47L16/47C16 Rev.C (Jun 2016)
@@ -51,6 +51,10 @@ const EEPROM_Conf EERAM47C16_Conf = { .ChipAddress = 0xA0, .ChipSelect = EEPROM_
 static eERRORRESULT __EERAM47x16_WriteAddress(EERAM47x16 *pComp, const uint8_t chipAddr, const uint16_t address, const bool useNonBlocking, const eI2C_TransferType transferType);
 // Write data to the EERAM47x16 (DO NOT USE DIRECTLY, use EERAM47x16_WriteSRAMData() or EERAM47x16_WriteRegister() instead)
 static eERRORRESULT __EERAM47x16_WriteData(EERAM47x16 *pComp, const uint8_t chipAddr, uint16_t address, const uint8_t* data, size_t size);
+// Get the current time of the timeouts (DO NOT USE DIRECTLY)
+static uint32_t __EERAM47x16_GetCurrentTime(EERAM47x16 *pComp);
+// Check the timeout of a wait loop and give back the CPU until the next check (DO NOT USE DIRECTLY)
+static bool __EERAM47x16_WaitOrTimeout(EERAM47x16 *pComp, uint32_t startTime, uint32_t timeoutus);
 //-----------------------------------------------------------------------------
 #define EERAM47x16_TIME_DIFF(begin,end)  ( ((end) >= (begin)) ? ((end) - (begin)) : (UINT32_MAX - ((begin) - (end) - 1)) ) // Works only if time difference is strictly inferior to (UINT32_MAX/2) and call often
 //-----------------------------------------------------------------------------
@@ -379,16 +383,15 @@ eERRORRESULT EERAM47x16_StoreSRAMtoEEPROM(EERAM47x16 *pComp, bool forceStore, bo
     if (waitEndOfStore)
     {
       Reg.Status = EERAM47x16_ARRAY_MODIFIED;
-      uint32_t StartTime = pComp->Eeprom.fnGetCurrentms();                                                  // Start the timeout
+      uint32_t StartTime = __EERAM47x16_GetCurrentTime(pComp);                                              // Start the timeout
+      bool TimedOut = false;
       while (true)
       {
         Error = EERAM47x16_ReadRegister(pComp, &Reg.Status);                                                // Get the status register
         if ((ERR_ERROR_Get(Error) != ERR_NONE) && (ERR_ERROR_Get(Error) != ERR__I2C_NACK)) return Error;    // If there is an error while calling EERAM47x16_ReadRegister() then return the error
         if ((Reg.Status & EERAM47x16_ARRAY_MODIFIED) == 0) break;                                           // The store is finished, all went fine
-        if (EERAM47x16_TIME_DIFF(StartTime, pComp->Eeprom.fnGetCurrentms()) > EERAM47x16_STORE_TIMEOUT + 1) // Wait at least STORE_TIMEOUT + 1ms because GetCurrentms can be 1 cycle before the new ms
-        {
-          return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                                         // Timeout? return the error
-        }
+        if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                             // Still not ready after the timeout? return the error
+        TimedOut = __EERAM47x16_WaitOrTimeout(pComp, StartTime, EERAM47x16_STORE_TIMEOUT_US);               // Wait at least STORE_TIMEOUT, check a last time, and give back the CPU meanwhile
       }
     }
   }
@@ -415,16 +418,15 @@ eERRORRESULT EERAM47x16_RecallEEPROMtoSRAM(EERAM47x16 *pComp, bool waitEndOfReca
   if (waitEndOfRecall)
   {
     Reg.Status = EERAM47x16_ARRAY_MODIFIED;
-    uint32_t StartTime = pComp->Eeprom.fnGetCurrentms();                                                   // Start the timeout
+    uint32_t StartTime = __EERAM47x16_GetCurrentTime(pComp);                                               // Start the timeout
+    bool TimedOut = false;
     while (true)
     {
       Error = EERAM47x16_ReadRegister(pComp, &Reg.Status);                                                 // Get the status register
       if ((ERR_ERROR_Get(Error) != ERR_NONE) && (ERR_ERROR_Get(Error) != ERR__I2C_NACK)) return Error;     // If there is an error while calling EERAM47x16_ReadRegister() then return the error
       if ((Reg.Status & EERAM47x16_ARRAY_MODIFIED) == 0) break;                                            // The store is finished, all went fine
-      if (EERAM47x16_TIME_DIFF(StartTime, pComp->Eeprom.fnGetCurrentms()) > EERAM47x16_RECALL_TIMEOUT + 1) // Wait at least RECALL_TIMEOUT + 1ms because GetCurrentms can be 1 cycle before the new ms
-      {
-        return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                                          // Timeout? return the error
-      }
+      if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                              // Still not ready after the timeout? return the error
+      TimedOut = __EERAM47x16_WaitOrTimeout(pComp, StartTime, EERAM47x16_RECALL_TIMEOUT_US);               // Wait at least RECALL_TIMEOUT, check a last time, and give back the CPU meanwhile
     }
   }
   return ERR_NONE;
@@ -488,6 +490,37 @@ eERRORRESULT EERAM47x16_SetBlockWriteProtect(EERAM47x16 *pComp, eEERAM47x16_Bloc
 }
 
 //-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// [STATIC] Get the current time of the timeouts of the EERAM47x16 device
+//=============================================================================
+uint32_t __EERAM47x16_GetCurrentTime(EERAM47x16 *pComp)
+{
+  if (pComp->Eeprom.fnGetCurrentus != NULL) return pComp->Eeprom.fnGetCurrentus(); // Microsecond time if available...
+  return pComp->Eeprom.fnGetCurrentms();                                           // ...else millisecond time
+}
+
+
+//=============================================================================
+// [STATIC] Check the timeout of a wait loop and give back the CPU until the next check
+//=============================================================================
+bool __EERAM47x16_WaitOrTimeout(EERAM47x16 *pComp, uint32_t startTime, uint32_t timeoutus)
+{
+  if (pComp->Eeprom.fnGetCurrentus != NULL)
+  {
+    if (EERAM47x16_TIME_DIFF(startTime, pComp->Eeprom.fnGetCurrentus()) > (timeoutus + 1u)) return true;                       // Wait at least timeout + 1us because GetCurrentus can be 1 cycle before the new us
+  }
+  else if (EERAM47x16_TIME_DIFF(startTime, pComp->Eeprom.fnGetCurrentms()) > (((timeoutus + 999u) / 1000u) + 1u)) return true; // Wait at least timeout + 1ms because GetCurrentms can be 1 cycle before the new ms
+  if (pComp->Eeprom.fnYield != NULL) pComp->Eeprom.fnYield(timeoutus / 16u);                                                   // Check the device again after 1/16 of the operation time
+  return false;
+}
+
+//-----------------------------------------------------------------------------
 #ifdef __cplusplus
 }
 #endif
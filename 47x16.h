@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    47x16.h
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.2.1
- * @date    04/01/2025
+ * @version 1.3.0
+ * @date    16/10/2026
  * @brief   EERAM47x16 driver
  * @details I2C-Compatible (2-wire) 16-Kbit (2kB x 8) Serial EERAM
  * Follow datasheet 47L04/47C04/47L16/47C16 Rev.C (Jun 2016)
@@ -31,6 +31,7 @@
  *****************************************************************************/
 
 /* Revision history:
+ * 1.3.0    Add optional microsecond time and yield functions for the timeouts and the wait loops
  * 1.2.1    Update error management to add context
  * 1.2.0    Add EEPROM genericness
  * 1.1.0    I2C interface rework for I2C DMA use
@@ -91,6 +92,8 @@ extern const EEPROM_Conf EERAM47L16_Conf, EERAM47C16_Conf;
 
 #define EERAM47x16_STORE_TIMEOUT          ( 25 ) //!< Store Operation Duration: 25ms
 #define EERAM47x16_RECALL_TIMEOUT         (  5 ) //!< Recall Operation Duration: 5ms
+#define EERAM47x16_STORE_TIMEOUT_US       ( 25000u ) //!< Store Operation Duration in microsecond
+#define EERAM47x16_RECALL_TIMEOUT_US      (  5000u ) //!< Recall Operation Duration in microsecond
 
 /*! @brief Generate the EERAM47x16 chip configurable address following the state of A1, and A2
  * You shall set '1' (when corresponding pin is connected to +V) or '0' (when corresponding pin is connected to Ground) on each parameter
@@ -182,6 +185,20 @@ typedef uint8_t TEERAM47x16DriverInternal; //! Alias for Driver Internal data fl
  * @return Returns the current millisecond of the system
  */
 typedef uint32_t (*GetCurrentms_Func)(void);
+
+/*! @brief Function that gives the current microsecond of the system to the driver
+ *
+ * This function will be called when the driver needs to get current microsecond
+ * @return Returns the current microsecond of the system
+ */
+typedef uint32_t (*GetCurrentus_Func)(void);
+
+/*! @brief Function that gives back the CPU while the driver waits a device
+ *
+ * This function will be called in each turn of the wait loops of the driver. It can yield to the other tasks of an RTOS, or sleep a Linux thread
+ * @param[in] waitus Is the time in microsecond before the driver needs to check the device again, 0 if the device shall be checked as soon as possible
+ */
+typedef void (*Yield_Func)(uint32_t waitus);
 #endif
 
 //-----------------------------------------------------------------------------
@@ -210,6 +227,10 @@ struct EERAM47x16
 
     //--- Device address ---
     uint8_t AddrA2A1A0;                       //!< Device configurable address A2, and A1. A0 is not used. You can use the macro EERAM47x16_ADDR() to help filling this parameter. Only these 3 lower bits are used: ....21.. where 2 is A2, 1 is A1, and '.' are fixed by device
+
+    //--- Optional time call functions ---
+    GetCurrentus_Func fnGetCurrentus;         //!< Optional, can be NULL. This function will be called when the driver need to get current microsecond, the timeouts and waits are then at the microsecond
+    Yield_Func fnYield;                       //!< Optional, can be NULL. This function will be called in the wait loops of the driver to give back the CPU
   } Eeprom;
 #endif // USE_EEPROM_GENERICNESS
 };
@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    48LM01.c
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.0.1
- * @date    04/01/2025
+ * @version 1.2.0
+ * @date    16/10/2026
  * @brief   EERAM48LM01 driver
  * @details SPI-Compatible 1-Mbit SPI Serial EERAM
  * Follow datasheet DS20006008C Rev.C (Oct 2019)
@@ -55,16 +55,24 @@ extern "C" {
 static void __ComputeCRC16IBM3740(uint16_t* pCRC, const uint8_t* data, size_t size);
 #endif
 
-/*! @brief Write address of the EERAM48LM01 device
+/*! @brief Format the OP code and the address of the EERAM48LM01 device
  *
- * This function asserts the device, write the OP code and send the address. The device remains asserted after this function
+ * @param[in] opCode Is the OP code to format
+ * @param[in] address Is the address to format
+ * @param[out] *pAddress Is where the OP code and the address will be stored (EERAM48LM01_ADDRESS_BYTE_SIZE + 1 bytes)
+ * @return Returns the count of bytes to send
+ */
+static size_t __EERAM48LM01_FormatAddress(const uint8_t opCode, const uint32_t address, uint8_t* pAddress);
+
+/*! @brief Transfer segments to the EERAM48LM01 device under one chip select assertion
+ *
+ * This function uses the SPI_Interface.fnSPI_TransferV if available, else it calls SPI_Interface.fnSPI_Transfer for each segment
  * @param[in] *pComp Is the pointed structure of the device to be used
- * @param[in] opCode Is the OP code to send
- * @param[in] address Is the address to send
- * @param[in,out] *pCRC If set value non NULL, it asks to calculate the CRC and will return the CRC of the address part
+ * @param[in,out] *pPacketsDesc Is the array of the segment descriptions to transfer
+ * @param[in] count Is the count of segments in the array
  * @return Returns an #eERRORRESULT value enum
  */
-static eERRORRESULT __EERAM48LM01_WriteAddress(EERAM48LM01 *pComp, const uint8_t opCode, const uint32_t address, uint16_t* pCRC);
+static eERRORRESULT __EERAM48LM01_TransferV(EERAM48LM01 *pComp, SPIInterface_Packet* const pPacketsDesc, size_t count);
 
 /*! @brief Read data from the EERAM48LM01 device
  *
@@ -89,6 +97,24 @@ static eERRORRESULT __EERAM48LM01_ReadData(EERAM48LM01 *pComp, const uint8_t opC
  * @return Returns an #eERRORRESULT value enum
  */
 static eERRORRESULT __EERAM48LM01_WriteData(EERAM48LM01 *pComp, const uint8_t opCode, uint32_t address, const uint8_t* data, size_t size, bool useCRC);
+
+/*! @brief Get the current time of the timeouts of the EERAM48LM01 device
+ *
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @return Returns the current microsecond if the microsecond time function is set, else the current millisecond
+ */
+static uint32_t __EERAM48LM01_GetCurrentTime(EERAM48LM01 *pComp);
+
+/*! @brief Check the timeout of a wait loop and give back the CPU until the next check
+ *
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] startTime Is the start time of the wait get with __EERAM48LM01_GetCurrentTime()
+ * @param[in] timeoutus Is the timeout of the wait in microsecond
+ * @return Returns 'true' if the timeout is elapsed, else 'false'
+ */
+static bool __EERAM48LM01_WaitOrTimeout(EERAM48LM01 *pComp, uint32_t startTime, uint32_t timeoutus);
+//-----------------------------------------------------------------------------
+#define EERAM48LM01_TIME_DIFF(begin,end)  ( ((end) >= (begin)) ? ((end) - (begin)) : (UINT32_MAX - ((begin) - (end) - 1)) ) // Works only if time difference is strictly inferior to (UINT32_MAX/2) and call often
 //-----------------------------------------------------------------------------
 
 
@@ -152,13 +178,24 @@ void __ComputeCRC16IBM3740(uint16_t* pCRC, const uint8_t* data, size_t size)
 
 //**********************************************************************************************************************************************************
 //=============================================================================
-// [STATIC] Write address of the EERAM48LM01 device
+// [STATIC] Format the OP code and the address of the EERAM48LM01 device
 //=============================================================================
-eERRORRESULT __EERAM48LM01_WriteAddress(EERAM48LM01 *pComp, const uint8_t opCode, const uint32_t address, uint16_t* pCRC)
+size_t __EERAM48LM01_FormatAddress(const uint8_t opCode, const uint32_t address, uint8_t* pAddress)
+{
+  pAddress[0] = opCode;
+  pAddress[1] = (uint8_t)(address >> 16);
+  pAddress[2] = (uint8_t)(address >> 8);
+  pAddress[3] = (uint8_t)(address & 0xFF);
+  return ( EERAM48LM01_IS_NV_USER_SPACE(opCode) ? 1 : (EERAM48LM01_ADDRESS_BYTE_SIZE + 1) ); // The non-volatile user space instructions have no address
+}
+
+
+
+//=============================================================================
+// [STATIC] Transfer segments to the EERAM48LM01 device under one chip select assertion
+//=============================================================================
+eERRORRESULT __EERAM48LM01_TransferV(EERAM48LM01 *pComp, SPIInterface_Packet* const pPacketsDesc, size_t count)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-#endif
   SPI_Interface* pSPI = GET_SPI_INTERFACE;
 #if defined(CHECK_NULL_PARAM)
 # if defined(USE_DYNAMIC_INTERFACE)
@@ -166,19 +203,15 @@ eERRORRESULT __EERAM48LM01_WriteAddress(EERAM48LM01 *pComp, const uint8_t opCode
 # endif
   if (pSPI->fnSPI_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
+  if (pSPI->fnSPI_TransferV != NULL) return pSPI->fnSPI_TransferV(pSPI, pPacketsDesc, count); // All the segments in one call
+  eERRORRESULT Error = ERR_NONE;
 
-  //--- Create address ---
-  uint8_t Address[EERAM48LM01_ADDRESS_BYTE_SIZE + 1] = { opCode, (uint8_t)(address >> 16), (uint8_t)(address >> 8), (uint8_t)(address & 0xFF) };
-  if (pCRC != NULL)                                            // Calculate CRC if ask
+  for (size_t zPacket = 0; zPacket < count; ++zPacket)
   {
-    // If 17th bit of address is 0 then: ((0xFFFF ^ 0x0000) << 1) ^ 0x1021 = 0xEFDF
-    // If 17th bit of address is 1 then: ((0xFFFF ^ 0x8000) << 1)          = 0xFFFE
-    *pCRC = ((address & 0x10000) == 0 ? 0xEFDF : 0xFFFE);      // Pre-computed CRC start value + 17th bit of address
-    ComputeCRC16IBM3740(pCRC, &Address[2], sizeof(Address)-2); // Compute the rest of address
+    Error = pSPI->fnSPI_Transfer(pSPI, &pPacketsDesc[zPacket]); // Continue the transfer with the next segment
+    if (Error != ERR_NONE) break;                               // The transfer stops at the first segment in error
   }
-  //--- Send the address ---
-  SPIInterface_Packet PacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address[0], ( EERAM48LM01_IS_NV_USER_SPACE(opCode) ? 1 : sizeof(Address) ), false);
-  return pSPI->fnSPI_Transfer(pSPI, &PacketDesc); // Transfer the address
+  return Error;
 }
 
 
@@ -193,43 +226,35 @@ eERRORRESULT __EERAM48LM01_ReadData(EERAM48LM01 *pComp, const uint8_t opCode, ui
 {
 #ifdef CHECK_NULL_PARAM
   if ((pComp == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-#endif
-  SPI_Interface* pSPI = GET_SPI_INTERFACE;
-#if defined(CHECK_NULL_PARAM)
-# if defined(USE_DYNAMIC_INTERFACE)
-  if (pSPI == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-# endif
-  if (pSPI->fnSPI_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
   if ((address + (uint32_t)size) > EERAM48LM01_EERAM_SIZE) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  uint8_t Address[EERAM48LM01_ADDRESS_BYTE_SIZE + 1];
+  uint8_t CRCdata[2];
   eERRORRESULT Error;
 
   //--- Read data ---
-  uint16_t CRC = 0xFFFF;                                            // Initial value of the CRC
-  uint16_t* pCRC = (useCRC ? &CRC : NULL);
-  Error = __EERAM48LM01_WriteAddress(pComp, opCode, address, pCRC); // Start a write at address with the device
-  pComp->InternalConfig &= EERAM48LM01_STATUS_WRITE_DISABLE_SET;    // Remove write enable flag
-  if (Error == ERR_NONE)                                            // If there is no error while writing address then
+  const size_t AddressSize = __EERAM48LM01_FormatAddress(opCode, address, &Address[0]);
+  SPIInterface_Packet PacketsDesc[3] =
   {
-    SPIInterface_Packet PacketDesc = SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, data, size, (useCRC == false));
-    Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);                // Continue the transfer by reading the data and stop transfer if no CRC
-    if (useCRC)                                                     // If the CRC computation shall be retreived with the data...
-    {
-      if (Error != ERR_NONE) return Error;                          // If there is an error while calling fnSPI_Transfer() then return the error
-      ComputeCRC16IBM3740(pCRC, data, size);                        // Calculate CRC of received data
-      //--- Get the CRC ---
-      uint8_t CRCdata[2];
-      PacketDesc.RxData    = &CRCdata[0];
-      PacketDesc.DataSize  = sizeof(CRCdata);
-      PacketDesc.Terminate = true;
-      Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);              // Continue the transfer by reading the CRC and stop transfer
-      if (Error != ERR_NONE) return Error;                          // If there is an error while calling fnSPI_Transfer() then return the error
-      //--- Check the CRC ---
-      const uint16_t ReceivedCRC = (((uint16_t)CRCdata[0] << 8) | (uint16_t)CRCdata[1]);
-      if (ReceivedCRC != CRC) return ERR_GENERATE(ERR__CRC_ERROR);
-    }
+    SPI_INTERFACE_TX_DATA_DESC(&Address[0], AddressSize, false),                         // Start a read at address with the device
+    SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, data, size, (useCRC == false)),      // Continue the transfer by reading the data and stop transfer if no CRC
+    SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, &CRCdata[0], sizeof(CRCdata), true), // Continue the transfer by reading the CRC and stop transfer
+  };
+  Error = __EERAM48LM01_TransferV(pComp, &PacketsDesc[0], (useCRC ? 3 : 2)); // Transfer all the segments under one chip select assertion
+  pComp->InternalConfig &= EERAM48LM01_STATUS_WRITE_DISABLE_SET;             // Remove write enable flag
+  if (Error != ERR_NONE) return Error;                                       // If there is an error while calling __EERAM48LM01_TransferV() then return the error
+  if (useCRC)                                                                // If the CRC computation shall be retreived with the data...
+  {
+    //--- Check the CRC ---
+    // If 17th bit of address is 0 then: ((0xFFFF ^ 0x0000) << 1) ^ 0x1021 = 0xEFDF
+    // If 17th bit of address is 1 then: ((0xFFFF ^ 0x8000) << 1)          = 0xFFFE
+    uint16_t CRC = ((address & 0x10000) == 0 ? 0xEFDF : 0xFFFE);               // Pre-computed CRC start value + 17th bit of address
+    ComputeCRC16IBM3740(&CRC, &Address[2], EERAM48LM01_ADDRESS_BYTE_SIZE - 1); // Compute the rest of address
+    ComputeCRC16IBM3740(&CRC, data, size);                                     // Calculate CRC of received data
+    const uint16_t ReceivedCRC = (((uint16_t)CRCdata[0] << 8) | (uint16_t)CRCdata[1]);
+    if (ReceivedCRC != CRC) return ERR_GENERATE(ERR__CRC_ERROR);
   }
-  return Error;
+  return ERR_NONE;
 }
 
 
@@ -315,17 +340,19 @@ eERRORRESULT EERAM48LM01_ReadSRAMDataWithDMA(EERAM48LM01 *pComp, uint32_t addres
   }
 
   //--- Read data ---
-  Error = __EERAM48LM01_WriteAddress(pComp, EERAM48LM01_READ, address, NULL); // Start a read at address with the device
-  pComp->InternalConfig &= EERAM48LM01_STATUS_WRITE_DISABLE_SET;              // Remove write enable flag
-  if (Error == ERR_NONE)                                                      // If there is no error while writing address then
+  uint8_t Address[EERAM48LM01_ADDRESS_BYTE_SIZE + 1];
+  const size_t AddressSize = __EERAM48LM01_FormatAddress(EERAM48LM01_READ, address, &Address[0]);
+  SPIInterface_Packet PacketsDesc[2] =
   {
-    SPIInterface_Packet PacketDesc = SPI_INTERFACE_RX_DATA_DMA_WITH_DUMMYBYTE_DESC(0x00, data, true, size, true);
-    Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc); // Restart at first data read transfer, get the data and stop transfer at last data
-    if (ERR_ERROR_Get(Error) != ERR__SPI_OTHER_BUSY) pComp->InternalConfig &= EERAM48LM01_NO_DMA_TRANSFER_IN_PROGRESS_SET;
-    if (ERR_ERROR_Get(Error) == ERR__SPI_BUSY) pComp->InternalConfig |= EERAM48LM01_DMA_TRANSFER_IN_PROGRESS;
-    EERAM48LM01_TRANSACTION_NUMBER_CLEAR(pComp->InternalConfig);
-    pComp->InternalConfig |= EERAM48LM01_TRANSACTION_NUMBER_SET(SPI_TRANSACTION_NUMBER_GET(PacketDesc.Config.Value));
-  }
+    SPI_INTERFACE_TX_DATA_DESC(&Address[0], AddressSize, false),                 // Start a read at address with the device
+    SPI_INTERFACE_RX_DATA_DMA_WITH_DUMMYBYTE_DESC(0x00, data, true, size, true), // Restart at first data transfer, transfer the data and stop transfer at last data
+  };
+  Error = __EERAM48LM01_TransferV(pComp, &PacketsDesc[0], 2);    // Transfer all the segments under one chip select assertion
+  pComp->InternalConfig &= EERAM48LM01_STATUS_WRITE_DISABLE_SET; // Remove write enable flag
+  if (ERR_ERROR_Get(Error) != ERR__SPI_OTHER_BUSY) pComp->InternalConfig &= EERAM48LM01_NO_DMA_TRANSFER_IN_PROGRESS_SET;
+  if (ERR_ERROR_Get(Error) == ERR__SPI_BUSY) pComp->InternalConfig |= EERAM48LM01_DMA_TRANSFER_IN_PROGRESS;
+  EERAM48LM01_TRANSACTION_NUMBER_CLEAR(pComp->InternalConfig);
+  pComp->InternalConfig |= EERAM48LM01_TRANSACTION_NUMBER_SET(SPI_TRANSACTION_NUMBER_GET(PacketsDesc[1].Config.Value));
   return Error;
 }
 
@@ -341,39 +368,32 @@ eERRORRESULT __EERAM48LM01_WriteData(EERAM48LM01 *pComp, const uint8_t opCode, u
 {
 #ifdef CHECK_NULL_PARAM
   if ((pComp == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-#endif
-  SPI_Interface* pSPI = GET_SPI_INTERFACE;
-#if defined(CHECK_NULL_PARAM)
-# if defined(USE_DYNAMIC_INTERFACE)
-  if (pSPI == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
-# endif
-  if (pSPI->fnSPI_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
   if ((address + (uint32_t)size) > EERAM48LM01_EERAM_SIZE) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
-  uint8_t* pData = (uint8_t*)data;
+  uint8_t Address[EERAM48LM01_ADDRESS_BYTE_SIZE + 1];
+  uint8_t CRCdata[2] = { 0x00, 0x00 };
   eERRORRESULT Error;
 
   //--- Write data ---
-  uint16_t CRC = 0xFFFF;                                            // Initial value of the CRC
-  uint16_t* pCRC = (useCRC ? &CRC : NULL);
-  Error = __EERAM48LM01_WriteAddress(pComp, opCode, address, pCRC); // Start a write at address with the device
-  pComp->InternalConfig &= EERAM48LM01_STATUS_WRITE_DISABLE_SET;    // Remove write enable flag
-  if (Error == ERR_NONE)                                            // If there is no error while writing address then
+  const size_t AddressSize = __EERAM48LM01_FormatAddress(opCode, address, &Address[0]);
+  if (useCRC) // If the CRC computation shall be sent with the data...
   {
-    SPIInterface_Packet PacketDesc = SPI_INTERFACE_TX_DATA_DESC(pData, size, (useCRC == false));
-    Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);   // Continue the transfer by sending the data and stop transfer if no CRC
-    if (useCRC)                                        // If the CRC computation shall be sent with the data...
-    {
-      if (Error != ERR_NONE) return Error;             // If there is an error while calling fnSPI_Transfer() then return the error
-      ComputeCRC16IBM3740(pCRC, pData, size);          // Calculate CRC
-      //--- Send the CRC ---
-      uint8_t CRCdata[2] = { (uint8_t)(*pCRC >> 8), (uint8_t)(*pCRC & 0xFF) };
-      PacketDesc.TxData    = &CRCdata[0];
-      PacketDesc.DataSize  = sizeof(CRCdata);
-      PacketDesc.Terminate = true;
-      Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc); // Continue the transfer by sending the CRC and stop transfer
-    }
+    // If 17th bit of address is 0 then: ((0xFFFF ^ 0x0000) << 1) ^ 0x1021 = 0xEFDF
+    // If 17th bit of address is 1 then: ((0xFFFF ^ 0x8000) << 1)          = 0xFFFE
+    uint16_t CRC = ((address & 0x10000) == 0 ? 0xEFDF : 0xFFFE);               // Pre-computed CRC start value + 17th bit of address
+    ComputeCRC16IBM3740(&CRC, &Address[2], EERAM48LM01_ADDRESS_BYTE_SIZE - 1); // Compute the rest of address
+    ComputeCRC16IBM3740(&CRC, data, size);                                     // Calculate CRC of data to send
+    CRCdata[0] = (uint8_t)(CRC >> 8);
+    CRCdata[1] = (uint8_t)(CRC & 0xFF);
   }
+  SPIInterface_Packet PacketsDesc[3] =
+  {
+    SPI_INTERFACE_TX_DATA_DESC(&Address[0], AddressSize, false),    // Start a write at address with the device
+    SPI_INTERFACE_TX_DATA_DESC(data, size, (useCRC == false)),      // Continue the transfer by sending the data and stop transfer if no CRC
+    SPI_INTERFACE_TX_DATA_DESC(&CRCdata[0], sizeof(CRCdata), true), // Continue the transfer by sending the CRC and stop transfer
+  };
+  Error = __EERAM48LM01_TransferV(pComp, &PacketsDesc[0], (useCRC ? 3 : 2)); // Transfer all the segments under one chip select assertion
+  pComp->InternalConfig &= EERAM48LM01_STATUS_WRITE_DISABLE_SET;             // Remove write enable flag
   return Error;
 }
 
@@ -490,17 +510,19 @@ eERRORRESULT EERAM48LM01_WriteSRAMDataWithDMA(EERAM48LM01 *pComp, uint32_t addre
   }
 
   //--- Write data ---
-  Error = __EERAM48LM01_WriteAddress(pComp, EERAM48LM01_WRITE, address, NULL); // Start a read at address with the device
-  pComp->InternalConfig &= EERAM48LM01_STATUS_WRITE_DISABLE_SET;               // Remove write enable flag
-  if (Error == ERR_NONE)                                                       // If there is no error while writing address then
+  uint8_t Address[EERAM48LM01_ADDRESS_BYTE_SIZE + 1];
+  const size_t AddressSize = __EERAM48LM01_FormatAddress(EERAM48LM01_WRITE, address, &Address[0]);
+  SPIInterface_Packet PacketsDesc[2] =
   {
-    SPIInterface_Packet PacketDesc = SPI_INTERFACE_TX_DATA_DMA_DESC(pData, true, size, true);
-    Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);                           // Restart at first data read transfer, get the data and stop transfer at last data
-    if (ERR_ERROR_Get(Error) != ERR__SPI_OTHER_BUSY) pComp->InternalConfig &= EERAM48LM01_NO_DMA_TRANSFER_IN_PROGRESS_SET;
-    if (ERR_ERROR_Get(Error) == ERR__SPI_BUSY) pComp->InternalConfig |= EERAM48LM01_DMA_TRANSFER_IN_PROGRESS;
-    EERAM48LM01_TRANSACTION_NUMBER_CLEAR(pComp->InternalConfig);
-    pComp->InternalConfig |= EERAM48LM01_TRANSACTION_NUMBER_SET(SPI_TRANSACTION_NUMBER_GET(PacketDesc.Config.Value));
-  }
+    SPI_INTERFACE_TX_DATA_DESC(&Address[0], AddressSize, false), // Start a write at address with the device
+    SPI_INTERFACE_TX_DATA_DMA_DESC(pData, true, size, true),     // Restart at first data transfer, transfer the data and stop transfer at last data
+  };
+  Error = __EERAM48LM01_TransferV(pComp, &PacketsDesc[0], 2);    // Transfer all the segments under one chip select assertion
+  pComp->InternalConfig &= EERAM48LM01_STATUS_WRITE_DISABLE_SET; // Remove write enable flag
+  if (ERR_ERROR_Get(Error) != ERR__SPI_OTHER_BUSY) pComp->InternalConfig &= EERAM48LM01_NO_DMA_TRANSFER_IN_PROGRESS_SET;
+  if (ERR_ERROR_Get(Error) == ERR__SPI_BUSY) pComp->InternalConfig |= EERAM48LM01_DMA_TRANSFER_IN_PROGRESS;
+  EERAM48LM01_TRANSACTION_NUMBER_CLEAR(pComp->InternalConfig);
+  pComp->InternalConfig |= EERAM48LM01_TRANSACTION_NUMBER_SET(SPI_TRANSACTION_NUMBER_GET(PacketsDesc[1].Config.Value));
   return Error;
 }
 
@@ -585,13 +607,15 @@ eERRORRESULT EERAM48LM01_StoreSRAMtoEEPROM(EERAM48LM01 *pComp, bool waitEndOfSto
   if (waitEndOfStore)
   {
     Reg.Status = 0x00;
-    uint32_t Timeout = pComp->fnGetCurrentms() + EERAM48LM01_STORE_TIMEOUT + 1;         // Wait at least STORE_TIMEOUT + 1ms because GetCurrentms can be 1 cycle before the new ms
+    uint32_t StartTime = __EERAM48LM01_GetCurrentTime(pComp);                           // Start the timeout
+    bool TimedOut = false;
     while (true)
     {
       Error = EERAM48LM01_GetStatus(pComp, &Reg);                                       // Get the status register
       if (Error != ERR_NONE) return Error;                                              // If there is an error while calling EERAM48LM01_GetStatus() then return the error
       if ((Reg.Status & EERAM48LM01_IS_BUSY) == 0) break;                               // The store is finished, all went fine
-      if (pComp->fnGetCurrentms() >= Timeout) return ERR_GENERATE(ERR__DEVICE_TIMEOUT); // Timeout? return the error
+      if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                           // Still not ready after the timeout? return the error
+      TimedOut = __EERAM48LM01_WaitOrTimeout(pComp, StartTime, EERAM48LM01_STORE_TIMEOUT_US); // Wait at least the operation time, check a last time, and give back the CPU meanwhile
     }
   }
   return Error;
@@ -617,13 +641,15 @@ eERRORRESULT EERAM48LM01_RecallEEPROMtoSRAM(EERAM48LM01 *pComp, bool waitEndOfRe
   if (waitEndOfRecall)
   {
     Reg.Status = 0x00;
-    uint32_t Timeout = pComp->fnGetCurrentms() + EERAM48LM01_RECALL_TIMEOUT + 1;        // Wait at least RECALL_TIMEOUT + 1ms because GetCurrentms can be 1 cycle before the new ms
+    uint32_t StartTime = __EERAM48LM01_GetCurrentTime(pComp);                           // Start the timeout
+    bool TimedOut = false;
     while (true)
     {
       Error = EERAM48LM01_GetStatus(pComp, &Reg);                                       // Get the status register
       if (Error != ERR_NONE) return Error;                                              // If there is an error while calling EERAM48LM01_GetStatus() then return the error
       if ((Reg.Status & EERAM48LM01_IS_BUSY) == 0) break;                               // The recall is finished, all went fine
-      if (pComp->fnGetCurrentms() >= Timeout) return ERR_GENERATE(ERR__DEVICE_TIMEOUT); // Timeout? return the error
+      if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                           // Still not ready after the timeout? return the error
+      TimedOut = __EERAM48LM01_WaitOrTimeout(pComp, StartTime, EERAM48LM01_RECALL_TIMEOUT_US); // Wait at least the operation time, check a last time, and give back the CPU meanwhile
     }
   }
   return ERR_NONE;
@@ -684,6 +710,37 @@ eERRORRESULT EERAM48LM01_SetBlockWriteProtect(EERAM48LM01 *pComp, eEERAM48LM01_B
 }
 
 //-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// [STATIC] Get the current time of the timeouts of the EERAM48LM01 device
+//=============================================================================
+uint32_t __EERAM48LM01_GetCurrentTime(EERAM48LM01 *pComp)
+{
+  if (pComp->fnGetCurrentus != NULL) return pComp->fnGetCurrentus(); // Microsecond time if available...
+  return pComp->fnGetCurrentms();                                    // ...else millisecond time
+}
+
+
+//=============================================================================
+// [STATIC] Check the timeout of a wait loop and give back the CPU until the next check
+//=============================================================================
+bool __EERAM48LM01_WaitOrTimeout(EERAM48LM01 *pComp, uint32_t startTime, uint32_t timeoutus)
+{
+  if (pComp->fnGetCurrentus != NULL)
+  {
+    if (EERAM48LM01_TIME_DIFF(startTime, pComp->fnGetCurrentus()) > (timeoutus + 1u)) return true;                       // Wait at least timeout + 1us because GetCurrentus can be 1 cycle before the new us
+  }
+  else if (EERAM48LM01_TIME_DIFF(startTime, pComp->fnGetCurrentms()) > (((timeoutus + 999u) / 1000u) + 1u)) return true; // Wait at least timeout + 1ms because GetCurrentms can be 1 cycle before the new ms
+  if (pComp->fnYield != NULL) pComp->fnYield(timeoutus / 16u);                                                           // Check the device again after 1/16 of the operation time
+  return false;
+}
+
+//-----------------------------------------------------------------------------
 #ifdef __cplusplus
 }
 #endif
@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    48LM01.h
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.0.1
- * @date    04/01/2025
+ * @version 1.2.0
+ * @date    16/10/2026
  * @brief   EERAM48LM01 driver
  * @details SPI-Compatible 1-Mbit SPI Serial EERAM
  * Follow datasheet DS20006008C Rev.C (Oct 2019)
@@ -31,6 +31,8 @@
  *****************************************************************************/
 
 /* Revision history:
+ * 1.2.0    Add optional microsecond time and yield functions for the timeouts and the wait loops
+ * 1.1.0    Transfer the OP code, address, data, and CRC under one chip select assertion with SPI_Interface.fnSPI_TransferV
  * 1.0.1    Update error management to add context
  * 1.0.0    Release version
  *****************************************************************************/
@@ -73,6 +75,8 @@ extern "C" {
 
 #define EERAM48LM01_STORE_TIMEOUT      ( 10 ) //!< Store Operation Duration: 10ms
 #define EERAM48LM01_RECALL_TIMEOUT     (  0 ) //!< Store Operation Duration: 50s
+#define EERAM48LM01_STORE_TIMEOUT_US   ( 10000u ) //!< Store Operation Duration: 10ms
+#define EERAM48LM01_RECALL_TIMEOUT_US  (    50u ) //!< Recall Operation Duration: 50s
 
 //-----------------------------------------------------------------------------
 
@@ -202,6 +206,20 @@ typedef uint8_t TEERAM48LM01DriverInternal; //! Alias for Driver Internal data f
  */
 typedef uint32_t (*GetCurrentms_Func)(void);
 
+/*! @brief Function that gives the current microsecond of the system to the driver
+ *
+ * This function will be called when the driver needs to get current microsecond
+ * @return Returns the current microsecond of the system
+ */
+typedef uint32_t (*GetCurrentus_Func)(void);
+
+/*! @brief Function that gives back the CPU while the driver waits a device
+ *
+ * This function will be called in each turn of the wait loops of the driver. It can yield to the other tasks of an RTOS, or sleep a Linux thread
+ * @param[in] waitus Is the time in microsecond before the driver needs to check the device again, 0 if the device shall be checked as soon as possible
+ */
+typedef void (*Yield_Func)(uint32_t waitus);
+
 #ifdef USE_EXTERNAL_CRC16
 /*! @brief Function that compute CRC16-IBM3740 for the driver
  *
@@ -237,6 +255,10 @@ struct EERAM48LM01
 #ifdef USE_EXTERNAL_CRC16
   ComputeCRC16_Func fnComputeCRC16;          //!< This function will be called when a CRC16-IBM3740 computation is needed
 #endif
+
+  //--- Optional time call functions ---
+  GetCurrentus_Func fnGetCurrentus;          //!< Optional, can be NULL. This function will be called when the driver need to get current microsecond, the timeouts and waits are then at the microsecond
+  Yield_Func fnYield;                        //!< Optional, can be NULL. This function will be called in the wait loops of the driver to give back the CPU
 };
 //-----------------------------------------------------------------------------
 
@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    AT24MAC602.c
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.2.1
- * @date    04/01/2025
+ * @version 1.3.0
+ * @date    16/10/2026
  * @brief   AT24MAC602 driver
  * @details I2C-Compatible (2-wire) 2-Kbit (256kB x 8) Serial EEPROM with a
  * Factory-Programmed EUI-64 Address plus an Embedded Unique 128-bit Serial Number
@@ -52,6 +52,10 @@ const EEPROM_Conf AT24MAC602_Conf     = { .ChipAddress = 0xA0, .ChipSelect = EEP
 static eERRORRESULT __AT24MAC602_ReadPage(AT24MAC602 *pComp, uint8_t chipAddr, uint8_t address, uint8_t* data, size_t size);
 // Write data to the AT24MAC602 (DO NOT USE DIRECTLY, use AT24MAC602_WriteData() instead)
 static eERRORRESULT __AT24MAC602_WritePage(AT24MAC602 *pComp, uint8_t chipAddr, uint8_t address, const uint8_t* data, size_t size);
+// Get the current time of the timeouts (DO NOT USE DIRECTLY)
+static uint32_t __AT24MAC602_GetCurrentTime(AT24MAC602 *pComp);
+// Check the timeout of a wait loop and give back the CPU until the next check (DO NOT USE DIRECTLY)
+static bool __AT24MAC602_WaitOrTimeout(AT24MAC602 *pComp, uint32_t startTime, uint32_t timeoutus);
 //-----------------------------------------------------------------------------
 #define AT24MAC602_TIME_DIFF(begin,end)  ( ((end) >= (begin)) ? ((end) - (begin)) : (UINT32_MAX - ((begin) - (end) - 1)) ) // Works only if time difference is strictly inferior to (UINT32_MAX/2) and call often
 //-----------------------------------------------------------------------------
@@ -177,16 +181,15 @@ eERRORRESULT AT24MAC602_ReadEEPROMData(AT24MAC602 *pComp, uint8_t address, uint8
     PageRemData = (size < PageRemData ? size : PageRemData);                      // Get the least remaining bytes to read between remain size and remain in page
 
     //--- Read with timeout ---
-    uint32_t StartTime = pComp->Eeprom.fnGetCurrentms();                          // Start the timeout
+    uint32_t StartTime = __AT24MAC602_GetCurrentTime(pComp);                      // Start the timeout
+    bool TimedOut = false;
     while (true)
     {
       Error = __AT24MAC602_ReadPage(pComp, ChipAddr, address, data, PageRemData); // Read data from a page
       if (Error == ERR_NONE) break;                                               // All went fine, continue the data sending
       if (ERR_ERROR_Get(Error) != ERR__NOT_READY) return Error;                   // If there is an error while calling __AT24MAC602_ReadPage() then return the error
-      if (AT24MAC602_TIME_DIFF(StartTime, pComp->Eeprom.fnGetCurrentms()) > 6)    // Wait at least 5ms (see tWR in Table 6-3 from datasheet AC Characteristics) + 1ms because GetCurrentms can be 1 cycle before the new ms
-      {
-        return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                 // Timeout? return the error
-      }
+      if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                     // Still not ready after the timeout? return the error
+      TimedOut = __AT24MAC602_WaitOrTimeout(pComp, StartTime, AT24MAC602_WRITE_TIMEOUT_US); // Wait at least tWR, check a last time, and give back the CPU meanwhile
     }
     address += PageRemData;
     data += PageRemData;
@@ -269,16 +272,15 @@ eERRORRESULT AT24MAC602_WriteEEPROMData(AT24MAC602 *pComp, uint8_t address, cons
     PageRemData = (size < PageRemData ? size : PageRemData);                       // Get the least remaining bytes to write between remain size and remain in page
 
     //--- Write with timeout ---
-    uint32_t StartTime = pComp->Eeprom.fnGetCurrentms();                           // Start the timeout
+    uint32_t StartTime = __AT24MAC602_GetCurrentTime(pComp);                       // Start the timeout
+    bool TimedOut = false;
     while (true)
     {
       Error = __AT24MAC602_WritePage(pComp, ChipAddr, address, data, PageRemData); // Read data from a page
       if (Error == ERR_NONE) break;                                                // All went fine, continue the data sending
       if (ERR_ERROR_Get(Error) != ERR__NOT_READY) return Error;                    // If there is an error while calling __AT24MAC602_WritePage() then return the error
-      if (AT24MAC602_TIME_DIFF(StartTime, pComp->Eeprom.fnGetCurrentms()) > 6)     // Wait at least 5ms (see tWR in Table 6-3 from datasheet AC Characteristics) + 1ms because GetCurrentms can be 1 cycle before the new ms
-      {
-        return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                  // Timeout? return the error
-      }
+      if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                      // Still not ready after the timeout? return the error
+      TimedOut = __AT24MAC602_WaitOrTimeout(pComp, StartTime, AT24MAC602_WRITE_TIMEOUT_US); // Wait at least tWR, check a last time, and give back the CPU meanwhile
     }
     address += PageRemData;
     pData += PageRemData;
@@ -298,14 +300,13 @@ eERRORRESULT AT24MAC602_WriteEEPROMData(AT24MAC602 *pComp, uint8_t address, cons
 eERRORRESULT AT24MAC602_WaitEndOfWrite(AT24MAC602 *pComp)
 {
   //--- Write with timeout ---
-  uint32_t Timeout = pComp->Eeprom.fnGetCurrentms() + 6; // Wait at least 5ms (see tWR in Table 6-3 from datasheet AC Characteristics) + 1ms because GetCurrentms can be 1 cycle before the new ms
+  uint32_t StartTime = __AT24MAC602_GetCurrentTime(pComp);                         // Start the timeout
+  bool TimedOut = false;
   while (true)
   {
-    if (AT24MAC602_IsReady(pComp)) break;                // Wait the end of write, and exit if all went fine
-    if (pComp->Eeprom.fnGetCurrentms() >= Timeout)
-    {
-      return ERR_GENERATE(ERR__DEVICE_TIMEOUT);          // Timeout? return the error
-    }      
+    if (AT24MAC602_IsReady(pComp)) break;                                          // Wait the end of write, and exit if all went fine
+    if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                        // Still not ready after the timeout? return the error
+    TimedOut = __AT24MAC602_WaitOrTimeout(pComp, StartTime, AT24MAC602_WRITE_TIMEOUT_US); // Wait at least tWR, check a last time, and give back the CPU meanwhile
   }
   return ERR_NONE;
 }
@@ -359,6 +360,37 @@ eERRORRESULT AT24MAC602_SetPermanentWriteProtection(AT24MAC602 *pComp)
 }
 
 //-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// [STATIC] Get the current time of the timeouts of the AT24MAC602 device
+//=============================================================================
+uint32_t __AT24MAC602_GetCurrentTime(AT24MAC602 *pComp)
+{
+  if (pComp->Eeprom.fnGetCurrentus != NULL) return pComp->Eeprom.fnGetCurrentus(); // Microsecond time if available...
+  return pComp->Eeprom.fnGetCurrentms();                                           // ...else millisecond time
+}
+
+
+//=============================================================================
+// [STATIC] Check the timeout of a wait loop and give back the CPU until the next check
+//=============================================================================
+bool __AT24MAC602_WaitOrTimeout(AT24MAC602 *pComp, uint32_t startTime, uint32_t timeoutus)
+{
+  if (pComp->Eeprom.fnGetCurrentus != NULL)
+  {
+    if (AT24MAC602_TIME_DIFF(startTime, pComp->Eeprom.fnGetCurrentus()) > (timeoutus + 1u)) return true;                       // Wait at least timeout + 1us because GetCurrentus can be 1 cycle before the new us
+  }
+  else if (AT24MAC602_TIME_DIFF(startTime, pComp->Eeprom.fnGetCurrentms()) > (((timeoutus + 999u) / 1000u) + 1u)) return true; // Wait at least timeout + 1ms because GetCurrentms can be 1 cycle before the new ms
+  if (pComp->Eeprom.fnYield != NULL) pComp->Eeprom.fnYield(timeoutus / 16u);                                                   // Check the device again after 1/16 of the operation time
+  return false;
+}
+
+//-----------------------------------------------------------------------------
 #ifdef __cplusplus
 }
 #endif
@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    AT24MAC602.h
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.2.1
- * @date    04/01/2025
+ * @version 1.3.0
+ * @date    16/10/2026
  * @brief   AT24MAC602 driver
  * @details I2C-Compatible (2-wire) 2-Kbit (256kB x 8) Serial EEPROM with a
  * Factory-Programmed EUI-64™ Address plus an Embedded Unique 128-bit Serial Number
@@ -32,6 +32,7 @@
  *****************************************************************************/
 
 /* Revision history:
+ * 1.3.0    Add optional microsecond time and yield functions for the timeouts and the wait loops
  * 1.2.1    Update error management to add context
  * 1.2.0    Add EEPROM genericness
  * 1.1.0    I2C interface rework
@@ -88,6 +89,7 @@ extern "C" {
 #define AT24MAC602_PAGE_SIZE                ( 16 ) //!< The AT24MAC602 is 16 bytes page size
 #define AT24MAC602_PAGE_SIZE_MASK           ( AT24MAC602_PAGE_SIZE - 1 ) //!< The AT24MAC602 page mask is 0x0F
 #define AT24MAC602_EEPROM_SIZE              ( AT24MAC602_ADDRESS_SIZE_MAX * AT24MAC602_PAGE_SIZE ) //!< The AT24MAC602 total EEPROM size
+#define AT24MAC602_WRITE_TIMEOUT_US         ( 5000u ) //!< Write Cycle Time (tWR): 5ms (see Table 6-3 from datasheet AC Characteristics)
 
 #define AT24MAC602_SERIAL_SIZE              ( 16 ) //!< AT24MAC602 Unique Serial Number size
 
@@ -172,6 +174,20 @@ typedef struct AT24MAC602 AT24MAC602; //! Typedef of AT24MAC602 device object st
  * @return Returns the current millisecond of the system
  */
 typedef uint32_t (*GetCurrentms_Func)(void);
+
+/*! @brief Function that gives the current microsecond of the system to the driver
+ *
+ * This function will be called when the driver needs to get current microsecond
+ * @return Returns the current microsecond of the system
+ */
+typedef uint32_t (*GetCurrentus_Func)(void);
+
+/*! @brief Function that gives back the CPU while the driver waits a device
+ *
+ * This function will be called in each turn of the wait loops of the driver. It can yield to the other tasks of an RTOS, or sleep a Linux thread
+ * @param[in] waitus Is the time in microsecond before the driver needs to check the device again, 0 if the device shall be checked as soon as possible
+ */
+typedef void (*Yield_Func)(uint32_t waitus);
 #endif
 
 //-----------------------------------------------------------------------------
@@ -199,6 +215,10 @@ struct AT24MAC602
 
     //--- Device address ---
     uint8_t AddrA2A1A0;               //!< Device configurable address A2, A1, and A0. You can use the macro AT24MAC602_ADDR() to help filling this parameter. Only these 3 lower bits are used: ....210. where 2 is A2, 1 is A1, 0 is A0, and '.' are fixed by device
+
+    //--- Optional time call functions ---
+    GetCurrentus_Func fnGetCurrentus; //!< Optional, can be NULL. This function will be called when the driver need to get current microsecond, the timeouts and waits are then at the microsecond
+    Yield_Func fnYield;               //!< Optional, can be NULL. This function will be called in the wait loops of the driver to give back the CPU
   } Eeprom;
 #endif // USE_EEPROM_GENERICNESS
 };
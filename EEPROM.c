@@ -1,14 +1,15 @@
 /*!*****************************************************************************
  * @file    EEPROM.c
  * @author  FMA
- * @version 1.2.2
- * @date    04/01/2025
+ * @version 1.15.0
+ * @date    16/10/2026
  * @brief   Generic EEPROM driver
  * @details Generic I2C-Compatible (2-wire) Serial EEPROM
  * It can work with every memory with an address 1010xxx_ compatibility
  ******************************************************************************/
 
 //-----------------------------------------------------------------------------
+#include <string.h>
 #include "EEPROM.h"
 //-----------------------------------------------------------------------------
 #ifdef USE_ERROR_CONTEXT
@@ -30,6 +31,8 @@ extern "C" {
 #  define GET_I2C_INTERFACE  &pComp->I2C
 #endif
 
+#define GET_CURRENT_ADDRESS  ( *(pComp->pSharedCurrentAddress != NULL ? pComp->pSharedCurrentAddress : &pComp->CurrentAddress) ) //!< Address counter of the device, shared by the EEPROM objects of the device
+
 //-----------------------------------------------------------------------------
 
 
@@ -108,12 +111,44 @@ const EEPROM_Conf EERAM47C16_Conf = { .ChipAddress = 0xA0, .ChipSelect = EEPROM_
 //=============================================================================
 // Prototypes for private functions
 //=============================================================================
+// Format the EEPROM address and the chip address of an address (DO NOT USE DIRECTLY)
+static uint8_t __EEPROM_FormatAddress(EEPROM *pComp, uint32_t address, uint8_t* pAddress, uint8_t* pChipAddr);
 // Write EEPROM address to device (DO NOT USE DIRECTLY)
 static eERRORRESULT __EEPROM_WriteAddress(EEPROM *pComp, uint32_t address, const eI2C_TransferType transferType);
-// Read data from the EEPROM (DO NOT USE DIRECTLY, use EEPROM_ReadData() instead)
+// Transfer the EEPROM address then a data packet (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROM_TransferAtAddress(EEPROM *pComp, uint32_t address, I2CInterface_Packet* const pDataPacketDesc, const eI2C_TransferType transferType);
+// Read data from a block of the EEPROM (DO NOT USE DIRECTLY, use EEPROM_ReadData() instead)
 static eERRORRESULT __EEPROM_ReadPage(EEPROM *pComp, uint32_t address, uint8_t* data, size_t size);
 // Write data to the EEPROM (DO NOT USE DIRECTLY, use EEPROM_WriteData() instead)
 static eERRORRESULT __EEPROM_WritePage(EEPROM *pComp, uint32_t address, const uint8_t* data, size_t size);
+// Write data to the EEPROM in 1 packet with the address (DO NOT USE DIRECTLY, use EEPROM_WriteData() instead)
+static eERRORRESULT __EEPROM_WritePagePacket(EEPROM *pComp, uint32_t address, const uint8_t* data, size_t size, bool useDMA, uint8_t* pTransactionNumber);
+// Write data to a page of the EEPROM, retrying while the device is in its write cycle (DO NOT USE DIRECTLY, use EEPROM_WriteData() instead)
+static eERRORRESULT __EEPROM_WritePageWithTimeout(EEPROM *pComp, uint32_t address, const uint8_t* data, size_t size);
+// Get the changed span of a page part (DO NOT USE DIRECTLY, use EEPROM_WriteData() instead)
+static eERRORRESULT __EEPROM_GetChangedSpan(EEPROM *pComp, uint32_t address, const uint8_t* data, size_t size, size_t* pFirst, size_t* pEnd);
+// Are the bytes of a span all written by the updates of a batch (DO NOT USE DIRECTLY, use EEPROM_WriteBatch() instead)
+static bool __EEPROM_IsSpanFilled(const EEPROM_WriteUpdate* updates, size_t count, uint32_t first, uint32_t end);
+// Write a repeated pattern to a page of the EEPROM (DO NOT USE DIRECTLY, use EEPROM_Fill() instead)
+static eERRORRESULT __EEPROM_FillPage(EEPROM *pComp, uint32_t address, const uint8_t* pattern, size_t patternSize, size_t size);
+// Add a chunk of data to a CRC32 (DO NOT USE DIRECTLY, use EEPROM_ComputeCRC32() instead)
+static bool __EEPROM_CRC32Chunk(void* pContext, size_t offset, const uint8_t* data, size_t size);
+// Issue a page transfer of an asynchronous transfer (DO NOT USE DIRECTLY, use EEPROM_PollTransfer() instead)
+static eERRORRESULT __EEPROM_IssuePageAsync(EEPROM_AsyncTransfer* pAsync);
+// Get the current time of the timeouts and of the adaptive polling in microseconds (DO NOT USE DIRECTLY)
+static uint32_t __EEPROM_GetCurrentus(EEPROM *pComp);
+// Get the resolution of the time of the timeouts and of the adaptive polling in microseconds (DO NOT USE DIRECTLY)
+static uint32_t __EEPROM_GetTimeResolutionus(EEPROM *pComp);
+// Is the timeout elapsed (DO NOT USE DIRECTLY)
+static bool __EEPROM_IsTimeout(EEPROM *pComp, uint32_t startTime, uint32_t timeoutus);
+// Check the timeout of a wait loop and give back the CPU until the next check (DO NOT USE DIRECTLY)
+static bool __EEPROM_WaitOrTimeout(EEPROM *pComp, uint32_t startTime, uint32_t timeoutus);
+// Get the time without probe at the start of a write cycle with the adaptive polling (DO NOT USE DIRECTLY)
+static uint32_t __EEPROM_GetHoldOffus(EEPROM *pComp);
+// Is it time to probe the device with the adaptive polling (DO NOT USE DIRECTLY)
+static bool __EEPROM_IsProbeTime(EEPROM *pComp);
+// Update the adaptive polling with the result of a probe of the device (DO NOT USE DIRECTLY)
+static void __EEPROM_ProbeDone(EEPROM *pComp, bool ready, bool startWriteCycle);
 //-----------------------------------------------------------------------------
 #define EEPROM_TIME_DIFF(begin,end)  ( ((end) >= (begin)) ? ((end) - (begin)) : (UINT32_MAX - ((begin) - (end) - 1)) ) // Works only if time difference is strictly inferior to (UINT32_MAX/2) and call often
 //-----------------------------------------------------------------------------
@@ -140,6 +175,11 @@ eERRORRESULT Init_EEPROM(EEPROM *pComp)
 #endif
   eERRORRESULT Error;
 
+  GET_CURRENT_ADDRESS = EEPROM_ADDRESS_UNKNOWN;
+  pComp->Polling.MeasuredCycles = 0;                                             // The learned write cycle time is kept, it can be set by the user
+  pComp->Polling.Probes         = 0;
+  pComp->Polling.InWriteCycle   = false;
+  if (((pComp->Options & EEPROM_SINGLE_PACKET_WRITE) > 0) && (pComp->PacketBuffer == NULL)) return ERR_GENERATE(ERR__CONFIGURATION);
   if (pComp->I2CclockSpeed > pComp->Conf->MaxI2CclockSpeed) return ERR_GENERATE(ERR__I2C_FREQUENCY_ERROR);
   Error = pI2C->fnI2C_Init(pI2C, pComp->I2CclockSpeed);
   if (Error != ERR_NONE) return Error; // If there is an error while calling fnInterfaceInit() then return the error
@@ -174,6 +214,23 @@ bool EEPROM_IsReady(EEPROM *pComp)
 
 
 //**********************************************************************************************************************************************************
+//=============================================================================
+// [STATIC] Format the EEPROM address and the chip address of an address (DO NOT USE DIRECTLY)
+//=============================================================================
+uint8_t __EEPROM_FormatAddress(EEPROM *pComp, uint32_t address, uint8_t* pAddress, uint8_t* pChipAddr)
+{
+  const EEPROM_Conf* const pConf = pComp->Conf;
+  const uint8_t AddrBytes  =  (pConf->AddressType & (uint8_t)EEPROM_ADDRESS_Bytes_MASK);
+  const uint8_t AddrTypeAx = ((pConf->AddressType & (uint8_t)EEPROM_ADDRESS_plus_Ax_MASK) >> 4);
+  address += pConf->OffsetAddress;
+
+  //--- Create address ---
+  for (int_fast8_t z = AddrBytes; --z >=0;) pAddress[z] = (uint8_t)((address >> ((AddrBytes - z - 1) * 8)) & 0xFF);
+  *pChipAddr = (pConf->ChipAddress | (pComp->AddrA2A1A0 & ~AddrTypeAx) | ((address >> (8 * AddrBytes - 1)) & AddrTypeAx)) & I2C_WRITE_ANDMASK; // Generate chip address
+  return AddrBytes;
+}
+
+
 //=============================================================================
 // [STATIC] Write EEPROM address to device (DO NOT USE DIRECTLY)
 //=============================================================================
@@ -190,19 +247,17 @@ eERRORRESULT __EEPROM_WriteAddress(EEPROM *pComp, uint32_t address, const eI2C_T
   if (pI2C->fnI2C_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
   eERRORRESULT Error;
-  const EEPROM_Conf* const pConf = pComp->Conf;
-  const uint8_t AddrBytes  =  (pConf->AddressType & (uint8_t)EEPROM_ADDRESS_Bytes_MASK);
-  const uint8_t AddrTypeAx = ((pConf->AddressType & (uint8_t)EEPROM_ADDRESS_plus_Ax_MASK) >> 4);
-  address += pConf->OffsetAddress;
+  GET_CURRENT_ADDRESS = EEPROM_ADDRESS_UNKNOWN;                                                  // The address counter is set by the caller only if the transfer succeeds
 
   //--- Create address ---
   uint8_t Address[EEPROM_ADDRESS_4Bytes];
-  for (int_fast8_t z = AddrBytes; --z >=0;) Address[z] = (uint8_t)((address >> ((AddrBytes - z - 1) * 8)) & 0xFF);
+  uint8_t ChipAddrW;
+  const uint8_t AddrBytes = __EEPROM_FormatAddress(pComp, address, &Address[0], &ChipAddrW);
   //--- Send the address ---
   I2CInterface_Packet PacketDesc =
   {
     I2C_MEMBER(Config.Value) I2C_BLOCKING | I2C_ENDIAN_TRANSFORM_SET(I2C_NO_ENDIAN_CHANGE) | I2C_TRANSFER_TYPE_SET(transferType),
-    I2C_MEMBER(ChipAddr    ) (pConf->ChipAddress | (pComp->AddrA2A1A0 & ~AddrTypeAx) | ((address >> (8 * AddrBytes - 1)) & AddrTypeAx)) & I2C_WRITE_ANDMASK, // Generate chip address
+    I2C_MEMBER(ChipAddr    ) ChipAddrW,
     I2C_MEMBER(Start       ) true,
     I2C_MEMBER(pBuffer     ) &Address[0],
     I2C_MEMBER(BufferSize  ) AddrBytes,
@@ -216,7 +271,50 @@ eERRORRESULT __EEPROM_WriteAddress(EEPROM *pComp, uint32_t address, const eI2C_T
 
 
 //=============================================================================
-// [STATIC] Read data from the EEPROM (DO NOT USE DIRECTLY, use EEPROM_ReadData() instead)
+// [STATIC] Transfer the EEPROM address then a data packet (DO NOT USE DIRECTLY)
+//=============================================================================
+eERRORRESULT __EEPROM_TransferAtAddress(EEPROM *pComp, uint32_t address, I2CInterface_Packet* const pDataPacketDesc, const eI2C_TransferType transferType)
+{
+  I2C_Interface* pI2C = GET_I2C_INTERFACE;
+#if defined(CHECK_NULL_PARAM)
+# if defined(USE_DYNAMIC_INTERFACE)
+  if (pI2C == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+# endif
+  if (pI2C->fnI2C_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  eERRORRESULT Error;
+
+  //--- Without packet chain, 1 call per packet ---
+  if (pI2C->fnI2C_TransferChain == NULL)
+  {
+    Error = __EEPROM_WriteAddress(pComp, address, transferType);                                 // Start a write at address with the device
+    if (Error != ERR_NONE) return Error;                                                         // If there is an error while calling __EEPROM_WriteAddress() then return the error
+    Error = pI2C->fnI2C_Transfer(pI2C, pDataPacketDesc);                                         // Continue the transfer with the data and stop transfer
+    if (ERR_ERROR_Get(Error) == ERR__I2C_NACK) return ERR_GENERATE(ERR__NOT_READY);              // If the device receive a NAK at the restart, or at the address when the interface sends the whole transfer at the stop, then the device is not ready
+    if (ERR_ERROR_Get(Error) == ERR__I2C_NACK_DATA) return ERR_GENERATE(ERR__I2C_INVALID_ADDRESS); // If the device receive a NAK while transferring data, then this is an invalid address, as with the packet chain
+    return Error;
+  }
+
+  //--- With packet chain, the address and the data in 1 call ---
+  uint8_t Address[EEPROM_ADDRESS_4Bytes];
+  uint8_t ChipAddrW;
+  const uint8_t AddrBytes = __EEPROM_FormatAddress(pComp, address, &Address[0], &ChipAddrW);
+  GET_CURRENT_ADDRESS = EEPROM_ADDRESS_UNKNOWN;                                                  // The address counter is set by the caller only if the transfer succeeds
+  I2CInterface_Packet Chain[2] =
+  {
+    I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &Address[0], AddrBytes, false, transferType),
+    *pDataPacketDesc,
+  };
+  Error = pI2C->fnI2C_TransferChain(pI2C, &Chain[0], 2);                                         // Transfer the address and the data
+  pDataPacketDesc->Config.Value = Chain[1].Config.Value;                                         // Get the transaction number of a non-blocking data transfer
+  if (ERR_ERROR_Get(Error) == ERR__I2C_NACK) return ERR_GENERATE(ERR__NOT_READY);                // If the device receive a NAK, then the device is not ready
+  if (ERR_ERROR_Get(Error) == ERR__I2C_NACK_DATA) return ERR_GENERATE(ERR__I2C_INVALID_ADDRESS); // If the device receive a NAK while transferring data, then this is an invalid address
+  return Error;
+}
+
+
+//=============================================================================
+// [STATIC] Read data from a block of the EEPROM (DO NOT USE DIRECTLY, use EEPROM_ReadData() instead)
 //=============================================================================
 eERRORRESULT __EEPROM_ReadPage(EEPROM *pComp, uint32_t address, uint8_t* data, size_t size)
 {
@@ -230,17 +328,29 @@ eERRORRESULT __EEPROM_ReadPage(EEPROM *pComp, uint32_t address, uint8_t* data, s
 # endif
   if (pI2C->fnI2C_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
-  if (size > pComp->Conf->PageSize) return ERR_GENERATE(ERR__OUT_OF_RANGE);
   const uint8_t ChipAddrR = ((pComp->Conf->ChipAddress | pComp->AddrA2A1A0) | I2C_READ_ORMASK);
+  const uint32_t DeviceAddress = address + pComp->Conf->OffsetAddress;          // The address counter is the device address, the same for all the EEPROM objects of the device
+  const uint8_t AddrBytes = (pComp->Conf->AddressType & (uint8_t)EEPROM_ADDRESS_Bytes_MASK);
+  const bool AddrTypeAx   = ((pComp->Conf->AddressType & (uint8_t)EEPROM_ADDRESS_plus_Ax_MASK) > 0);
+  const bool BlockEnd     = AddrTypeAx && (AddrBytes < EEPROM_ADDRESS_4Bytes) && (((DeviceAddress + size) & ((1ul << (8 * AddrBytes)) - 1u)) == 0);
   eERRORRESULT Error;
 
-  //--- Read the page ---
-  Error = __EEPROM_WriteAddress(pComp, address, I2C_WRITE_THEN_READ_FIRST_PART); // Start a write at address with the device
-  if (Error == ERR_NONE)                                                         // If there is no error while writing address then
+  //--- Current address read ---
+  if (((pComp->Options & EEPROM_CURRENT_ADDRESS_READ) > 0) && (DeviceAddress == GET_CURRENT_ADDRESS))
   {
+    GET_CURRENT_ADDRESS = EEPROM_ADDRESS_UNKNOWN;
+    I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_RX_DATA_DESC(ChipAddrR, true, data, size, true, I2C_SIMPLE_TRANSFER);
+    Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc);                         // Start a read transfer at the address counter of the device, get the data and stop transfer
+    if (ERR_ERROR_Get(Error) == ERR__I2C_NACK) return ERR_GENERATE(ERR__NOT_READY); // If the device receive a NAK, then the device is not ready
+  }
+  else
+  {
+    //--- Read the page ---
     I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_RX_DATA_DESC(ChipAddrR, true, data, size, true, I2C_WRITE_THEN_READ_SECOND_PART);
-    Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc);                         // Restart a read transfer, get the data and stop transfer
+    Error = __EEPROM_TransferAtAddress(pComp, address, &DataPacketDesc, I2C_WRITE_THEN_READ_FIRST_PART); // Write the address, restart a read transfer, get the data and stop transfer
   }
+  if ((Error == ERR_NONE) && ((address + size) < pComp->Conf->TotalByteSize) && (BlockEnd == false))
+    GET_CURRENT_ADDRESS = DeviceAddress + size;                                  // The device address counter is after the last byte read. At the end of the memory or of a block of the Ax bits, the roll-over is not tracked
   return Error;
 }
 
@@ -257,30 +367,41 @@ eERRORRESULT EEPROM_ReadData(EEPROM *pComp, uint32_t address, uint8_t* data, siz
 #endif
   const EEPROM_Conf* const pConf = pComp->Conf;
   if ((address + size) > pConf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  const uint8_t AddrBytes  = (pConf->AddressType & (uint8_t)EEPROM_ADDRESS_Bytes_MASK);
+  const bool AddrTypeAx    = ((pConf->AddressType & (uint8_t)EEPROM_ADDRESS_plus_Ax_MASK) > 0);
   eERRORRESULT Error;
-  size_t PageRemData;
+  size_t BlockRemData;
 
-  //--- Cut data to read into pages ---
+  //--- Cut data to read into blocks ---
   while (size > 0)
   {
-    PageRemData = pConf->PageSize - (address & (pConf->PageSize - 1));                        // Get how many bytes remain in the current page
-    PageRemData = (size < PageRemData ? size : PageRemData);                                  // Get the least remaining bytes to read between remain size and remain in page
+    BlockRemData = size;                                                                      // The sequential read rolls over the whole memory...
+    if (AddrTypeAx && (AddrBytes < EEPROM_ADDRESS_4Bytes))                                    // ...or over the block selected by the Ax bits of the chip address
+    {
+      const uint32_t BlockSize = (1ul << (8 * AddrBytes));
+      BlockRemData = BlockSize - ((address + pConf->OffsetAddress) & (BlockSize - 1u));       // Get how many bytes remain in the current block
+      BlockRemData = (size < BlockRemData ? size : BlockRemData);                             // Get the least remaining bytes to read between remain size and remain in block
+    }
+    if (BlockRemData > EEPROM_MAX_READ_SIZE) BlockRemData = EEPROM_MAX_READ_SIZE;             // The I2C interface limits the size of a transfer
 
     //--- Read with timeout ---
-    uint32_t StartTime = pComp->fnGetCurrentms();                                             // Start the timeout
+    uint32_t StartTime = __EEPROM_GetCurrentus(pComp);                                        // Start the timeout
+    bool TimedOut = false;
     while (true)
     {
-      Error = __EEPROM_ReadPage(pComp, address, data, PageRemData);                           // Read data from a page
-      if (Error == ERR_NONE) break;                                                           // All went fine, continue the data sending
-      if (ERR_ERROR_Get(Error) != ERR__NOT_READY) return Error;                               // If there is an error while calling __EEPROM_WritePage() then return the error
-      if (EEPROM_TIME_DIFF(StartTime, pComp->fnGetCurrentms()) > (pConf->PageWriteTime + 1u)) // Wait at least PageWriteTime + 1ms because GetCurrentms can be 1 cycle before the new ms
+      if (TimedOut || __EEPROM_IsProbeTime(pComp))                                            // With EEPROM_ADAPTIVE_POLLING, the device is not probed during most of its write cycle
       {
-        return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                             // Timeout? return the error
+        Error = __EEPROM_ReadPage(pComp, address, data, BlockRemData);                        // Read data from a block
+        if ((Error == ERR_NONE) || (ERR_ERROR_Get(Error) == ERR__NOT_READY)) __EEPROM_ProbeDone(pComp, (Error == ERR_NONE), false);
+        if (Error == ERR_NONE) break;                                                         // All went fine, continue the data sending
+        if (ERR_ERROR_Get(Error) != ERR__NOT_READY) return Error;                             // If there is an error while calling __EEPROM_WritePage() then return the error
       }
+      if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                 // Still not ready after the timeout? return the error
+      TimedOut = __EEPROM_WaitOrTimeout(pComp, StartTime, pConf->PageWriteTime * 1000u);      // Wait at least PageWriteTime, check a last time, and give back the CPU meanwhile
     }
-    address += PageRemData;
-    data += PageRemData;
-    size -= PageRemData;
+    address += BlockRemData;
+    data += BlockRemData;
+    size -= BlockRemData;
   }
   return ERR_NONE;
 }
@@ -297,6 +418,21 @@ eERRORRESULT __EEPROM_WritePage(EEPROM *pComp, uint32_t address, const uint8_t*
 #ifdef CHECK_NULL_PARAM
   if ((pComp == NULL) || (pComp->Conf == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
+  if (size > pComp->Conf->PageSize) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  const uint8_t ChipAddrW = ((pComp->Conf->ChipAddress | pComp->AddrA2A1A0) & I2C_WRITE_ANDMASK);
+  if ((pComp->Options & EEPROM_SINGLE_PACKET_WRITE) > 0) return __EEPROM_WritePagePacket(pComp, address, data, size, false, NULL);
+
+  //--- Write the page ---
+  I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, false, data, size, true, I2C_WRITE_THEN_WRITE_SECOND_PART);
+  return __EEPROM_TransferAtAddress(pComp, address, &DataPacketDesc, I2C_WRITE_THEN_WRITE_FIRST_PART); // Write the address, continue the transfer by sending the data and stop transfer
+}
+
+
+//=============================================================================
+// [STATIC] Write data to the EEPROM in 1 packet with the address (DO NOT USE DIRECTLY, use EEPROM_WriteData() instead)
+//=============================================================================
+eERRORRESULT __EEPROM_WritePagePacket(EEPROM *pComp, uint32_t address, const uint8_t* data, size_t size, bool useDMA, uint8_t* pTransactionNumber)
+{
   I2C_Interface* pI2C = GET_I2C_INTERFACE;
 #if defined(CHECK_NULL_PARAM)
 # if defined(USE_DYNAMIC_INTERFACE)
@@ -304,18 +440,49 @@ eERRORRESULT __EEPROM_WritePage(EEPROM *pComp, uint32_t address, const uint8_t*
 # endif
   if (pI2C->fnI2C_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
 #endif
+  if (pComp->PacketBuffer == NULL) return ERR_GENERATE(ERR__CONFIGURATION);
   if (size > pComp->Conf->PageSize) return ERR_GENERATE(ERR__OUT_OF_RANGE);
-  const uint8_t ChipAddrW = ((pComp->Conf->ChipAddress | pComp->AddrA2A1A0) & I2C_WRITE_ANDMASK);
   eERRORRESULT Error;
+  GET_CURRENT_ADDRESS = EEPROM_ADDRESS_UNKNOWN;
+
+  //--- Put the address in front of the data ---
+  uint8_t ChipAddrW;
+  const uint8_t AddrBytes = __EEPROM_FormatAddress(pComp, address, &pComp->PacketBuffer[0], &ChipAddrW);
+  memcpy(&pComp->PacketBuffer[AddrBytes], data, size);
+  //--- Send the page ---
+  I2CInterface_Packet PacketDesc = I2C_INTERFACE8_TX_DATA_DMA_DESC(ChipAddrW, true, &pComp->PacketBuffer[0], useDMA, AddrBytes + size, true, I2C_SIMPLE_TRANSFER);
+  Error = pI2C->fnI2C_Transfer(pI2C, &PacketDesc);                                               // Transfer the address and the data and stop transfer
+  if (pTransactionNumber != NULL) *pTransactionNumber = (uint8_t)I2C_TRANSACTION_NUMBER_GET(PacketDesc.Config.Value);
+  if (ERR_ERROR_Get(Error) == ERR__I2C_NACK) return ERR_GENERATE(ERR__NOT_READY);                // If the device receive a NAK, then the device is not ready
+  if (ERR_ERROR_Get(Error) == ERR__I2C_NACK_DATA) return ERR_GENERATE(ERR__I2C_INVALID_ADDRESS); // If the device receive a NAK while transferring data, then this is an invalid address
+  return Error;
+}
 
-  //--- Write the page ---
-  Error = __EEPROM_WriteAddress(pComp, address, I2C_WRITE_THEN_WRITE_FIRST_PART); // Start a write at address with the device
-  if (Error == ERR_NONE)                                                          // If there is no error while writing address then
+
+//=============================================================================
+// [STATIC] Get the changed span of a page part (DO NOT USE DIRECTLY, use EEPROM_WriteData() instead)
+//=============================================================================
+eERRORRESULT __EEPROM_GetChangedSpan(EEPROM *pComp, uint32_t address, const uint8_t* data, size_t size, size_t* pFirst, size_t* pEnd)
+{
+  uint8_t Buffer[EEPROM_COMPARE_BUFFER_SIZE];
+  eERRORRESULT Error;
+  *pFirst = size;
+  *pEnd   = 0;
+
+  //--- Compare the page part by chunks ---
+  for (size_t Pos = 0; Pos < size; Pos += EEPROM_COMPARE_BUFFER_SIZE)
   {
-    I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, false, data, size, true, I2C_WRITE_THEN_WRITE_SECOND_PART);
-    Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc);                          // Continue the transfer by sending the data and stop transfer
+    const size_t ChunkSize = ((size - Pos) < EEPROM_COMPARE_BUFFER_SIZE ? (size - Pos) : EEPROM_COMPARE_BUFFER_SIZE);
+    Error = EEPROM_ReadData(pComp, address + Pos, &Buffer[0], ChunkSize);       // Read the current data, the device can be in the write cycle of the previous page
+    if (Error != ERR_NONE) return Error;                                         // If there is an error while calling EEPROM_ReadData() then return the error
+    for (size_t z = 0; z < ChunkSize; ++z)
+      if (Buffer[z] != data[Pos + z])
+      {
+        if (*pFirst == size) *pFirst = Pos + z;                                  // First changed byte
+        *pEnd = Pos + z + 1;                                                     // Byte after the last changed byte
+      }
   }
-  return Error;
+  return ERR_NONE;
 }
 
 
@@ -339,18 +506,20 @@ eERRORRESULT EEPROM_WriteData(EEPROM *pComp, uint32_t address, const uint8_t* da
   {
     PageRemData = pConf->PageSize - (address & (pConf->PageSize - 1));                        // Get how many bytes remain in the current page
     PageRemData = (size < PageRemData ? size : PageRemData);                                  // Get the least remaining bytes to write between remain size and remain in page
+    size_t First = 0, End = PageRemData;
+
+    //--- Compare with the current data ---
+    if ((pComp->Options & EEPROM_READ_COMPARE_WRITE) > 0)
+    {
+      Error = __EEPROM_GetChangedSpan(pComp, address, data, PageRemData, &First, &End);
+      if (Error != ERR_NONE) return Error;                                                    // If there is an error while calling __EEPROM_GetChangedSpan() then return the error
+    }
 
     //--- Write with timeout ---
-    uint32_t StartTime = pComp->fnGetCurrentms();                                             // Start the timeout
-    while (true)
+    if (First < End)                                                                          // Nothing to write if the page is unchanged
     {
-      Error = __EEPROM_WritePage(pComp, address, data, PageRemData);                          // Write data to a page
-      if (Error == ERR_NONE) break;                                                           // All went fine, continue the data sending
-      if (ERR_ERROR_Get(Error) != ERR__NOT_READY) return Error;                               // If there is an error while calling __EEPROM_WritePage() then return the error
-      if (EEPROM_TIME_DIFF(StartTime, pComp->fnGetCurrentms()) > (pConf->PageWriteTime + 1u)) // Wait at least PageWriteTime + 1ms because GetCurrentms can be 1 cycle before the new ms
-      {
-        return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                             // Timeout? return the error
-      }
+      Error = __EEPROM_WritePageWithTimeout(pComp, address + First, &data[First], End - First);
+      if (Error != ERR_NONE) return Error;                                                    // If there is an error while calling __EEPROM_WritePageWithTimeout() then return the error
     }
     address += PageRemData;
     data += PageRemData;
@@ -360,6 +529,30 @@ eERRORRESULT EEPROM_WriteData(EEPROM *pComp, uint32_t address, const uint8_t* da
 }
 
 
+//=============================================================================
+// [STATIC] Write data to a page of the EEPROM, retrying while the device is in its write cycle (DO NOT USE DIRECTLY, use EEPROM_WriteData() instead)
+//=============================================================================
+eERRORRESULT __EEPROM_WritePageWithTimeout(EEPROM *pComp, uint32_t address, const uint8_t* data, size_t size)
+{
+  uint32_t StartTime = __EEPROM_GetCurrentus(pComp);                                          // Start the timeout
+  bool TimedOut = false;
+  eERRORRESULT Error;
+  while (true)
+  {
+    if (TimedOut || __EEPROM_IsProbeTime(pComp))                                              // With EEPROM_ADAPTIVE_POLLING, the device is not probed during most of its write cycle
+    {
+      Error = __EEPROM_WritePage(pComp, address, data, size);                                 // Write data to a page
+      if ((Error == ERR_NONE) || (ERR_ERROR_Get(Error) == ERR__NOT_READY)) __EEPROM_ProbeDone(pComp, (Error == ERR_NONE), true);
+      if (Error == ERR_NONE) break;                                                           // All went fine, continue the data sending
+      if (ERR_ERROR_Get(Error) != ERR__NOT_READY) return Error;                               // If there is an error while calling __EEPROM_WritePage() then return the error
+    }
+    if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                   // Still not ready after the timeout? return the error
+    TimedOut = __EEPROM_WaitOrTimeout(pComp, StartTime, pComp->Conf->PageWriteTime * 1000u);  // Wait at least PageWriteTime, check a last time, and give back the CPU meanwhile
+  }
+  return ERR_NONE;
+}
+
+
 //==============================================================================
 // Wait the end of write to the EEPROM device
 //==============================================================================
@@ -367,18 +560,799 @@ eERRORRESULT EEPROM_WaitEndOfWrite(EEPROM *pComp)
 {
   //--- Write with timeout ---
   const EEPROM_Conf* const pConf = pComp->Conf;
-  uint32_t StartTime = pComp->fnGetCurrentms();                                             // Start the timeout
+  uint32_t StartTime = __EEPROM_GetCurrentus(pComp);                                        // Start the timeout
+  bool TimedOut = false;
   while (true)
   {
-    if (EEPROM_IsReady(pComp)) break;                                                       // Wait the end of write, and exit if all went fine
-    if (EEPROM_TIME_DIFF(StartTime, pComp->fnGetCurrentms()) > (pConf->PageWriteTime + 1u)) // Wait at least PageWriteTime + 1ms because GetCurrentms can be 1 cycle before the new ms
+    if (TimedOut || __EEPROM_IsProbeTime(pComp))                                            // With EEPROM_ADAPTIVE_POLLING, the device is not probed during most of its write cycle
+    {
+      const bool Ready = EEPROM_IsReady(pComp);
+      __EEPROM_ProbeDone(pComp, Ready, false);
+      if (Ready) break;                                                                     // Wait the end of write, and exit if all went fine
+    }
+    if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                 // Still not ready after the timeout? return the error
+    TimedOut = __EEPROM_WaitOrTimeout(pComp, StartTime, pConf->PageWriteTime * 1000u);      // Wait at least PageWriteTime, check a last time, and give back the CPU meanwhile
+  }
+  return ERR_NONE;
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Write a batch of scattered updates to the EEPROM device
+//=============================================================================
+eERRORRESULT EEPROM_WriteBatch(EEPROM *pComp, const EEPROM_WriteUpdate* updates, size_t count, uint8_t* pageBuffer, size_t* pSavedCycles)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (pageBuffer == NULL) || ((updates == NULL) && (count > 0))) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pConf = pComp->Conf;
+  const uint32_t PageMask = ~((uint32_t)pConf->PageSize - 1u);
+  uint32_t NextPage = UINT32_MAX;
+  size_t SingleCycles = 0, Cycles = 0;
+  eERRORRESULT Error;
+
+  //--- Check the updates and count the write cycles of 1 write per update ---
+  for (size_t z = 0; z < count; ++z)
+  {
+    const EEPROM_WriteUpdate* const pUpdate = &updates[z];
+    if (pUpdate->Size == 0) continue;
+#ifdef CHECK_NULL_PARAM
+    if (pUpdate->Data == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+    if ((pUpdate->Address + pUpdate->Size) > pConf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+    SingleCycles += (((pUpdate->Address + pUpdate->Size - 1u) & PageMask) - (pUpdate->Address & PageMask)) / pConf->PageSize + 1u; // Pages touched by the update
+    if ((pUpdate->Address & PageMask) < NextPage) NextPage = pUpdate->Address & PageMask;
+  }
+
+  //--- Write the touched pages in address order ---
+  while (NextPage != UINT32_MAX)
+  {
+    const uint32_t Page = NextPage, PageEnd = NextPage + pConf->PageSize;
+    uint32_t First = PageEnd, End = Page;
+    NextPage = UINT32_MAX;
+    for (size_t z = 0; z < count; ++z)                                                        // Get the span of the updates in the page and the next touched page
+    {
+      const EEPROM_WriteUpdate* const pUpdate = &updates[z];
+      const uint32_t UpdateEnd = pUpdate->Address + pUpdate->Size;
+      if ((pUpdate->Size == 0) || (UpdateEnd <= Page)) continue;                              // Update empty or before the page
+      if (pUpdate->Address >= PageEnd)                                                        // Update after the page
+      {
+        if ((pUpdate->Address & PageMask) < NextPage) NextPage = pUpdate->Address & PageMask;
+        continue;
+      }
+      if (pUpdate->Address < First) First = (pUpdate->Address > Page ? pUpdate->Address : Page);
+      if (UpdateEnd > End) End = (UpdateEnd < PageEnd ? UpdateEnd : PageEnd);
+      if ((UpdateEnd > PageEnd) && (PageEnd < NextPage)) NextPage = PageEnd;                  // The update continues in the next page
+    }
+
+    //--- Merge the updates of the page ---
+    if (__EEPROM_IsSpanFilled(updates, count, First, End) == false)
+    {
+      Error = EEPROM_ReadData(pComp, First, &pageBuffer[First - Page], End - First);          // Read the bytes between the updates, the device can be in the write cycle of the previous page
+      if (Error != ERR_NONE) return Error;                                                    // If there is an error while calling EEPROM_ReadData() then return the error
+    }
+    for (size_t z = 0; z < count; ++z)                                                        // In the list order, so the last update wins on the overlaps
+    {
+      const EEPROM_WriteUpdate* const pUpdate = &updates[z];
+      const uint32_t UpdateEnd = pUpdate->Address + pUpdate->Size;
+      if ((pUpdate->Size == 0) || (UpdateEnd <= Page) || (pUpdate->Address >= PageEnd)) continue;
+      const uint32_t Begin = (pUpdate->Address > Page ? pUpdate->Address : Page);
+      const uint32_t Stop  = (UpdateEnd < PageEnd ? UpdateEnd : PageEnd);
+      memcpy(&pageBuffer[Begin - Page], &pUpdate->Data[Begin - pUpdate->Address], Stop - Begin);
+    }
+
+    //--- Compare with the current data ---
+    size_t ChangedFirst = 0, ChangedEnd = End - First;
+    if ((pComp->Options & EEPROM_READ_COMPARE_WRITE) > 0)
+    {
+      Error = __EEPROM_GetChangedSpan(pComp, First, &pageBuffer[First - Page], End - First, &ChangedFirst, &ChangedEnd);
+      if (Error != ERR_NONE) return Error;                                                    // If there is an error while calling __EEPROM_GetChangedSpan() then return the error
+    }
+
+    //--- Write the page ---
+    if (ChangedFirst < ChangedEnd)                                                            // Nothing to write if the page is unchanged, and no write cycle
     {
-      return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                             // Timeout? return the error
+      Error = __EEPROM_WritePageWithTimeout(pComp, First + ChangedFirst, &pageBuffer[First - Page + ChangedFirst], ChangedEnd - ChangedFirst); // The span is inside the page, so 1 write cycle
+      if (Error != ERR_NONE) return Error;                                                    // If there is an error while calling __EEPROM_WritePageWithTimeout() then return the error
+      ++Cycles;
     }
   }
+  if (pSavedCycles != NULL) *pSavedCycles = SingleCycles - Cycles;
   return ERR_NONE;
 }
 
+
+//=============================================================================
+// [STATIC] Are the bytes of a span all written by the updates of a batch (DO NOT USE DIRECTLY, use EEPROM_WriteBatch() instead)
+//=============================================================================
+bool __EEPROM_IsSpanFilled(const EEPROM_WriteUpdate* updates, size_t count, uint32_t first, uint32_t end)
+{
+  bool Extended = true;
+  while ((first < end) && Extended)                                                           // Extend the filled start of the span until a gap
+  {
+    Extended = false;
+    for (size_t z = 0; z < count; ++z)
+    {
+      const uint32_t UpdateEnd = updates[z].Address + updates[z].Size;
+      if ((updates[z].Address <= first) && (UpdateEnd > first)) { first = UpdateEnd; Extended = true; }
+    }
+  }
+  return (first >= end);
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Read many small fields from the EEPROM device
+//=============================================================================
+eERRORRESULT EEPROM_ReadV(EEPROM *pComp, EEPROM_ReadEntry* entries, size_t count)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || ((entries == NULL) && (count > 0))) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  uint8_t Buffer[EEPROM_READV_BUFFER_SIZE];
+  eERRORRESULT Error;
+
+  //--- Sort the entries by address ---
+  for (size_t z = 1; z < count; ++z)                                                          // Insertion sort, the entries are few and often already sorted
+  {
+    const EEPROM_ReadEntry Entry = entries[z];
+    size_t Pos = z;
+    for (; (Pos > 0) && (entries[Pos - 1].Address > Entry.Address); --Pos) entries[Pos] = entries[Pos - 1];
+    entries[Pos] = Entry;
+  }
+
+  //--- Read the close entries together ---
+  size_t First = 0;
+  while (First < count)
+  {
+    if (entries[First].Size == 0) { ++First; continue; }                                      // Nothing to read
+#ifdef CHECK_NULL_PARAM
+    if (entries[First].Data == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+    if (entries[First].Size > EEPROM_READV_BUFFER_SIZE)                                       // Too big for the buffer, read directly in the data array
+    {
+      Error = EEPROM_ReadData(pComp, entries[First].Address, entries[First].Data, entries[First].Size);
+      if (Error != ERR_NONE) return Error;                                                    // If there is an error while calling EEPROM_ReadData() then return the error
+      ++First;
+      continue;
+    }
+    const uint32_t Start = entries[First].Address;
+    uint32_t End = Start + entries[First].Size;
+    size_t Last = First + 1;
+    for (; Last < count; ++Last)                                                              // Get the entries that fit in the same read
+    {
+      const uint32_t EntryEnd = entries[Last].Address + entries[Last].Size;
+      if (entries[Last].Size == 0) continue;
+      if (entries[Last].Address > (End + EEPROM_READV_MAX_GAP)) break;                        // Too far from the previous entries
+      if ((EntryEnd > End) && ((EntryEnd - Start) > EEPROM_READV_BUFFER_SIZE)) break;         // Does not fit in the buffer
+#ifdef CHECK_NULL_PARAM
+      if (entries[Last].Data == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+      if (EntryEnd > End) End = EntryEnd;
+    }
+    Error = EEPROM_ReadData(pComp, Start, &Buffer[0], End - Start);                           // Read all the entries in 1 transaction
+    if (Error != ERR_NONE) return Error;                                                      // If there is an error while calling EEPROM_ReadData() then return the error
+    for (; First < Last; ++First)                                                             // Copy each field to its data array
+      if (entries[First].Size > 0) memcpy(entries[First].Data, &Buffer[entries[First].Address - Start], entries[First].Size);
+  }
+  return ERR_NONE;
+}
+
+
+
+//=============================================================================
+// [STATIC] Get the current time of the adaptive polling in microseconds (DO NOT USE DIRECTLY)
+//=============================================================================
+uint32_t __EEPROM_GetCurrentus(EEPROM *pComp)
+{
+  if (pComp->fnGetCurrentus != NULL) return pComp->fnGetCurrentus();
+  return pComp->fnGetCurrentms() * 1000u; // Wraps every ~71 minutes, the EEPROM_TIME_DIFF() of 2 times stays right
+}
+
+
+//=============================================================================
+// [STATIC] Get the resolution of the time of the adaptive polling in microseconds (DO NOT USE DIRECTLY)
+//=============================================================================
+uint32_t __EEPROM_GetTimeResolutionus(EEPROM *pComp)
+{
+  return (pComp->fnGetCurrentus != NULL ? 1u : 1000u);
+}
+
+
+//=============================================================================
+// [STATIC] Is the timeout elapsed (DO NOT USE DIRECTLY)
+//=============================================================================
+bool __EEPROM_IsTimeout(EEPROM *pComp, uint32_t startTime, uint32_t timeoutus)
+{
+  return (EEPROM_TIME_DIFF(startTime, __EEPROM_GetCurrentus(pComp)) > (timeoutus + __EEPROM_GetTimeResolutionus(pComp))); // Wait at least timeout + 1 resolution step because the time can be 1 cycle before the new step
+}
+
+
+//=============================================================================
+// [STATIC] Check the timeout of a wait loop and give back the CPU until the next check (DO NOT USE DIRECTLY)
+//=============================================================================
+bool __EEPROM_WaitOrTimeout(EEPROM *pComp, uint32_t startTime, uint32_t timeoutus)
+{
+  if (__EEPROM_IsTimeout(pComp, startTime, timeoutus)) return true;
+  if (pComp->fnYield == NULL) return false;
+  uint32_t Waitus = timeoutus / 16u;                                                          // Check the device again after 1/16 of the operation time...
+  EEPROM_Polling* const pPoll = &pComp->Polling;
+  if (((pComp->Options & EEPROM_ADAPTIVE_POLLING) > 0) && pPoll->InWriteCycle)                // ...or with EEPROM_ADAPTIVE_POLLING, at the time of the next probe
+  {
+    const uint32_t CurrentTime = __EEPROM_GetCurrentus(pComp);
+    const uint32_t Elapsed = EEPROM_TIME_DIFF(pPoll->CycleStartus, CurrentTime);
+    const uint32_t HoldOff = __EEPROM_GetHoldOffus(pComp);
+    const uint32_t SinceProbe = EEPROM_TIME_DIFF(pPoll->LastProbeus, CurrentTime);
+    if (Elapsed < HoldOff) Waitus = HoldOff - Elapsed;                                        // Until the end of the hold-off
+    else if (pPoll->CycleProbes == 0) Waitus = 0;
+    else Waitus = (SinceProbe < pPoll->Backoffus ? pPoll->Backoffus - SinceProbe : 0u);       // Until the end of the backoff
+  }
+  pComp->fnYield(Waitus);
+  return false;
+}
+
+
+//=============================================================================
+// [STATIC] Get the time without probe at the start of a write cycle with the adaptive polling (DO NOT USE DIRECTLY)
+//=============================================================================
+uint32_t __EEPROM_GetHoldOffus(EEPROM *pComp)
+{
+  const uint32_t Learned    = pComp->Polling.LearnedWriteTimeus;
+  const uint32_t HoldOff    = Learned - (Learned / 8u);                       // Do not probe during 7/8 of the learned write cycle time...
+  const uint32_t Resolution = __EEPROM_GetTimeResolutionus(pComp);
+  return (HoldOff > Resolution ? HoldOff - Resolution : 0u);                 // ...minus the resolution of the time, the start of the write cycle is known at 1 resolution step
+}
+
+
+//=============================================================================
+// [STATIC] Is it time to probe the device with the adaptive polling (DO NOT USE DIRECTLY)
+//=============================================================================
+bool __EEPROM_IsProbeTime(EEPROM *pComp)
+{
+  if ((pComp->Options & EEPROM_ADAPTIVE_POLLING) == 0) return true;                           // Without the option, the device is probed continuously
+  EEPROM_Polling* const pPoll = &pComp->Polling;
+  if (pPoll->InWriteCycle == false) return true;                                              // No write cycle in progress
+  const uint32_t CurrentTime = __EEPROM_GetCurrentus(pComp);
+  if (EEPROM_TIME_DIFF(pPoll->CycleStartus, CurrentTime) < __EEPROM_GetHoldOffus(pComp)) return false;
+  if ((pPoll->CycleProbes > 0)                                                                // The first probe is at the end of the hold-off...
+   && (pPoll->Backoffus >= __EEPROM_GetTimeResolutionus(pComp))                              // ...a backoff shorter than the resolution of the time cannot be measured, the device is probed continuously...
+   && (EEPROM_TIME_DIFF(pPoll->LastProbeus, CurrentTime) < pPoll->Backoffus)) return false;  // ...else the next probes are spaced by the backoff
+  pPoll->LastProbeus = CurrentTime;                                                           // The time of the probe is taken before the transfer, the transfer of a page write is not part of the write cycle
+  return true;
+}
+
+
+//=============================================================================
+// [STATIC] Update the adaptive polling with the result of a probe of the device (DO NOT USE DIRECTLY)
+//=============================================================================
+void __EEPROM_ProbeDone(EEPROM *pComp, bool ready, bool startWriteCycle)
+{
+  if ((pComp->Options & EEPROM_ADAPTIVE_POLLING) == 0) return;
+  EEPROM_Polling* const pPoll = &pComp->Polling;
+  const uint32_t CurrentTime = __EEPROM_GetCurrentus(pComp);
+
+  if (pPoll->InWriteCycle)
+  {
+    pPoll->Probes++;
+    if (pPoll->CycleProbes < UINT16_MAX) pPoll->CycleProbes++;
+    if (ready == false)                                                                       // NAK: wait longer before the next probe
+    {
+      pPoll->Backoffus = (pPoll->CycleProbes == 1u ? EEPROM_POLL_MIN_BACKOFF_US : (pPoll->Backoffus * 2u));
+      pPoll->Backoffus = (pPoll->Backoffus > EEPROM_POLL_MAX_BACKOFF_US ? EEPROM_POLL_MAX_BACKOFF_US : pPoll->Backoffus);
+      return;
+    }
+
+    //--- Learn the write cycle time ---
+    const uint32_t Measure = EEPROM_TIME_DIFF(pPoll->CycleStartus, pPoll->LastProbeus);       // The device was ready at the start of the probe
+    const uint32_t Window  = __EEPROM_GetHoldOffus(pComp) + EEPROM_POLL_MAX_BACKOFF_US + __EEPROM_GetTimeResolutionus(pComp);
+    const bool NearEnd = (pPoll->CycleProbes > 1u) || (Measure <= Window);                    // A NAK before the ACK, or an ACK at the end of the hold-off: the measure is near the real end of the write cycle
+    if (NearEnd && (Measure <= ((pComp->Conf->PageWriteTime + 1u) * 1000u)))                 // A device accessed long after its write cycle gives no measure
+    {
+      if (pPoll->LearnedWriteTimeus == 0) pPoll->LearnedWriteTimeus = Measure;
+      else pPoll->LearnedWriteTimeus = (uint32_t)((int32_t)pPoll->LearnedWriteTimeus + (((int32_t)Measure - (int32_t)pPoll->LearnedWriteTimeus) / 4)); // Moving average over ~4 write cycles
+      pPoll->MeasuredCycles++;
+    }
+    pPoll->InWriteCycle = false;
+  }
+
+  //--- A page write starts a new write cycle ---
+  if (ready && startWriteCycle)
+  {
+    pPoll->CycleStartus = CurrentTime;
+    pPoll->CycleProbes  = 0;
+    pPoll->InWriteCycle = true;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Fill an area of the EEPROM device with a repeated pattern
+//=============================================================================
+eERRORRESULT EEPROM_Fill(EEPROM *pComp, uint32_t address, size_t size, const uint8_t* pattern, size_t patternSize)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (pattern == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->fnGetCurrentms == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pConf = pComp->Conf;
+  if ((address + size) > pConf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  if ((patternSize == 0) || (patternSize > EEPROM_FILL_BUFFER_SIZE)) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  uint8_t Buffer[EEPROM_FILL_BUFFER_SIZE];
+  const size_t BufferSize = (EEPROM_FILL_BUFFER_SIZE / patternSize) * patternSize;            // Whole patterns, so each copy of the buffer continues the previous one
+  const size_t MaxWrite   = ((pComp->Options & EEPROM_SINGLE_PACKET_WRITE) > 0 ? pConf->PageSize : EEPROM_FILL_MAX_PACKETS * BufferSize);
+  size_t Phase = patternSize;                                                                 // The buffer is not filled yet
+  eERRORRESULT Error;
+
+  //--- Cut the area into pages ---
+  for (size_t Done = 0; Done < size; )
+  {
+    const uint32_t Address = address + (uint32_t)Done;
+    size_t WriteSize = pConf->PageSize - (Address & (pConf->PageSize - 1));                  // Get how many bytes remain in the current page
+    if (WriteSize > (size - Done)) WriteSize = size - Done;
+    if (WriteSize > MaxWrite) WriteSize = MaxWrite;
+
+    //--- Align the pattern on the start of the write ---
+    if ((Done % patternSize) != Phase)
+    {
+      Phase = Done % patternSize;
+      for (size_t z = 0; z < BufferSize; ++z) Buffer[z] = pattern[(Phase + z) % patternSize];
+    }
+
+    //--- Compare with the current data ---
+    bool Changed = true;
+    if ((pComp->Options & EEPROM_READ_COMPARE_WRITE) > 0)
+    {
+      Changed = false;
+      for (size_t Pos = 0; (Pos < WriteSize) && (Changed == false); Pos += BufferSize)
+      {
+        size_t First, End;
+        Error = __EEPROM_GetChangedSpan(pComp, Address + Pos, &Buffer[0], ((WriteSize - Pos) < BufferSize ? (WriteSize - Pos) : BufferSize), &First, &End);
+        if (Error != ERR_NONE) return Error;                                                  // If there is an error while calling __EEPROM_GetChangedSpan() then return the error
+        Changed = (First < End);
+      }
+    }
+
+    //--- Write with timeout ---
+    uint32_t StartTime = __EEPROM_GetCurrentus(pComp);                                        // Start the timeout
+    bool TimedOut = false;
+    while (Changed)                                                                           // Nothing to write if the page already holds the pattern
+    {
+      if (TimedOut || __EEPROM_IsProbeTime(pComp))                                            // With EEPROM_ADAPTIVE_POLLING, the device is not probed during most of its write cycle
+      {
+        Error = __EEPROM_FillPage(pComp, Address, &Buffer[0], BufferSize, WriteSize);         // Write the pattern to a page
+        if ((Error == ERR_NONE) || (ERR_ERROR_Get(Error) == ERR__NOT_READY)) __EEPROM_ProbeDone(pComp, (Error == ERR_NONE), true);
+        if (Error == ERR_NONE) break;                                                         // All went fine, continue with the next page
+        if (ERR_ERROR_Get(Error) != ERR__NOT_READY) return Error;                             // If there is an error while calling __EEPROM_FillPage() then return the error
+      }
+      if (TimedOut) return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                 // Still not ready after the timeout? return the error
+      TimedOut = __EEPROM_WaitOrTimeout(pComp, StartTime, pConf->PageWriteTime * 1000u);      // Wait at least PageWriteTime, check a last time, and give back the CPU meanwhile
+    }
+    Done += WriteSize;
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Erase an area of the EEPROM device
+//=============================================================================
+eERRORRESULT EEPROM_Erase(EEPROM *pComp, uint32_t address, size_t size)
+{
+  const uint8_t Erased = EEPROM_ERASED_VALUE;
+  return EEPROM_Fill(pComp, address, size, &Erased, sizeof(Erased));
+}
+
+
+//=============================================================================
+// [STATIC] Write a repeated pattern to a page of the EEPROM (DO NOT USE DIRECTLY, use EEPROM_Fill() instead)
+//=============================================================================
+eERRORRESULT __EEPROM_FillPage(EEPROM *pComp, uint32_t address, const uint8_t* pattern, size_t patternSize, size_t size)
+{
+  I2C_Interface* pI2C = GET_I2C_INTERFACE;
+#if defined(CHECK_NULL_PARAM)
+# if defined(USE_DYNAMIC_INTERFACE)
+  if (pI2C == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+# endif
+  if (pI2C->fnI2C_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (size > pComp->Conf->PageSize) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  uint8_t ChipAddrW;
+  eERRORRESULT Error = ERR_NONE;
+  GET_CURRENT_ADDRESS = EEPROM_ADDRESS_UNKNOWN;
+
+  if ((pComp->Options & EEPROM_SINGLE_PACKET_WRITE) > 0)
+  {
+    //--- Put the address and the pattern in the packet buffer ---
+    if (pComp->PacketBuffer == NULL) return ERR_GENERATE(ERR__CONFIGURATION);
+    const uint8_t AddrBytes = __EEPROM_FormatAddress(pComp, address, &pComp->PacketBuffer[0], &ChipAddrW);
+    for (size_t z = 0; z < size; ++z) pComp->PacketBuffer[AddrBytes + z] = pattern[z % patternSize];
+    I2CInterface_Packet PacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &pComp->PacketBuffer[0], AddrBytes + size, true, I2C_SIMPLE_TRANSFER);
+    Error = pI2C->fnI2C_Transfer(pI2C, &PacketDesc);                                             // Transfer the address and the data and stop transfer
+  }
+  else if (pI2C->fnI2C_TransferChain != NULL)
+  {
+    //--- The address then the pattern buffer repeated, in 1 transfer ---
+    if (size > (EEPROM_FILL_MAX_PACKETS * patternSize)) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+    uint8_t Address[EEPROM_ADDRESS_4Bytes];
+    const uint8_t AddrBytes = __EEPROM_FormatAddress(pComp, address, &Address[0], &ChipAddrW);
+    I2CInterface_Packet Chain[1 + EEPROM_FILL_MAX_PACKETS];
+    I2CInterface_Packet AddressPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &Address[0], AddrBytes, false, I2C_WRITE_THEN_WRITE_FIRST_PART);
+    Chain[0] = AddressPacketDesc;
+    size_t Count = 1;
+    for (size_t Pos = 0; Pos < size; Pos += patternSize)
+    {
+      const size_t ChunkSize = ((size - Pos) < patternSize ? (size - Pos) : patternSize);
+      I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, false, pattern, ChunkSize, ((Pos + ChunkSize) >= size), I2C_WRITE_THEN_WRITE_SECOND_PART);
+      Chain[Count++] = DataPacketDesc;                                                             // All the packets of the data send the same buffer
+    }
+    Error = pI2C->fnI2C_TransferChain(pI2C, &Chain[0], Count);                                   // Transfer the address and the data in 1 call
+  }
+  else
+  {
+    //--- Without packet chain, the address and the pattern repeated in a stack buffer, in 1 packet ---
+    if (size > (EEPROM_FILL_MAX_PACKETS * patternSize)) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+    uint8_t Buffer[EEPROM_ADDRESS_4Bytes + (EEPROM_FILL_MAX_PACKETS * EEPROM_FILL_BUFFER_SIZE)];
+    const uint8_t AddrBytes = __EEPROM_FormatAddress(pComp, address, &Buffer[0], &ChipAddrW);
+    for (size_t z = 0; z < size; ++z) Buffer[AddrBytes + z] = pattern[z % patternSize];
+    I2CInterface_Packet PacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &Buffer[0], AddrBytes + size, true, I2C_SIMPLE_TRANSFER);
+    Error = pI2C->fnI2C_Transfer(pI2C, &PacketDesc);                                             // Transfer the address and the data and stop transfer
+  }
+  if (ERR_ERROR_Get(Error) == ERR__I2C_NACK) return ERR_GENERATE(ERR__NOT_READY);                // If the device receive a NAK, then the device is not ready
+  if (ERR_ERROR_Get(Error) == ERR__I2C_NACK_DATA) return ERR_GENERATE(ERR__I2C_INVALID_ADDRESS); // If the device receive a NAK while transferring data, then this is an invalid address
+  return Error;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+// CRC-32 of IEEE 802.3 (reflected polynomial 0xEDB88320) table
+static const uint32_t __EEPROM_CRC32Table[256] =
+{
+  0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu, 0xE963A535u, 0x9E6495A3u,
+  0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u, 0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u,
+  0x1DB71064u, 0x6AB020F2u, 0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,
+  0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u, 0xFA0F3D63u, 0x8D080DF5u,
+  0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u, 0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu,
+  0x35B5A8FAu, 0x42B2986Cu, 0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+  0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u, 0xCFBA9599u, 0xB8BDA50Fu,
+  0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u, 0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du,
+  0x76DC4190u, 0x01DB7106u, 0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,
+  0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du, 0x91646C97u, 0xE6635C01u,
+  0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu, 0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u,
+  0x65B0D9C6u, 0x12B7E950u, 0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+  0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u, 0xA4D1C46Du, 0xD3D6F4FBu,
+  0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u, 0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u,
+  0x5005713Cu, 0x270241AAu, 0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,
+  0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u, 0xB7BD5C3Bu, 0xC0BA6CADu,
+  0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au, 0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u,
+  0xE3630B12u, 0x94643B84u, 0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+  0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu, 0x196C3671u, 0x6E6B06E7u,
+  0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu, 0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u,
+  0xD6D6A3E8u, 0xA1D1937Eu, 0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,
+  0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u, 0x316E8EEFu, 0x4669BE79u,
+  0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u, 0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu,
+  0xC5BA3BBEu, 0xB2BD0B28u, 0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+  0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu, 0x72076785u, 0x05005713u,
+  0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u, 0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u,
+  0x86D3D2D4u, 0xF1D4E242u, 0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,
+  0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u, 0x616BFFD3u, 0x166CCF45u,
+  0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u, 0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu,
+  0xAED16A4Au, 0xD9D65ADCu, 0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+  0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u, 0x54DE5729u, 0x23D967BFu,
+  0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u, 0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du
+};
+
+
+//=============================================================================
+// Update a CRC32 with a byte stream
+//=============================================================================
+uint32_t EEPROM_UpdateCRC32(uint32_t crc, const uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if (data == NULL) return crc;
+#endif
+  crc = ~crc;
+  while (size-- > 0)
+    crc = (crc >> 8) ^ __EEPROM_CRC32Table[(crc ^ *data++) & 0xFFu];
+  return ~crc;
+}
+
+
+//=============================================================================
+// Compute the CRC16-IBM3740 of a byte stream
+//=============================================================================
+void EEPROM_ComputeCRC16IBM3740(uint16_t* pCRC, const uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pCRC == NULL) || (data == NULL)) return;
+#endif
+  const uint16_t Polynome = 0x1021;
+
+  uint_fast16_t bit = 0;
+  while (size-- != 0)
+  {
+    *pCRC ^= ((uint16_t)*data++) << 8;
+    for (int_fast8_t i = 8; --i >= 0; )
+    {
+      bit = (*pCRC & 0x8000);
+      *pCRC <<= 1;
+      if (bit != 0) *pCRC ^= Polynome;
+    }
+  }
+}
+
+
+//=============================================================================
+// Compute the CRC32 of an area of the EEPROM device
+//=============================================================================
+eERRORRESULT EEPROM_ComputeCRC32(EEPROM *pComp, uint32_t address, size_t size, uint8_t* buffer, size_t bufferSize, uint32_t* pCRC)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pCRC == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  return EEPROM_VerifyAgainst(pComp, address, size, buffer, bufferSize, __EEPROM_CRC32Chunk, pCRC);
+}
+
+
+//=============================================================================
+// [STATIC] Add a chunk of data to a CRC32 (DO NOT USE DIRECTLY, use EEPROM_ComputeCRC32() instead)
+//=============================================================================
+bool __EEPROM_CRC32Chunk(void* pContext, size_t offset, const uint8_t* data, size_t size)
+{
+  (void)offset;
+  uint32_t* pCRC = (uint32_t*)pContext;
+  *pCRC = EEPROM_UpdateCRC32(*pCRC, data, size);
+  return true;
+}
+
+
+//=============================================================================
+// Verify an area of the EEPROM device against expected data
+//=============================================================================
+eERRORRESULT EEPROM_VerifyAgainst(EEPROM *pComp, uint32_t address, size_t size, uint8_t* buffer, size_t bufferSize, EEPROM_VerifyChunk_Func fnVerify, void* pContext)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (buffer == NULL) || (fnVerify == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if ((address + size) > pComp->Conf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  if (bufferSize == 0) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  eERRORRESULT Error;
+
+  //--- Read the area chunk by chunk in the scratch buffer ---
+  for (size_t Offset = 0; Offset < size; )
+  {
+    const size_t ChunkSize = ((size - Offset) < bufferSize ? (size - Offset) : bufferSize);
+    Error = EEPROM_ReadData(pComp, address + (uint32_t)Offset, buffer, ChunkSize);            // Read the next chunk, a sequential read that can cross the pages
+    if (Error != ERR_NONE) return Error;                                                      // If there is an error while calling EEPROM_ReadData() then return the error
+    if (fnVerify(pContext, Offset, buffer, ChunkSize) == false) return ERR_GENERATE(ERR__BAD_DATA); // The chunk does not hold the expected data
+    Offset += ChunkSize;
+  }
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Start an asynchronous read of data from the EEPROM device
+//=============================================================================
+eERRORRESULT EEPROM_StartReadData(EEPROM *pComp, EEPROM_AsyncTransfer* pAsync, uint32_t address, uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (pAsync == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->fnGetCurrentms == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pAsync->State != EEPROM_ASYNC_IDLE) return ERR_GENERATE(ERR__BUSY);
+  if ((address + size) > pComp->Conf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+
+  //--- Prepare the transfer ---
+  pAsync->pComp     = pComp;
+  pAsync->IsWrite   = false;
+  pAsync->Address   = address;
+  pAsync->Data      = data;
+  pAsync->Size      = size;
+  pAsync->PageSize  = 0;
+  pAsync->StartTime = __EEPROM_GetCurrentus(pComp);                                // Start the timeout of the first page
+  pAsync->State     = (size > 0 ? EEPROM_ASYNC_ISSUE_PAGE : EEPROM_ASYNC_IDLE);
+  return EEPROM_PollTransfer(pAsync);                                              // Issue the first page
+}
+
+
+//=============================================================================
+// Start an asynchronous write of data to the EEPROM device
+//=============================================================================
+eERRORRESULT EEPROM_StartWriteData(EEPROM *pComp, EEPROM_AsyncTransfer* pAsync, uint32_t address, const uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (pAsync == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pComp->fnGetCurrentms == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pAsync->State != EEPROM_ASYNC_IDLE) return ERR_GENERATE(ERR__BUSY);
+  if ((address + size) > pComp->Conf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+
+  //--- Prepare the transfer ---
+  pAsync->pComp     = pComp;
+  pAsync->IsWrite   = true;
+  pAsync->Address   = address;
+  pAsync->Data      = (uint8_t*)data;                                              // The data will only be read
+  pAsync->Size      = size;
+  pAsync->PageSize  = 0;
+  pAsync->StartTime = __EEPROM_GetCurrentus(pComp);                                // Start the timeout of the first page
+  pAsync->State     = (size > 0 ? EEPROM_ASYNC_ISSUE_PAGE : EEPROM_ASYNC_IDLE);
+  return EEPROM_PollTransfer(pAsync);                                              // Issue the first page
+}
+
+
+//=============================================================================
+// [STATIC] Issue a page transfer of an asynchronous transfer (DO NOT USE DIRECTLY, use EEPROM_PollTransfer() instead)
+//=============================================================================
+eERRORRESULT __EEPROM_IssuePageAsync(EEPROM_AsyncTransfer* pAsync)
+{
+  EEPROM* const pComp = pAsync->pComp;
+  const EEPROM_Conf* const pConf = pComp->Conf;
+  const uint8_t ChipAddr = (pConf->ChipAddress | pComp->AddrA2A1A0);
+  eERRORRESULT Error;
+
+  //--- Get the page part to transfer ---
+  size_t PageRemData = pConf->PageSize - (pAsync->Address & (pConf->PageSize - 1));                     // Get how many bytes remain in the current page
+  PageRemData = (pAsync->Size < PageRemData ? pAsync->Size : PageRemData);                             // Get the least remaining bytes to transfer between remain size and remain in page
+  pAsync->PageSize = PageRemData;
+
+  //--- Transfer the page ---
+  if (pAsync->IsWrite && ((pComp->Options & EEPROM_SINGLE_PACKET_WRITE) > 0))
+    return __EEPROM_WritePagePacket(pComp, pAsync->Address, pAsync->Data, PageRemData, true, &pAsync->TransactionNumber);
+  if (pAsync->IsWrite)
+  {
+    I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_TX_DATA_DMA_DESC(ChipAddr & I2C_WRITE_ANDMASK, false, pAsync->Data, true, PageRemData, true, I2C_WRITE_THEN_WRITE_SECOND_PART);
+    Error = __EEPROM_TransferAtAddress(pComp, pAsync->Address, &DataPacketDesc, I2C_WRITE_THEN_WRITE_FIRST_PART); // Write the address, continue the transfer by sending the data and stop transfer
+    pAsync->TransactionNumber = (uint8_t)I2C_TRANSACTION_NUMBER_GET(DataPacketDesc.Config.Value);
+  }
+  else
+  {
+    I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_RX_DATA_DMA_DESC(ChipAddr | I2C_READ_ORMASK, true, pAsync->Data, true, PageRemData, true, I2C_WRITE_THEN_READ_SECOND_PART);
+    Error = __EEPROM_TransferAtAddress(pComp, pAsync->Address, &DataPacketDesc, I2C_WRITE_THEN_READ_FIRST_PART);  // Write the address, restart a read transfer, get the data and stop transfer
+    pAsync->TransactionNumber = (uint8_t)I2C_TRANSACTION_NUMBER_GET(DataPacketDesc.Config.Value);
+  }
+  return Error;                                                                                        // ERR__NOT_READY if the device is in its write cycle
+}
+
+
+//=============================================================================
+// Poll an asynchronous transfer of the EEPROM device
+//=============================================================================
+eERRORRESULT EEPROM_PollTransfer(EEPROM_AsyncTransfer* pAsync)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pAsync == NULL) || (pAsync->pComp == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  EEPROM* const pComp = pAsync->pComp;
+  I2C_Interface* pI2C = GET_I2C_INTERFACE;
+#if defined(CHECK_NULL_PARAM)
+# if defined(USE_DYNAMIC_INTERFACE)
+  if (pI2C == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+# endif
+  if (pI2C->fnI2C_Transfer == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pConf = pComp->Conf;
+  eERRORRESULT Error;
+
+  switch (pAsync->State)
+  {
+    case EEPROM_ASYNC_ISSUE_PAGE:
+      if ((__EEPROM_IsProbeTime(pComp) == false)                                                        // With EEPROM_ADAPTIVE_POLLING, the device is not probed during most of its write cycle
+       && (__EEPROM_IsTimeout(pComp, pAsync->StartTime, pConf->PageWriteTime * 1000u) == false)) return ERR_GENERATE(ERR__BUSY);
+      Error = __EEPROM_IssuePageAsync(pAsync);                                                          // Try once to issue the next page
+      if (ERR_ERROR_Get(Error) == ERR__I2C_BUSY)                                                        // The page is in transfer in background
+      {
+        pAsync->State = EEPROM_ASYNC_PAGE_TRANSFER;
+        return ERR_GENERATE(ERR__BUSY);
+      }
+      if ((ERR_ERROR_Get(Error) == ERR__NOT_READY) || (ERR_ERROR_Get(Error) == ERR__I2C_OTHER_BUSY))    // The device is in its write cycle or the bus is used by another transfer
+      {
+        if (ERR_ERROR_Get(Error) == ERR__NOT_READY) __EEPROM_ProbeDone(pComp, false, false);
+        if (__EEPROM_IsTimeout(pComp, pAsync->StartTime, pConf->PageWriteTime * 1000u))                 // Wait at least PageWriteTime
+        {
+          pAsync->State = EEPROM_ASYNC_IDLE;
+          return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                                     // Timeout? stop the transfer and return the error
+        }
+        return ERR_GENERATE(ERR__BUSY);
+      }
+      break;                                                                                            // The page is transferred (blocking interface) or there is an error
+
+    case EEPROM_ASYNC_PAGE_TRANSFER:
+    {
+      const uint16_t CurrTransactionNumber = pAsync->TransactionNumber;
+      const uint8_t ChipAddr = (pConf->ChipAddress | pComp->AddrA2A1A0);
+      I2CInterface_Packet PacketDescCheck = I2C_INTERFACE8_CHECK_DMA_DESC(ChipAddr, CurrTransactionNumber);
+      Error = pI2C->fnI2C_Transfer(pI2C, &PacketDescCheck);                                             // Get the status of the current page transfer
+      if ((ERR_ERROR_Get(Error) == ERR__I2C_BUSY) || (ERR_ERROR_Get(Error) == ERR__I2C_OTHER_BUSY)) return ERR_GENERATE(ERR__BUSY);
+      if (ERR_ERROR_Get(Error) == ERR__I2C_NACK)                                                        // The device did not acknowledge its address, it is in its write cycle: issue the same page again
+      {
+        __EEPROM_ProbeDone(pComp, false, false);
+        if (__EEPROM_IsTimeout(pComp, pAsync->StartTime, pConf->PageWriteTime * 1000u))                 // Wait at least PageWriteTime
+        {
+          pAsync->State = EEPROM_ASYNC_IDLE;
+          return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                                     // Timeout? stop the transfer and return the error
+        }
+        pAsync->State = EEPROM_ASYNC_ISSUE_PAGE;
+        return ERR_GENERATE(ERR__BUSY);
+      }
+      if (ERR_ERROR_Get(Error) == ERR__I2C_NACK_DATA) Error = ERR_GENERATE(ERR__I2C_INVALID_ADDRESS);   // If the device receive a NAK while transferring data, then this is an invalid address
+      break;                                                                                            // The page is transferred or there is an error
+    }
+
+    case EEPROM_ASYNC_WAIT_END:
+      if (__EEPROM_IsProbeTime(pComp))                                                                  // With EEPROM_ADAPTIVE_POLLING, the device is not probed during most of its write cycle
+      {
+        const bool Ready = EEPROM_IsReady(pComp);                                                       // Check once the end of the write cycle of the last page
+        __EEPROM_ProbeDone(pComp, Ready, false);
+        if (Ready)
+        {
+          pAsync->State = EEPROM_ASYNC_IDLE;
+          return ERR_NONE;
+        }
+      }
+      if (__EEPROM_IsTimeout(pComp, pAsync->StartTime, pConf->PageWriteTime * 1000u))                   // Wait at least PageWriteTime
+      {
+        pAsync->State = EEPROM_ASYNC_IDLE;
+        return ERR_GENERATE(ERR__DEVICE_TIMEOUT);                                                       // Timeout? stop the transfer and return the error
+      }
+      return ERR_GENERATE(ERR__BUSY);
+
+    case EEPROM_ASYNC_IDLE:
+    default:
+      pAsync->State = EEPROM_ASYNC_IDLE;
+      return ERR_NONE;
+  }
+
+  //--- End of the page transfer ---
+  if (Error != ERR_NONE)
+  {
+    pAsync->State = EEPROM_ASYNC_IDLE;
+    return Error;                                                                                       // If there is an error while transferring the page then stop the transfer and return the error
+  }
+  __EEPROM_ProbeDone(pComp, true, pAsync->IsWrite);                                                     // The device acknowledged the page, a page write starts its write cycle
+  pAsync->Address += pAsync->PageSize;
+  pAsync->Data    += pAsync->PageSize;
+  pAsync->Size    -= pAsync->PageSize;
+  pAsync->StartTime = __EEPROM_GetCurrentus(pComp);                                                     // Start the timeout of the write cycle of the page
+  if (pAsync->Size > 0)
+  {
+    pAsync->State = EEPROM_ASYNC_ISSUE_PAGE;
+    return ERR_GENERATE(ERR__BUSY);
+  }
+  pAsync->State = (pAsync->IsWrite ? EEPROM_ASYNC_WAIT_END : EEPROM_ASYNC_IDLE);
+  return (pAsync->IsWrite ? ERR_GENERATE(ERR__BUSY) : ERR_NONE);
+}
+
 //-----------------------------------------------------------------------------
 #ifdef __cplusplus
 }
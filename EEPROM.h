@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    EEPROM.h
  * @author  FMA
- * @version 1.2.2
- * @date    04/01/2025
+ * @version 1.15.0
+ * @date    16/10/2026
  * @brief   Generic EEPROM driver
  * @details Generic I2C-Compatible (2-wire) Serial EEPROM
  * It can work with every memory with an address 1010xxx_ compatibility
@@ -31,6 +31,19 @@
  *****************************************************************************/
 
 /* Revision history:
+ * 1.15.0   Add EEPROM_ComputeCRC16IBM3740() function, shared by the EEPROM modules
+ * 1.14.0   Add EEPROM_ComputeCRC32() and EEPROM_VerifyAgainst() functions
+ * 1.13.0   Add EEPROM_Fill() and EEPROM_Erase() functions
+ * 1.12.0   Add EEPROM_ReadV() function
+ * 1.11.0   Add EEPROM_WriteBatch() function
+ * 1.10.0   Add optional microsecond time and yield functions for the timeouts and the wait loops
+ * 1.9.0    Add EEPROM_ADAPTIVE_POLLING option
+ * 1.8.0    Use the I2C_Interface.fnI2C_TransferChain when available
+ * 1.7.0    Add EEPROM_SINGLE_PACKET_WRITE option
+ * 1.6.0    EEPROM_ReadData() splits the reads only at the block boundaries of the Ax bits and every EEPROM_MAX_READ_SIZE bytes
+ * 1.5.0    Add EEPROM_CURRENT_ADDRESS_READ option, its address counter can be shared by the EEPROM objects of a device
+ * 1.4.0    Add driver options with EEPROM_READ_COMPARE_WRITE
+ * 1.3.0    Add asynchronous EEPROM_StartReadData(), EEPROM_StartWriteData(), and EEPROM_PollTransfer() functions
  * 1.2.2    Update error management to add context
  * 1.2.1    Rename 'ArrayByteSize' to 'TotalByteSize'
  *          Add 'OffsetAddress' parameter for some EEPROM configuration
@@ -173,6 +186,50 @@ extern const EEPROM_Conf EERAM47L16_Conf, EERAM47C16_Conf;
 // EEPROM Driver API
 //********************************************************************************************************************
 
+//! EEPROM driver options, can be OR'ed
+typedef enum
+{
+  EEPROM_NO_OPTION            = 0x00, //!< No driver option
+  EEPROM_READ_COMPARE_WRITE   = 0x01, //!< Read each page before writing it: the page is skipped if the data are unchanged, else only the changed span of the page is written
+  EEPROM_CURRENT_ADDRESS_READ = 0x02, //!< A read that continues where the last read ended uses a current address read (no address phase). Use only if all the accesses to the device are done through this driver. The EEPROM objects on the same device (views with another OffsetAddress) shall share the address counter with EEPROM.pSharedCurrentAddress
+  EEPROM_SINGLE_PACKET_WRITE  = 0x04, //!< Each page write is sent in 1 packet with the address in front of the data in the EEPROM.PacketBuffer, so a DMA can stream the whole page write
+  EEPROM_ADAPTIVE_POLLING     = 0x08, //!< The write cycle time of the device is learned, the device is not probed during most of this time and then it is probed with a bounded backoff. The bus is free for the other devices during the write cycles
+} eEEPROM_Options;
+
+#define EEPROM_ADDRESS_UNKNOWN  ( UINT32_MAX ) //!< The internal address counter of the device is unknown
+
+#define EEPROM_PACKET_BUFFER_SIZE(pageSize)  ( (pageSize) + EEPROM_ADDRESS_4Bytes ) //!< Minimum size of the EEPROM.PacketBuffer for a device of pageSize bytes page
+
+#ifndef EEPROM_POLL_MIN_BACKOFF_US
+#  define EEPROM_POLL_MIN_BACKOFF_US  ( 50u )  //!< First time between 2 probes of the device after the hold-off with EEPROM_ADAPTIVE_POLLING, in microseconds. The time is doubled after each NAK
+#endif
+#ifndef EEPROM_POLL_MAX_BACKOFF_US
+#  define EEPROM_POLL_MAX_BACKOFF_US  ( 200u ) //!< Maximum time between 2 probes of the device with EEPROM_ADAPTIVE_POLLING, in microseconds. It bounds the latency added at the end of a write cycle
+#endif
+
+#ifndef EEPROM_MAX_READ_SIZE
+#  define EEPROM_MAX_READ_SIZE  ( 4096u ) //!< Maximum count of bytes read in 1 transaction by EEPROM_ReadData(). It shall not be over the limit of the I2C interface (ex: 8192 bytes with I2C_LinuxDev, the i2c_msg length is 16-bits)
+#endif
+
+#ifndef EEPROM_COMPARE_BUFFER_SIZE
+#  define EEPROM_COMPARE_BUFFER_SIZE  ( 32u ) //!< Size of the stack buffer used to compare a page with EEPROM_READ_COMPARE_WRITE. A bigger buffer gives less read transactions
+#endif
+#ifndef EEPROM_READV_BUFFER_SIZE
+#  define EEPROM_READV_BUFFER_SIZE    ( 64u ) //!< Size of the stack buffer used by EEPROM_ReadV() to read close entries in 1 transaction. An entry bigger than this is read directly in its data array
+#endif
+#ifndef EEPROM_READV_MAX_GAP
+#  define EEPROM_READV_MAX_GAP        ( 8u )  //!< Maximum count of unused bytes between 2 entries read in 1 transaction by EEPROM_ReadV(). Reading a few more bytes costs less than a new address phase
+#endif
+#ifndef EEPROM_FILL_BUFFER_SIZE
+#  define EEPROM_FILL_BUFFER_SIZE     ( 32u ) //!< Size of the stack buffer of the repeated pattern of EEPROM_Fill(). This is the maximum size of the pattern
+#endif
+#ifndef EEPROM_FILL_MAX_PACKETS
+#  define EEPROM_FILL_MAX_PACKETS     ( 8u )  //!< Maximum count of data packets of the pattern buffer in 1 page write of EEPROM_Fill(). A page bigger than this count of buffers is written in several parts. Without packet chain, the stack buffer of 1 page write is this count of pattern buffers
+#endif
+#define EEPROM_ERASED_VALUE           ( 0xFFu ) //!< Value of the bytes written by EEPROM_Erase()
+
+//-----------------------------------------------------------------------------
+
 typedef struct EEPROM EEPROM; //! Typedef of EEPROM device object structure
 typedef uint8_t TEEPROMDriverInternal; //! Alias for Driver Internal data flags
 
@@ -185,6 +242,38 @@ typedef uint8_t TEEPROMDriverInternal; //! Alias for Driver Internal data flags
  */
 typedef uint32_t (*GetCurrentms_Func)(void);
 
+/*! @brief Function that gives the current microsecond of the system to the driver
+ *
+ * This function will be called when the driver needs to get current microsecond
+ * @return Returns the current microsecond of the system
+ */
+typedef uint32_t (*GetCurrentus_Func)(void);
+
+/*! @brief Function that gives back the CPU while the driver waits a device
+ *
+ * This function will be called in each turn of the wait loops of the driver. It can yield to the other tasks of an RTOS, or sleep a Linux thread
+ * @param[in] waitus Is the time in microsecond before the driver needs to check the device again, 0 if the device shall be checked as soon as possible
+ */
+typedef void (*Yield_Func)(uint32_t waitus);
+
+//-----------------------------------------------------------------------------
+
+//! EEPROM adaptive polling structure
+typedef struct EEPROM_Polling
+{
+  //--- Statistics ---
+  uint32_t LearnedWriteTimeus;          //!< Write cycle time of the device learned from the measurements in microseconds, 0 if not learned yet. Can be set before Init_EEPROM() to start with a known value
+  uint32_t MeasuredCycles;              //!< Count of write cycles measured since the initialization
+  uint32_t Probes;                      //!< Count of probes of the device (page write, read, or ready check) during the write cycles since the initialization. Can be cleared by the user
+
+  //--- Polling state ---
+  uint32_t CycleStartus;                //!< DO NOT USE OR CHANGE THIS VALUE, IT'S THE TIME OF THE END OF THE LAST PAGE WRITE
+  uint32_t LastProbeus;                 //!< DO NOT USE OR CHANGE THIS VALUE, IT'S THE TIME OF THE LAST PROBE
+  uint32_t Backoffus;                   //!< DO NOT USE OR CHANGE THIS VALUE, IT'S THE CURRENT TIME BETWEEN 2 PROBES
+  uint16_t CycleProbes;                 //!< DO NOT USE OR CHANGE THIS VALUE, IT'S THE COUNT OF PROBES OF THE CURRENT WRITE CYCLE
+  bool InWriteCycle;                    //!< DO NOT USE OR CHANGE THIS VALUE, IT'S 'true' WHEN A PAGE WRITE HAS BEEN SENT AND THE DEVICE HAS NOT ACK'ED YET
+} EEPROM_Polling;
+
 //-----------------------------------------------------------------------------
 
 //! EEPROM device object structure
@@ -209,6 +298,17 @@ struct EEPROM
 
   //--- Device address ---
   uint8_t AddrA2A1A0;                   //!< Device configurable address A2, A1, and A0. You can use the macro EEPROM_ADDR() to help filling this parameter. Only these 3 lower bits are used: ....210_ where 2 is A2, 1 is A1, 0 is A0. '.' and '_' are fixed by device
+
+  //--- Driver options ---
+  uint8_t Options;                      //!< Driver options, set a combination of #eEEPROM_Options or EEPROM_NO_OPTION
+  uint8_t* PacketBuffer;                //!< Buffer of at least EEPROM_PACKET_BUFFER_SIZE(Conf->PageSize) bytes, mandatory with EEPROM_SINGLE_PACKET_WRITE else can be NULL
+  uint32_t CurrentAddress;              //!< DO NOT USE OR CHANGE THIS VALUE, IT'S THE DEVICE ADDRESS (WITH THE OffsetAddress) OF THE NEXT BYTE TO READ BY THE DEVICE OR EEPROM_ADDRESS_UNKNOWN
+  EEPROM_Polling Polling;               //!< Learned write cycle time and polling statistics with EEPROM_ADAPTIVE_POLLING
+  uint32_t* pSharedCurrentAddress;      //!< Optional, can be NULL. Address counter of the device shared by all its EEPROM objects (ex: &CurrentAddress of the EEPROM object of the whole device) with EEPROM_CURRENT_ADDRESS_READ. If NULL, the CurrentAddress of this object is used
+
+  //--- Optional time call functions ---
+  GetCurrentus_Func fnGetCurrentus;     //!< Optional, can be NULL. This function will be called when the driver need to get current microsecond, the timeouts and waits are then at the microsecond
+  Yield_Func fnYield;                   //!< Optional, can be NULL. This function will be called in the wait loops of the driver to give back the CPU
 };
 
 //-----------------------------------------------------------------------------
@@ -237,6 +337,7 @@ bool EEPROM_IsReady(EEPROM *pComp);
 /*! @brief Read data from the EEPROM device
  *
  * This function reads data from the EEPROM area of a EEPROM device
+ * The read is sequential over the whole memory and is only split at the boundaries of the blocks selected by the Ax bits of the chip address (#eEEPROM_AddressType), and in transfers of EEPROM_MAX_READ_SIZE bytes at most
  * @param[in] *pComp Is the pointed structure of the device to be used
  * @param[in] address Is the address to read (can be inside a page)
  * @param[out] *data Is where the data will be stored
@@ -248,6 +349,7 @@ eERRORRESULT EEPROM_ReadData(EEPROM *pComp, uint32_t address, uint8_t* data, siz
 /*! @brief Write data to the EEPROM device
  *
  * This function writes data to the EEPROM area of a EEPROM device
+ * With the EEPROM_READ_COMPARE_WRITE option, the unchanged pages are not written and only the changed span of the other pages is written
  * @param[in] *pComp Is the pointed structure of the device to be used
  * @param[in] address Is the address where data will be written (can be inside a page)
  * @param[in] *data Is the data array to store
@@ -264,6 +366,227 @@ eERRORRESULT EEPROM_WriteData(EEPROM *pComp, uint32_t address, const uint8_t* da
 eERRORRESULT EEPROM_WaitEndOfWrite(EEPROM *pComp);
 
 //-----------------------------------------------------------------------------
+
+
+
+//! EEPROM write update of a batch structure
+typedef struct EEPROM_WriteUpdate
+{
+  uint32_t Address;           //!< Address where data will be written (can be inside a page)
+  const uint8_t* Data;        //!< Data array to store
+  size_t Size;                //!< Size of the data array to write. An update of size 0 is ignored
+} EEPROM_WriteUpdate;
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Write a batch of scattered updates to the EEPROM device
+ *
+ * This function writes the touched pages in address order with 1 page write (1 write cycle) per page instead of 1 per update and per page
+ * The updates of a page are merged in the page buffer from the first to the last byte they change. If they do not fill this span, the bytes between them are read from the device first
+ * When updates overlap, the last one in the list wins, as if they were written one after the other
+ * With the EEPROM_READ_COMPARE_WRITE option, each page is compared as with EEPROM_WriteData(), an unchanged page is not written and its write cycle is saved
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] *updates Is the array of the updates to write, the array is not changed
+ * @param[in] count Is the count of updates in the array
+ * @param[in] *pageBuffer Is a buffer of at least Conf->PageSize bytes used to merge the updates of a page
+ * @param[out] *pSavedCycles Is where the count of write cycles saved over 1 EEPROM_WriteData() per update will be stored. Can be NULL
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROM_WriteBatch(EEPROM *pComp, const EEPROM_WriteUpdate* updates, size_t count, uint8_t* pageBuffer, size_t* pSavedCycles);
+
+//-----------------------------------------------------------------------------
+
+
+
+//! EEPROM read entry of a vectored read structure
+typedef struct EEPROM_ReadEntry
+{
+  uint32_t Address;           //!< Address to read (can be inside a page)
+  uint8_t* Data;              //!< Where the data will be stored
+  size_t Size;                //!< Size of the data array to read. An entry of size 0 is ignored
+} EEPROM_ReadEntry;
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Read many small fields from the EEPROM device
+ *
+ * This function sorts the entries by address, then reads the entries that are at most #EEPROM_READV_MAX_GAP bytes apart in 1 sequential read of at most #EEPROM_READV_BUFFER_SIZE bytes and copies each field to its data array
+ * The sorted reads go well with the EEPROM_CURRENT_ADDRESS_READ option: a read that starts where the previous one ended has no address phase
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in,out] *entries Is the array of the entries to read, the array is sorted by address by this function
+ * @param[in] count Is the count of entries in the array
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROM_ReadV(EEPROM *pComp, EEPROM_ReadEntry* entries, size_t count);
+
+//-----------------------------------------------------------------------------
+
+
+
+/*! @brief Fill an area of the EEPROM device with a repeated pattern
+ *
+ * The pattern is repeated in a small stack buffer (#EEPROM_FILL_BUFFER_SIZE bytes) and each page is sent in 1 transfer with this buffer repeated in several data packets with the I2C_Interface.fnI2C_TransferChain, so a page is 1 write cycle without a page buffer
+ * Without packet chain, the address and the pattern are repeated in a stack buffer of #EEPROM_FILL_MAX_PACKETS x #EEPROM_FILL_BUFFER_SIZE bytes (plus the address) and each page is sent in 1 packet
+ * With the EEPROM_SINGLE_PACKET_WRITE option, the pattern is repeated in the EEPROM.PacketBuffer
+ * With the EEPROM_READ_COMPARE_WRITE option, the pages that already hold the pattern are not written
+ * The function does not wait the end of the write cycle. Use EEPROM_WaitEndOfWrite() to wait it
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] address Is the address of the first byte to fill (can be inside a page)
+ * @param[in] size Is the count of bytes to fill
+ * @param[in] *pattern Is the pattern to repeat, the first byte of the pattern is written at address
+ * @param[in] patternSize Is the size of the pattern, at most #EEPROM_FILL_BUFFER_SIZE bytes
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROM_Fill(EEPROM *pComp, uint32_t address, size_t size, const uint8_t* pattern, size_t patternSize);
+
+/*! @brief Erase an area of the EEPROM device
+ *
+ * This function fills the area with #EEPROM_ERASED_VALUE with EEPROM_Fill()
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] address Is the address of the first byte to erase (can be inside a page)
+ * @param[in] size Is the count of bytes to erase
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROM_Erase(EEPROM *pComp, uint32_t address, size_t size);
+
+//-----------------------------------------------------------------------------
+
+
+
+/*! @brief Function that checks a chunk of data read by EEPROM_VerifyAgainst()
+ *
+ * This function will be called with each chunk of the area read in the scratch buffer, in address order
+ * @param[in] *pContext Is the context given to EEPROM_VerifyAgainst()
+ * @param[in] offset Is the offset of the chunk from the start of the area
+ * @param[in] *data Is the data of the chunk read from the device
+ * @param[in] size Is the size of the chunk
+ * @return Returns 'true' if the chunk holds the expected data, else 'false' and the verification stops
+ */
+typedef bool (*EEPROM_VerifyChunk_Func)(void* pContext, size_t offset, const uint8_t* data, size_t size);
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Update a CRC32 with a byte stream
+ *
+ * This is the CRC-32 of IEEE 802.3 (reflected polynomial 0xEDB88320) computed with a table of 256 words, the same as the crc32() of zlib
+ * Start with a CRC of 0, the result of a call can be given to the next call to continue the computation
+ * @param[in] crc Is the CRC of the previous data, 0 for the first data
+ * @param[in] *data Is the byte stream of data to compute
+ * @param[in] size Is the size of the byte stream
+ * @return Returns the CRC32 of the previous data followed by this data
+ */
+uint32_t EEPROM_UpdateCRC32(uint32_t crc, const uint8_t* data, size_t size);
+
+/*! @brief Compute the CRC16-IBM3740 of a byte stream
+ *
+ * This is the CRC-16/IBM-3740 (polynomial 0x1021, not reflected, no final xor) used by the records of the EEPROM modules
+ * Start with a CRC of 0xFFFF, the CRC can be continued with the next data by another call
+ * @param[in,out] *pCRC Is the CRC of the previous data (0xFFFF for the first data), the CRC of the previous data followed by this data is stored here
+ * @param[in] *data Is the byte stream of data to compute
+ * @param[in] size Is the size of the byte stream
+ */
+void EEPROM_ComputeCRC16IBM3740(uint16_t* pCRC, const uint8_t* data, size_t size);
+
+/*! @brief Compute the CRC32 of an area of the EEPROM device
+ *
+ * The area is read in chunks of bufferSize bytes in the scratch buffer and each chunk is added to the CRC with EEPROM_UpdateCRC32() as soon as it is read, so the memory needed does not depend on the size of the area
+ * A bigger buffer gives less read transactions. With the EEPROM_CURRENT_ADDRESS_READ option, the chunks after the first one have no address phase
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] address Is the address of the first byte of the area (can be inside a page)
+ * @param[in] size Is the count of bytes of the area
+ * @param[in] *buffer Is the scratch buffer of bufferSize bytes
+ * @param[in] bufferSize Is the size of the scratch buffer, a page size or more is best
+ * @param[in,out] *pCRC Is the CRC to continue (0 for a new computation), the CRC32 of the area is stored here
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROM_ComputeCRC32(EEPROM *pComp, uint32_t address, size_t size, uint8_t* buffer, size_t bufferSize, uint32_t* pCRC);
+
+/*! @brief Verify an area of the EEPROM device against expected data
+ *
+ * The area is read in chunks of bufferSize bytes in the scratch buffer and each chunk is given to the fnVerify function as soon as it is read, so the expected data does not need to be in RAM all at once (it can be in flash, or computed)
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] address Is the address of the first byte of the area (can be inside a page)
+ * @param[in] size Is the count of bytes of the area
+ * @param[in] *buffer Is the scratch buffer of bufferSize bytes
+ * @param[in] bufferSize Is the size of the scratch buffer, a page size or more is best
+ * @param[in] fnVerify Is the function that checks each chunk
+ * @param[in] *pContext Is the context given to fnVerify. Can be NULL
+ * @return Returns ERR__BAD_DATA if a chunk does not hold the expected data, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROM_VerifyAgainst(EEPROM *pComp, uint32_t address, size_t size, uint8_t* buffer, size_t bufferSize, EEPROM_VerifyChunk_Func fnVerify, void* pContext);
+
+//-----------------------------------------------------------------------------
+
+
+
+//! EEPROM asynchronous transfer state enumerator
+typedef enum
+{
+  EEPROM_ASYNC_IDLE          = 0, //!< No transfer in progress, the last transfer is complete
+  EEPROM_ASYNC_ISSUE_PAGE    = 1, //!< The next page is to issue, the device can be in its write cycle
+  EEPROM_ASYNC_PAGE_TRANSFER = 2, //!< The data of a page are in transfer with a non-blocking I2C transfer
+  EEPROM_ASYNC_WAIT_END      = 3, //!< All the pages are sent, waiting the end of the write cycle of the last page (write only)
+} eEEPROM_AsyncState;
+
+
+//! EEPROM asynchronous transfer object structure
+typedef struct EEPROM_AsyncTransfer
+{
+  EEPROM *pComp;              //!< Device of the transfer
+  eEEPROM_AsyncState State;   //!< Current state of the transfer
+  bool IsWrite;               //!< 'true' if the transfer is a write else 'false'
+  uint32_t Address;           //!< Address of the next page to transfer
+  uint8_t* Data;              //!< Data of the next page to transfer
+  size_t Size;                //!< Remaining size to transfer
+  size_t PageSize;            //!< Size of the page in transfer
+  uint32_t StartTime;         //!< Start time of the timeout of the current page in microsecond
+  uint8_t TransactionNumber;  //!< Transaction number of the non-blocking I2C transfer in progress
+} EEPROM_AsyncTransfer;
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Start an asynchronous read of data from the EEPROM device
+ *
+ * This function issues the first page read and returns. Call EEPROM_PollTransfer() until it returns something else than ERR__BUSY
+ * Each page data is transferred with a non-blocking I2C transfer (I2C_USE_NON_BLOCKING) if the interface supports it
+ * @warning Never touch the data array before the completion of the transfer
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[out] *pAsync Is the asynchronous transfer object to use, it shall not be in use by another transfer
+ * @param[in] address Is the address to read (can be inside a page)
+ * @param[out] *data Is where the data will be stored
+ * @param[in] size Is the size of the data array to read
+ * @return Returns ERR__BUSY if the transfer is in progress, ERR_NONE if already complete, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROM_StartReadData(EEPROM *pComp, EEPROM_AsyncTransfer* pAsync, uint32_t address, uint8_t* data, size_t size);
+
+/*! @brief Start an asynchronous write of data to the EEPROM device
+ *
+ * This function issues the first page write and returns. Call EEPROM_PollTransfer() until it returns something else than ERR__BUSY
+ * Each poll tries to issue the next page only once, so the CPU is free during the write cycle of the device. The transfer is complete at the end of the write cycle of the last page
+ * @warning Never touch the data array before the completion of the transfer
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[out] *pAsync Is the asynchronous transfer object to use, it shall not be in use by another transfer
+ * @param[in] address Is the address where data will be written (can be inside a page)
+ * @param[in] *data Is the data array to store
+ * @param[in] size Is the size of the data array to write
+ * @return Returns ERR__BUSY if the transfer is in progress, ERR_NONE if already complete, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROM_StartWriteData(EEPROM *pComp, EEPROM_AsyncTransfer* pAsync, uint32_t address, const uint8_t* data, size_t size);
+
+/*! @brief Poll an asynchronous transfer of the EEPROM device
+ *
+ * This function never waits the device: it checks the non-blocking I2C transfer in progress, or tries once to issue the next page, or checks the end of the write cycle
+ * With the EEPROM_ADAPTIVE_POLLING option, the page writes are measured as with EEPROM_WriteData() and the device is not probed during most of its write cycle
+ * @param[in] *pAsync Is the asynchronous transfer object to poll
+ * @return Returns ERR__BUSY if the transfer is in progress, ERR_NONE if complete, else an #eERRORRESULT value enum and the transfer is stopped
+ */
+eERRORRESULT EEPROM_PollTransfer(EEPROM_AsyncTransfer* pAsync);
+
+//-----------------------------------------------------------------------------
 #ifdef __cplusplus
 }
 #endif
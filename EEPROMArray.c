@@ -0,0 +1,227 @@
+/*!*****************************************************************************
+ * @file    EEPROMArray.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Interleaved array of I2C EEPROMs
+ * @details Several identical I2C EEPROMs on a bus used as 1 unique memory with
+ * the pages striped across the devices to overlap their write cycles
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "EEPROMArray.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__EEPROMARRAY // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// Wait the transfer of a device of the array (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMArray_WaitTransfer(EEPROMArray *pArray, size_t device, bool endOfWrite);
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// EEPROM array initialization
+//=============================================================================
+eERRORRESULT Init_EEPROMArray(EEPROMArray *pArray)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pArray == NULL) || (pArray->Devices == NULL) || (pArray->Transfers == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pArray->DeviceCount == 0) return ERR_GENERATE(ERR__CONFIGURATION);
+  const EEPROM_Conf* const pConf = pArray->Devices[0].Conf;
+  if (pConf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  eERRORRESULT Error;
+
+  for (size_t zDev = 0; zDev < pArray->DeviceCount; ++zDev)
+  {
+    EEPROM* const pDevice = &pArray->Devices[zDev];
+    if (pDevice->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+    if ((pDevice->Conf->PageSize != pConf->PageSize) || (pDevice->Conf->TotalByteSize != pConf->TotalByteSize)) return ERR_GENERATE(ERR__CONFIGURATION);
+    Error = Init_EEPROM(pDevice);
+    if (Error != ERR_NONE) return Error;                                  // If there is an error while calling Init_EEPROM() then return the error
+    pArray->Transfers[zDev].State = EEPROM_ASYNC_IDLE;
+  }
+  pArray->PageSize      = pConf->PageSize;
+  pArray->TotalByteSize = pConf->TotalByteSize * (uint32_t)pArray->DeviceCount;
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Wait the transfer of a device of the array (DO NOT USE DIRECTLY)
+//=============================================================================
+eERRORRESULT __EEPROMArray_WaitTransfer(EEPROMArray *pArray, size_t device, bool endOfWrite)
+{
+  EEPROM_AsyncTransfer* const pTransfer = &pArray->Transfers[device];
+  eERRORRESULT Error = ERR_NONE;
+
+  while (pTransfer->State != EEPROM_ASYNC_IDLE)
+  {
+    if ((endOfWrite == false) && (pTransfer->State == EEPROM_ASYNC_WAIT_END)) break; // The data are transferred, the device is only in its write cycle
+    Error = EEPROM_PollTransfer(pTransfer);                                          // The timeout is managed by the transfer
+    if (ERR_ERROR_Get(Error) == ERR__BUSY) Error = ERR_NONE;
+    if (Error != ERR_NONE) break;
+  }
+  return Error;
+}
+
+
+//=============================================================================
+// Read data from the EEPROM array
+//=============================================================================
+eERRORRESULT EEPROMArray_ReadData(EEPROMArray *pArray, uint32_t address, uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pArray == NULL) || (pArray->Devices == NULL) || (pArray->Transfers == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pArray->PageSize == 0) return ERR_GENERATE(ERR__NOT_INITIALIZED);
+  if ((address + size) > pArray->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  eERRORRESULT Error;
+  size_t PageRemData;
+
+  //--- Cut data to read into stripes ---
+  while (size > 0)
+  {
+    const uint32_t Page    = address / pArray->PageSize;
+    const size_t Device    = (size_t)(Page % pArray->DeviceCount);                                          // Get the device of the page
+    const uint32_t Address = (uint32_t)(Page / pArray->DeviceCount) * pArray->PageSize + (address % pArray->PageSize); // Get the address in the device
+    PageRemData = pArray->PageSize - (address % pArray->PageSize);                                          // Get how many bytes remain in the current page
+    PageRemData = (size < PageRemData ? size : PageRemData);                                                // Get the least remaining bytes to read between remain size and remain in page
+
+    Error = __EEPROMArray_WaitTransfer(pArray, Device, false);                                              // A page transfer of this device can still be in progress
+    if (Error != ERR_NONE) return Error;                                                                    // If there is an error while calling __EEPROMArray_WaitTransfer() then return the error
+    Error = EEPROM_ReadData(&pArray->Devices[Device], Address, data, PageRemData);                          // The device NACK during its write cycle is managed by EEPROM_ReadData()
+    if (Error != ERR_NONE) return Error;                                                                    // If there is an error while calling EEPROM_ReadData() then return the error
+    address += PageRemData;
+    data += PageRemData;
+    size -= PageRemData;
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Write data to the EEPROM array
+//=============================================================================
+eERRORRESULT EEPROMArray_WriteData(EEPROMArray *pArray, uint32_t address, const uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pArray == NULL) || (pArray->Devices == NULL) || (pArray->Transfers == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pArray->PageSize == 0) return ERR_GENERATE(ERR__NOT_INITIALIZED);
+  if ((address + size) > pArray->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  eERRORRESULT Error;
+  size_t PageRemData;
+
+  //--- Cut data to write into stripes ---
+  while (size > 0)
+  {
+    const uint32_t Page    = address / pArray->PageSize;
+    const size_t Device    = (size_t)(Page % pArray->DeviceCount);                                          // Get the device of the page
+    const uint32_t Address = (uint32_t)(Page / pArray->DeviceCount) * pArray->PageSize + (address % pArray->PageSize); // Get the address in the device
+    PageRemData = pArray->PageSize - (address % pArray->PageSize);                                          // Get how many bytes remain in the current page
+    PageRemData = (size < PageRemData ? size : PageRemData);                                                // Get the least remaining bytes to write between remain size and remain in page
+
+    Error = __EEPROMArray_WaitTransfer(pArray, Device, true);                                               // Wait the end of the previous page of this device only, the other devices continue their write cycles
+    if (Error != ERR_NONE) return Error;                                                                    // If there is an error while calling __EEPROMArray_WaitTransfer() then return the error
+    Error = EEPROM_StartWriteData(&pArray->Devices[Device], &pArray->Transfers[Device], Address, data, PageRemData);
+    if (ERR_ERROR_Get(Error) == ERR__BUSY) Error = ERR_NONE;                                                // The page is issued, or will be at the next poll
+    if (Error != ERR_NONE) return Error;                                                                    // If there is an error while calling EEPROM_StartWriteData() then return the error
+    address += PageRemData;
+    data += PageRemData;
+    size -= PageRemData;
+  }
+
+  //--- Wait the end of the data transfers, the data array is not used after this function ---
+  for (size_t zDev = 0; zDev < pArray->DeviceCount; ++zDev)
+  {
+    Error = __EEPROMArray_WaitTransfer(pArray, zDev, false);
+    if (Error != ERR_NONE) return Error;                                                                    // If there is an error while calling __EEPROMArray_WaitTransfer() then return the error
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Fill an area of the EEPROM array with a repeated pattern
+//=============================================================================
+eERRORRESULT EEPROMArray_Fill(EEPROMArray *pArray, uint32_t address, size_t size, const uint8_t* pattern, size_t patternSize)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pArray == NULL) || (pArray->Devices == NULL) || (pArray->Transfers == NULL) || (pattern == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pArray->PageSize == 0) return ERR_GENERATE(ERR__NOT_INITIALIZED);
+  if ((address + size) > pArray->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  if ((patternSize == 0) || (patternSize > EEPROM_FILL_BUFFER_SIZE)) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  uint8_t Pattern[EEPROM_FILL_BUFFER_SIZE];
+  eERRORRESULT Error;
+  size_t PageRemData;
+
+  //--- Cut the area into stripes ---
+  for (size_t Done = 0; Done < size; Done += PageRemData)
+  {
+    const uint32_t Page    = (address + (uint32_t)Done) / pArray->PageSize;
+    const size_t Device    = (size_t)(Page % pArray->DeviceCount);                                          // Get the device of the page
+    const uint32_t Address = (uint32_t)(Page / pArray->DeviceCount) * pArray->PageSize + ((address + (uint32_t)Done) % pArray->PageSize); // Get the address in the device
+    PageRemData = pArray->PageSize - ((address + (uint32_t)Done) % pArray->PageSize);                       // Get how many bytes remain in the current page
+    PageRemData = ((size - Done) < PageRemData ? (size - Done) : PageRemData);                              // Get the least remaining bytes to fill between remain size and remain in page
+
+    for (size_t z = 0; z < patternSize; ++z) Pattern[z] = pattern[(Done + z) % patternSize];                // The pattern of the page starts where the previous page stopped
+    Error = __EEPROMArray_WaitTransfer(pArray, Device, true);                                               // A page transfer of EEPROMArray_WriteData() can still be in progress on this device
+    if (Error != ERR_NONE) return Error;                                                                    // If there is an error while calling __EEPROMArray_WaitTransfer() then return the error
+    Error = EEPROM_Fill(&pArray->Devices[Device], Address, PageRemData, &Pattern[0], patternSize);           // Only this device is polled if it is still in the write cycle of its previous page, the other devices continue their write cycles
+    if (Error != ERR_NONE) return Error;                                                                    // If there is an error while calling EEPROM_Fill() then return the error
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Wait the end of write of all the devices of the EEPROM array
+//=============================================================================
+eERRORRESULT EEPROMArray_WaitEndOfWrite(EEPROMArray *pArray)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pArray == NULL) || (pArray->Devices == NULL) || (pArray->Transfers == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  eERRORRESULT Error;
+
+  for (size_t zDev = 0; zDev < pArray->DeviceCount; ++zDev)
+  {
+    Error = __EEPROMArray_WaitTransfer(pArray, zDev, true);
+    if (Error != ERR_NONE) return Error;                                  // If there is an error while calling __EEPROMArray_WaitTransfer() then return the error
+    Error = EEPROM_WaitEndOfWrite(&pArray->Devices[zDev]);                // The last page of EEPROMArray_Fill() is not in an asynchronous transfer
+    if (Error != ERR_NONE) return Error;                                  // If there is an error while calling EEPROM_WaitEndOfWrite() then return the error
+  }
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
@@ -0,0 +1,138 @@
+/*!*****************************************************************************
+ * @file    EEPROMArray.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Interleaved array of I2C EEPROMs
+ * @details Several identical I2C EEPROMs on a bus used as 1 unique memory.
+ * The pages are striped across the devices: the logical page n is the page
+ * (n / DeviceCount) of the device (n % DeviceCount). A page write is issued to
+ * the next device while the previous devices are in their internal write cycle
+ * (tWR), so the sustained write throughput scales with the count of devices
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.1.0    Add EEPROMArray_Fill() function
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef EEPROMARRAY_H_INC
+#define EEPROMARRAY_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "EEPROM.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM array object
+//********************************************************************************************************************
+
+//! EEPROM array object structure
+typedef struct EEPROMArray
+{
+  EEPROM* Devices;                  //!< Array of the devices of the array, this parameter is mandatory. All devices shall have the same PageSize and TotalByteSize
+  EEPROM_AsyncTransfer* Transfers;  //!< Array of DeviceCount asynchronous transfer objects, one per device, this parameter is mandatory
+  size_t DeviceCount;               //!< Count of devices in the Devices array
+
+  //--- Set by Init_EEPROMArray() ---
+  size_t PageSize;                  //!< Page size of the devices, this is the stripe size
+  uint32_t TotalByteSize;           //!< Total size of the array in bytes
+} EEPROMArray;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM array API
+//********************************************************************************************************************
+
+/*! @brief EEPROM array initialization
+ *
+ * This function initializes all the devices of the array and checks they have the same geometry
+ * @param[in] *pArray Is the pointed structure of the array to be initialized
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_EEPROMArray(EEPROMArray *pArray);
+
+/*! @brief Read data from the EEPROM array
+ *
+ * @param[in] *pArray Is the pointed structure of the array to be used
+ * @param[in] address Is the logical address to read (can be inside a page)
+ * @param[out] *data Is where the data will be stored
+ * @param[in] size Is the size of the data array to read
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMArray_ReadData(EEPROMArray *pArray, uint32_t address, uint8_t* data, size_t size);
+
+/*! @brief Write data to the EEPROM array
+ *
+ * Each page is issued to its device as soon as this device finished the write cycle of its previous page, while the other devices are in their write cycles
+ * The function returns when all the data are transferred, the last pages can still be in their write cycles. Use EEPROMArray_WaitEndOfWrite() to wait them
+ * @param[in] *pArray Is the pointed structure of the array to be used
+ * @param[in] address Is the logical address where data will be written (can be inside a page)
+ * @param[in] *data Is the data array to store
+ * @param[in] size Is the size of the data array to write
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMArray_WriteData(EEPROMArray *pArray, uint32_t address, const uint8_t* data, size_t size);
+
+/*! @brief Fill an area of the EEPROM array with a repeated pattern
+ *
+ * Each page is filled with EEPROM_Fill() on its device, so the write cycles of the devices overlap as with EEPROMArray_WriteData(). With the EEPROM_READ_COMPARE_WRITE option of the devices, the pages that already hold the pattern are not written
+ * The function returns when all the pages are transferred, the last pages can still be in their write cycles. Use EEPROMArray_WaitEndOfWrite() to wait them
+ * @param[in] *pArray Is the pointed structure of the array to be used
+ * @param[in] address Is the logical address of the first byte to fill (can be inside a page)
+ * @param[in] size Is the count of bytes to fill
+ * @param[in] *pattern Is the pattern to repeat, the first byte of the pattern is written at address
+ * @param[in] patternSize Is the size of the pattern, at most #EEPROM_FILL_BUFFER_SIZE bytes
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMArray_Fill(EEPROMArray *pArray, uint32_t address, size_t size, const uint8_t* pattern, size_t patternSize);
+
+/*! @brief Wait the end of write of all the devices of the EEPROM array
+ *
+ * @param[in] *pArray Is the pointed structure of the array to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMArray_WaitEndOfWrite(EEPROMArray *pArray);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* EEPROMARRAY_H_INC */
@@ -0,0 +1,272 @@
+/*!*****************************************************************************
+ * @file    EEPROMCache.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Write-back page cache for I2C EEPROM
+ * @details RAM page cache over the generic EEPROM driver that merges the
+ * writes to a page and writes it once
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <string.h>
+#include "EEPROMCache.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__EEPROMCACHE // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// Get the line of a page in the cache (DO NOT USE DIRECTLY)
+static EEPROMCache_Line* __EEPROMCache_FindLine(EEPROMCache *pCache, uint32_t pageAddress);
+// Flush a line of the cache (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMCache_FlushLine(EEPROMCache *pCache, EEPROMCache_Line* pLine);
+//-----------------------------------------------------------------------------
+#define EEPROMCACHE_LINE_DATA(pCache,pLine)  ( &(pCache)->Buffer[(size_t)((pLine) - (pCache)->Lines) * (pCache)->pEeprom->Conf->PageSize] )
+#define EEPROMCACHE_IS_DIRTY(pLine)          ( (pLine)->DirtyEnd > (pLine)->DirtyFirst )
+#define EEPROMCACHE_TIME_DIFF(begin,end)     ( ((end) >= (begin)) ? ((end) - (begin)) : (UINT32_MAX - ((begin) - (end) - 1)) ) // Works only if time difference is strictly inferior to (UINT32_MAX/2) and call often
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// EEPROM cache initialization
+//=============================================================================
+eERRORRESULT Init_EEPROMCache(EEPROMCache *pCache)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pCache == NULL) || (pCache->pEeprom == NULL) || (pCache->Lines == NULL) || (pCache->Buffer == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if ((pCache->pEeprom->Conf == NULL) || (pCache->pEeprom->fnGetCurrentms == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pCache->LineCount == 0) return ERR_GENERATE(ERR__CONFIGURATION);
+  for (size_t zLine = 0; zLine < pCache->LineCount; ++zLine)
+  {
+    pCache->Lines[zLine].Valid      = false;
+    pCache->Lines[zLine].DirtyFirst = 0;
+    pCache->Lines[zLine].DirtyEnd   = 0;
+    pCache->Lines[zLine].LastUse    = 0;
+  }
+  pCache->UseCounter = 0;
+  pCache->PageWrites = 0;
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Get the line of a page in the cache (DO NOT USE DIRECTLY)
+//=============================================================================
+EEPROMCache_Line* __EEPROMCache_FindLine(EEPROMCache *pCache, uint32_t pageAddress)
+{
+  for (size_t zLine = 0; zLine < pCache->LineCount; ++zLine)
+    if (pCache->Lines[zLine].Valid && (pCache->Lines[zLine].PageAddress == pageAddress)) return &pCache->Lines[zLine];
+  return NULL;
+}
+
+
+//=============================================================================
+// [STATIC] Flush a line of the cache (DO NOT USE DIRECTLY)
+//=============================================================================
+eERRORRESULT __EEPROMCache_FlushLine(EEPROMCache *pCache, EEPROMCache_Line* pLine)
+{
+  if (EEPROMCACHE_IS_DIRTY(pLine) == false) return ERR_NONE;
+  const uint8_t* const pData = EEPROMCACHE_LINE_DATA(pCache, pLine);
+  eERRORRESULT Error;
+
+  //--- Write only the dirty part of the page in 1 page write ---
+  Error = EEPROM_WriteData(pCache->pEeprom, pLine->PageAddress + pLine->DirtyFirst, &pData[pLine->DirtyFirst], (size_t)(pLine->DirtyEnd - pLine->DirtyFirst));
+  if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_WriteData() then return the error, the line stays dirty
+  pLine->DirtyFirst = 0;
+  pLine->DirtyEnd   = 0;
+  pCache->PageWrites++;
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Read data through the EEPROM cache
+//=============================================================================
+eERRORRESULT EEPROMCache_ReadData(EEPROMCache *pCache, uint32_t address, uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pCache == NULL) || (pCache->pEeprom == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pConf = pCache->pEeprom->Conf;
+  if ((address + size) > pConf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  eERRORRESULT Error;
+  size_t PageRemData;
+
+  //--- Cut data to read into pages ---
+  while (size > 0)
+  {
+    const uint32_t PageAddress = address & ~((uint32_t)pConf->PageSize - 1u);
+    PageRemData = pConf->PageSize - (address - PageAddress);                                 // Get how many bytes remain in the current page
+    PageRemData = (size < PageRemData ? size : PageRemData);                                 // Get the least remaining bytes to read between remain size and remain in page
+
+    EEPROMCache_Line* const pLine = __EEPROMCache_FindLine(pCache, PageAddress);
+    if (pLine != NULL)                                                                       // The page is in the cache
+    {
+      memcpy(data, &EEPROMCACHE_LINE_DATA(pCache, pLine)[address - PageAddress], PageRemData);
+      pLine->LastUse = ++pCache->UseCounter;
+    }
+    else
+    {
+      Error = EEPROM_ReadData(pCache->pEeprom, address, data, PageRemData);                  // Read the page part directly from the EEPROM
+      if (Error != ERR_NONE) return Error;                                                   // If there is an error while calling EEPROM_ReadData() then return the error
+    }
+    address += PageRemData;
+    data += PageRemData;
+    size -= PageRemData;
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Write data through the EEPROM cache
+//=============================================================================
+eERRORRESULT EEPROMCache_WriteData(EEPROMCache *pCache, uint32_t address, const uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pCache == NULL) || (pCache->pEeprom == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pConf = pCache->pEeprom->Conf;
+  if ((address + size) > pConf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  eERRORRESULT Error;
+  size_t PageRemData;
+
+  //--- Cut data to write into pages ---
+  while (size > 0)
+  {
+    const uint32_t PageAddress = address & ~((uint32_t)pConf->PageSize - 1u);
+    const uint16_t Offset = (uint16_t)(address - PageAddress);
+    PageRemData = pConf->PageSize - Offset;                                                  // Get how many bytes remain in the current page
+    PageRemData = (size < PageRemData ? size : PageRemData);                                 // Get the least remaining bytes to write between remain size and remain in page
+
+    EEPROMCache_Line* pLine = __EEPROMCache_FindLine(pCache, PageAddress);
+    if (pLine == NULL)                                                                       // The page is not in the cache, allocate a line
+    {
+      pLine = &pCache->Lines[0];
+      for (size_t zLine = 0; zLine < pCache->LineCount; ++zLine)                            // Get a free line or else the least recently used line
+      {
+        if (pCache->Lines[zLine].Valid == false) { pLine = &pCache->Lines[zLine]; break; }
+        if ((pCache->UseCounter - pCache->Lines[zLine].LastUse) > (pCache->UseCounter - pLine->LastUse)) pLine = &pCache->Lines[zLine];
+      }
+      if (pLine->Valid)
+      {
+        Error = __EEPROMCache_FlushLine(pCache, pLine);                                      // Evict the line
+        if (Error != ERR_NONE) return Error;                                                 // If there is an error while calling __EEPROMCache_FlushLine() then return the error
+        pLine->Valid = false;
+      }
+      if (PageRemData < pConf->PageSize)                                                     // The write does not cover the whole page, get the page content first
+      {
+        Error = EEPROM_ReadData(pCache->pEeprom, PageAddress, EEPROMCACHE_LINE_DATA(pCache, pLine), pConf->PageSize);
+        if (Error != ERR_NONE) return Error;                                                 // If there is an error while calling EEPROM_ReadData() then return the error
+      }
+      pLine->PageAddress = PageAddress;
+      pLine->Valid       = true;
+    }
+
+    //--- Merge the data in the line ---
+    memcpy(&EEPROMCACHE_LINE_DATA(pCache, pLine)[Offset], data, PageRemData);
+    if (EEPROMCACHE_IS_DIRTY(pLine) == false)
+    {
+      pLine->DirtyFirst = Offset;
+      pLine->DirtyEnd   = (uint16_t)(Offset + PageRemData);
+      pLine->DirtyTime  = pCache->pEeprom->fnGetCurrentms();                                 // Start the flush delay
+    }
+    else
+    {
+      if (Offset < pLine->DirtyFirst) pLine->DirtyFirst = Offset;
+      if ((Offset + PageRemData) > pLine->DirtyEnd) pLine->DirtyEnd = (uint16_t)(Offset + PageRemData);
+    }
+    pLine->LastUse = ++pCache->UseCounter;
+    if (pCache->WriteThrough)
+    {
+      Error = __EEPROMCache_FlushLine(pCache, pLine);                                        // Write-through: the line is kept clean for the reads
+      if (Error != ERR_NONE) return Error;                                                   // If there is an error while calling __EEPROMCache_FlushLine() then return the error
+    }
+    address += PageRemData;
+    data += PageRemData;
+    size -= PageRemData;
+  }
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Flush all the dirty lines of the EEPROM cache and wait the end of the last write cycle
+//=============================================================================
+eERRORRESULT EEPROMCache_Sync(EEPROMCache *pCache)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pCache == NULL) || (pCache->pEeprom == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  bool Flushed = false;
+  eERRORRESULT Error;
+
+  for (size_t zLine = 0; zLine < pCache->LineCount; ++zLine)
+  {
+    if (EEPROMCACHE_IS_DIRTY(&pCache->Lines[zLine]) == false) continue;
+    Error = __EEPROMCache_FlushLine(pCache, &pCache->Lines[zLine]);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMCache_FlushLine() then return the error
+    Flushed = true;
+  }
+  return (Flushed ? EEPROM_WaitEndOfWrite(pCache->pEeprom) : ERR_NONE);
+}
+
+
+//=============================================================================
+// EEPROM cache task
+//=============================================================================
+eERRORRESULT EEPROMCache_Task(EEPROMCache *pCache)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pCache == NULL) || (pCache->pEeprom == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pCache->FlushDelay == 0) return ERR_NONE;
+  const uint32_t CurrentTime = pCache->pEeprom->fnGetCurrentms();
+  eERRORRESULT Error;
+
+  for (size_t zLine = 0; zLine < pCache->LineCount; ++zLine)
+  {
+    EEPROMCache_Line* const pLine = &pCache->Lines[zLine];
+    if (EEPROMCACHE_IS_DIRTY(pLine) == false) continue;
+    if (EEPROMCACHE_TIME_DIFF(pLine->DirtyTime, CurrentTime) < pCache->FlushDelay) continue;
+    Error = __EEPROMCache_FlushLine(pCache, pLine);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMCache_FlushLine() then return the error
+  }
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
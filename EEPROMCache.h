@@ -0,0 +1,154 @@
+/*!*****************************************************************************
+ * @file    EEPROMCache.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Write-back page cache for I2C EEPROM
+ * @details RAM page cache over the generic EEPROM driver. The writes to a page
+ * are merged in a cache line and the page is written once (1 transaction and
+ * 1 write cycle) at the sync, at the eviction of the line, or when the line
+ * is dirty for more than a delay. The lines are evicted in least recently used
+ * order. In write-through mode, each write is written to the EEPROM at once and
+ * the lines are only kept for the reads. The cache memory is given by the user, there is no dynamic allocation
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.1.0    Add the write-through mode with EEPROMCache.WriteThrough
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef EEPROMCACHE_H_INC
+#define EEPROMCACHE_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "EEPROM.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define EEPROMCACHE_BUFFER_SIZE(lineCount,pageSize)  ( (lineCount) * (pageSize) ) //!< Size of the data buffer of a cache of lineCount lines of pageSize bytes
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM cache objects
+//********************************************************************************************************************
+
+//! EEPROM cache line structure
+typedef struct EEPROMCache_Line
+{
+  uint32_t PageAddress;    //!< Address of the first byte of the page in the line
+  uint32_t LastUse;        //!< Value of the use counter of the cache at the last access of the line (LRU)
+  uint32_t DirtyTime;      //!< Time in millisecond of the first write in the line since the last flush
+  uint16_t DirtyFirst;     //!< First dirty byte of the line
+  uint16_t DirtyEnd;       //!< Byte after the last dirty byte of the line. The line is dirty if DirtyEnd > DirtyFirst
+  bool Valid;              //!< 'true' if the line contains the page at PageAddress
+} EEPROMCache_Line;
+
+
+//! EEPROM cache object structure
+typedef struct EEPROMCache
+{
+  EEPROM *pEeprom;         //!< EEPROM device of the cache, this parameter is mandatory
+  EEPROMCache_Line* Lines; //!< Array of LineCount lines, this parameter is mandatory
+  uint8_t* Buffer;         //!< Data buffer of EEPROMCACHE_BUFFER_SIZE(LineCount, pEeprom->Conf->PageSize) bytes, this parameter is mandatory
+  size_t LineCount;        //!< Count of lines of the cache
+  uint32_t FlushDelay;     //!< Maximum time in millisecond a line stays dirty when EEPROMCache_Task() is called. Set 0 to only flush at sync and eviction
+  bool WriteThrough;       //!< 'true' to write the data to the EEPROM at each write (write-through), the lines are only kept for the reads
+
+  //--- Cache state ---
+  uint32_t UseCounter;     //!< Counter of the accesses to the lines (LRU)
+  uint32_t PageWrites;     //!< Count of pages written to the EEPROM by the cache
+} EEPROMCache;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM cache API
+//********************************************************************************************************************
+
+/*! @brief EEPROM cache initialization
+ *
+ * All the lines are invalidated. The EEPROM device shall be initialized before with Init_EEPROM()
+ * @param[in] *pCache Is the pointed structure of the cache to be initialized
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_EEPROMCache(EEPROMCache *pCache);
+
+/*! @brief Read data through the EEPROM cache
+ *
+ * The pages in the cache are read from the cache, the others directly from the EEPROM without line allocation
+ * @param[in] *pCache Is the pointed structure of the cache to be used
+ * @param[in] address Is the address to read (can be inside a page)
+ * @param[out] *data Is where the data will be stored
+ * @param[in] size Is the size of the data array to read
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMCache_ReadData(EEPROMCache *pCache, uint32_t address, uint8_t* data, size_t size);
+
+/*! @brief Write data through the EEPROM cache
+ *
+ * The data are merged in the cache lines. A line is allocated for a page not in the cache, the least recently used line is flushed if needed and the page is read from the EEPROM if the write does not cover the whole page
+ * With WriteThrough, the line is flushed after the merge
+ * @param[in] *pCache Is the pointed structure of the cache to be used
+ * @param[in] address Is the address where data will be written (can be inside a page)
+ * @param[in] *data Is the data array to store
+ * @param[in] size Is the size of the data array to write
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMCache_WriteData(EEPROMCache *pCache, uint32_t address, const uint8_t* data, size_t size);
+
+/*! @brief Flush all the dirty lines of the EEPROM cache and wait the end of the last write cycle
+ *
+ * @param[in] *pCache Is the pointed structure of the cache to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMCache_Sync(EEPROMCache *pCache);
+
+/*! @brief EEPROM cache task
+ *
+ * Call this function periodically to flush the lines that are dirty for more than FlushDelay millisecond
+ * @param[in] *pCache Is the pointed structure of the cache to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMCache_Task(EEPROMCache *pCache);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* EEPROMCACHE_H_INC */
@@ -0,0 +1,290 @@
+/*!*****************************************************************************
+ * @file    EEPROMJournal.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Atomic multi-page transactions for I2C EEPROM
+ * @details Transaction layer over the generic EEPROM driver with a journal of
+ * shadow pages and a single commit page
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <string.h>
+#include "EEPROMJournal.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__EEPROMJOURNAL // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define EEPROMJOURNAL_MAGIC  ( 0x4E4Au ) // Magic of the commit page ("JN" in little endian)
+
+//! States of the commit page
+typedef enum
+{
+  EEPROMJOURNAL_COMMITTED = 0xC3, //!< The transaction is committed, the shadow pages may not be copied to the data yet
+  EEPROMJOURNAL_APPLIED   = 0x3C, //!< The shadow pages are copied to the data
+} eEEPROMJournal_State;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// Fill the commit record of the transaction in the page buffer (DO NOT USE DIRECTLY)
+static size_t __EEPROMJournal_FillRecord(EEPROMJournal *pJournal, eEEPROMJournal_State state);
+// Copy the shadow pages of the transaction to the data pages and mark the commit page as applied (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMJournal_Apply(EEPROMJournal *pJournal);
+//-----------------------------------------------------------------------------
+#define EEPROMJOURNAL_PAGE_SIZE(pJournal)  ( (uint32_t)(pJournal)->pEeprom->Conf->PageSize )
+#define EEPROMJOURNAL_SHADOW_ADDRESS(pJournal,index)  ( ((uint32_t)(index) + 1u) * EEPROMJOURNAL_PAGE_SIZE(pJournal) )
+#define EEPROMJOURNAL_GET32(pData)  ( (uint32_t)(pData)[0] | ((uint32_t)(pData)[1] << 8) | ((uint32_t)(pData)[2] << 16) | ((uint32_t)(pData)[3] << 24) )
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// EEPROM journal initialization and mount
+//=============================================================================
+eERRORRESULT Init_EEPROMJournal(EEPROMJournal *pJournal)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pJournal == NULL) || (pJournal->pEeprom == NULL) || (pJournal->pJournal == NULL) || (pJournal->Buffer == NULL) || (pJournal->Pages == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if ((pJournal->pEeprom->Conf == NULL) || (pJournal->pJournal->Conf == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pDataConf    = pJournal->pEeprom->Conf;
+  const EEPROM_Conf* const pJournalConf = pJournal->pJournal->Conf;
+  uint8_t* const pBuf = pJournal->Buffer;
+  eERRORRESULT Error;
+
+  //--- Check the configuration ---
+  if (pJournalConf->PageSize != pDataConf->PageSize) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pDataConf->PageSize < (EEPROMJOURNAL_HEADER_SIZE + 4u)) || (pJournalConf->TotalByteSize < (2u * pJournalConf->PageSize))) return ERR_GENERATE(ERR__CONFIGURATION);
+  if (((pDataConf->OffsetAddress & (pDataConf->PageSize - 1u)) != 0) || ((pJournalConf->OffsetAddress & (pJournalConf->PageSize - 1u)) != 0)) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pJournalConf->OffsetAddress + pJournalConf->TotalByteSize) > pDataConf->OffsetAddress) return ERR_GENERATE(ERR__CONFIGURATION); // The journal shall be in the area reserved before the data
+  uint32_t* const pDataCounter = (pJournal->pEeprom->pSharedCurrentAddress != NULL ? pJournal->pEeprom->pSharedCurrentAddress : &pJournal->pEeprom->CurrentAddress);
+  if (pJournal->pJournal->pSharedCurrentAddress == NULL) pJournal->pJournal->pSharedCurrentAddress = pDataCounter; // The 2 EEPROM objects are on the same device, they share its address counter
+  if ((pJournal->pJournal->pSharedCurrentAddress != pDataCounter) && (((pJournal->pEeprom->Options | pJournal->pJournal->Options) & EEPROM_CURRENT_ADDRESS_READ) > 0))
+    return ERR_GENERATE(ERR__CONFIGURATION);                                                 // With current address reads, the journal and the data shall share the address counter of the device
+  const uint32_t MaxPages = EEPROMJOURNAL_MAX_PAGES(pJournalConf->TotalByteSize, (uint32_t)pJournalConf->PageSize);
+  pJournal->MaxPages      = (uint16_t)(MaxPages < pJournal->PagesSize ? MaxPages : pJournal->PagesSize);
+  pJournal->PageCount     = 0;
+  pJournal->Sequence      = 0;
+  pJournal->InTransaction = false;
+  pJournal->Recovered     = false;
+  pJournal->Pending       = false;
+
+  //--- Check the last transaction ---
+  Error = EEPROM_ReadData(pJournal->pJournal, 0, pBuf, EEPROMJOURNAL_HEADER_SIZE);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_ReadData() then return the error
+  if ((pBuf[0] | ((uint16_t)pBuf[1] << 8)) != EEPROMJOURNAL_MAGIC) return ERR_NONE;          // Never committed
+  pJournal->Sequence = EEPROMJOURNAL_GET32(&pBuf[4]);
+  if (pBuf[2] != EEPROMJOURNAL_COMMITTED) return ERR_NONE;                                   // The last transaction is applied, nothing more to do
+  const uint16_t PageCount = (uint16_t)(pBuf[8] | ((uint16_t)pBuf[9] << 8));
+  const uint16_t RecordCRC = (uint16_t)(pBuf[10] | ((uint16_t)pBuf[11] << 8));
+  if ((EEPROMJOURNAL_HEADER_SIZE + ((size_t)PageCount * 4u)) > pDataConf->PageSize) return ERR_NONE; // Garbage: the addresses do not fit in the commit page, the commit did not complete
+  uint16_t CRC = 0xFFFF;
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pBuf[2], 1);
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pBuf[4], 6);
+  Error = EEPROM_ReadData(pJournal->pJournal, EEPROMJOURNAL_HEADER_SIZE, pBuf, (size_t)PageCount * 4u);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_ReadData() then return the error
+  EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, (size_t)PageCount * 4u);
+  if (CRC != RecordCRC) return ERR_NONE;                                                     // The commit did not complete, the data was not touched
+  if (PageCount > pJournal->MaxPages) return ERR_GENERATE(ERR__OUT_OF_MEMORY);               // A committed transaction that this configuration cannot copy to the data
+  for (size_t z = 0; z < PageCount; ++z) pJournal->Pages[z] = EEPROMJOURNAL_GET32(&pBuf[z * 4u]);
+  pJournal->PageCount = PageCount;
+  pJournal->Recovered = true;
+  pJournal->Pending   = true;
+  return __EEPROMJournal_Apply(pJournal);                                                    // Copy again the shadow pages, the copy is idempotent
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Fill the commit record of the transaction in the page buffer
+//=============================================================================
+size_t __EEPROMJournal_FillRecord(EEPROMJournal *pJournal, eEEPROMJournal_State state)
+{
+  uint8_t* const pBuf = pJournal->Buffer;
+  const uint32_t Sequence = pJournal->Sequence;
+  uint16_t CRC = 0xFFFF;
+
+  pBuf[0] = (uint8_t)EEPROMJOURNAL_MAGIC; pBuf[1] = (uint8_t)(EEPROMJOURNAL_MAGIC >> 8);
+  pBuf[2] = (uint8_t)state;
+  pBuf[3] = 0x00;
+  pBuf[4] = (uint8_t)Sequence; pBuf[5] = (uint8_t)(Sequence >> 8); pBuf[6] = (uint8_t)(Sequence >> 16); pBuf[7] = (uint8_t)(Sequence >> 24);
+  pBuf[8] = (uint8_t)pJournal->PageCount; pBuf[9] = (uint8_t)(pJournal->PageCount >> 8);
+  for (size_t z = 0; z < pJournal->PageCount; ++z)
+  {
+    uint8_t* const pAddr = &pBuf[EEPROMJOURNAL_HEADER_SIZE + (z * 4u)];
+    pAddr[0] = (uint8_t)pJournal->Pages[z]; pAddr[1] = (uint8_t)(pJournal->Pages[z] >> 8); pAddr[2] = (uint8_t)(pJournal->Pages[z] >> 16); pAddr[3] = (uint8_t)(pJournal->Pages[z] >> 24);
+  }
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pBuf[2], 1);                                             // The CRC covers the state
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pBuf[4], 6);
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pBuf[EEPROMJOURNAL_HEADER_SIZE], (size_t)pJournal->PageCount * 4u);
+  pBuf[10] = (uint8_t)CRC; pBuf[11] = (uint8_t)(CRC >> 8);
+  return EEPROMJOURNAL_HEADER_SIZE + ((size_t)pJournal->PageCount * 4u);
+}
+
+
+//=============================================================================
+// [STATIC] Copy the shadow pages of the transaction to the data pages and mark the commit page as applied
+//=============================================================================
+eERRORRESULT __EEPROMJournal_Apply(EEPROMJournal *pJournal)
+{
+  const uint32_t PageSize = EEPROMJOURNAL_PAGE_SIZE(pJournal);
+  eERRORRESULT Error;
+
+  for (size_t z = 0; z < pJournal->PageCount; ++z)
+  {
+    Error = EEPROM_ReadData(pJournal->pJournal, EEPROMJOURNAL_SHADOW_ADDRESS(pJournal, z), pJournal->Buffer, PageSize);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_ReadData() then return the error
+    Error = EEPROM_WriteData(pJournal->pEeprom, pJournal->Pages[z], pJournal->Buffer, PageSize);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_WriteData() then return the error
+  }
+  (void)__EEPROMJournal_FillRecord(pJournal, EEPROMJOURNAL_APPLIED);
+  Error = EEPROM_WriteData(pJournal->pJournal, 2, &pJournal->Buffer[2], EEPROMJOURNAL_HEADER_SIZE - 2u); // Write the state and its CRC. A torn write gives a bad CRC, and the data is already copied
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_WriteData() then return the error
+  pJournal->PageCount = 0;
+  pJournal->Pending   = false;
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Begin a transaction of the EEPROM journal
+//=============================================================================
+eERRORRESULT EEPROMJournal_Begin(EEPROMJournal *pJournal)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pJournal == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pJournal->InTransaction) return ERR_GENERATE(ERR__NOT_READY);
+  if (pJournal->Pending)                                                                     // The copy of the last committed transaction failed, its shadow pages shall not be overwritten before
+  {
+    eERRORRESULT Error = __EEPROMJournal_Apply(pJournal);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMJournal_Apply() then return the error
+  }
+  pJournal->PageCount     = 0;
+  pJournal->InTransaction = true;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Write data in the transaction of the EEPROM journal
+//=============================================================================
+eERRORRESULT EEPROMJournal_Write(EEPROMJournal *pJournal, uint32_t address, const uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pJournal == NULL) || (pJournal->pEeprom == NULL) || (pJournal->pJournal == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pJournal->InTransaction == false) return ERR_GENERATE(ERR__NOT_READY);
+  if ((address + size) > pJournal->pEeprom->Conf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  const uint32_t PageSize = EEPROMJOURNAL_PAGE_SIZE(pJournal);
+  uint8_t* const pBuf = pJournal->Buffer;
+  eERRORRESULT Error;
+
+  //--- Cut data to write into pages ---
+  while (size > 0)
+  {
+    const uint32_t PageAddress = address & ~(PageSize - 1u);
+    const size_t Offset = address - PageAddress;
+    const size_t ChunkSize = (size < (PageSize - Offset) ? size : (PageSize - Offset));
+    size_t Index = 0;
+    while ((Index < pJournal->PageCount) && (pJournal->Pages[Index] != PageAddress)) ++Index;
+
+    //--- Get the current content of the page ---
+    if (Index < pJournal->PageCount)                                                         // Already in the transaction, get its shadow page
+    {
+      if (ChunkSize < PageSize)
+      {
+        Error = EEPROM_ReadData(pJournal->pJournal, EEPROMJOURNAL_SHADOW_ADDRESS(pJournal, Index), pBuf, PageSize);
+        if (Error != ERR_NONE) return Error;                                                 // If there is an error while calling EEPROM_ReadData() then return the error
+      }
+    }
+    else
+    {
+      if (pJournal->PageCount >= pJournal->MaxPages) return ERR_GENERATE(ERR__OUT_OF_MEMORY); // The journal is full
+      if (ChunkSize < PageSize)                                                              // Not fully covered, get the data page
+      {
+        Error = EEPROM_ReadData(pJournal->pEeprom, PageAddress, pBuf, PageSize);
+        if (Error != ERR_NONE) return Error;                                                 // If there is an error while calling EEPROM_ReadData() then return the error
+      }
+      pJournal->Pages[pJournal->PageCount++] = PageAddress;
+    }
+
+    //--- Write the shadow page ---
+    memcpy(&pBuf[Offset], data, ChunkSize);
+    Error = EEPROM_WriteData(pJournal->pJournal, EEPROMJOURNAL_SHADOW_ADDRESS(pJournal, Index), pBuf, PageSize);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_WriteData() then return the error
+    address += ChunkSize;
+    data    += ChunkSize;
+    size    -= ChunkSize;
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Commit the transaction of the EEPROM journal
+//=============================================================================
+eERRORRESULT EEPROMJournal_Commit(EEPROMJournal *pJournal)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pJournal == NULL) || (pJournal->pEeprom == NULL) || (pJournal->pJournal == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pJournal->InTransaction == false) return ERR_GENERATE(ERR__NOT_READY);
+  pJournal->InTransaction = false;
+  if (pJournal->PageCount == 0) return ERR_NONE;                                             // Nothing to commit
+  const uint32_t LastSequence = pJournal->Sequence;
+  eERRORRESULT Error;
+
+  //--- Commit and apply ---
+  pJournal->Sequence++;
+  const size_t RecordSize = __EEPROMJournal_FillRecord(pJournal, EEPROMJOURNAL_COMMITTED);
+  Error = EEPROM_WriteData(pJournal->pJournal, 0, pJournal->Buffer, RecordSize);            // The single page write that commits the transaction
+  if (Error != ERR_NONE) { pJournal->Sequence = LastSequence; return Error; }               // If there is an error while calling EEPROM_WriteData() then return the error
+  pJournal->Pending = true;                                                                  // From here, the transaction shall be copied to the data before the next one
+  return __EEPROMJournal_Apply(pJournal);
+}
+
+
+//=============================================================================
+// Abort the transaction of the EEPROM journal
+//=============================================================================
+void EEPROMJournal_Abort(EEPROMJournal *pJournal)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pJournal == NULL) return;
+#endif
+  if (pJournal->InTransaction == false) return;                                              // Keep the pages of a committed transaction not copied yet
+  pJournal->PageCount     = 0;
+  pJournal->InTransaction = false;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
@@ -0,0 +1,162 @@
+/*!*****************************************************************************
+ * @file    EEPROMJournal.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Atomic multi-page transactions for I2C EEPROM
+ * @details Transaction layer over the generic EEPROM driver with a journal of
+ * shadow pages. The journal is an area of the same device reserved before the
+ * data with the EEPROM_Conf.OffsetAddress of the data: the data is accessed
+ * with an EEPROM object with this offset, and the journal with a second EEPROM
+ * object of the same device whose area ends before this offset.
+ * The writes of a transaction go to the shadow pages (a copy of each data page
+ * touched with the new data). The commit writes the commit page (first page of
+ * the journal) with the addresses of the data pages and a CRC16, this single
+ * page write is the atomic switch from the old data to the new data. Then the
+ * shadow pages are copied to the data pages and the commit page is marked as
+ * applied. The commit page has:
+ * - Magic (2 bytes) "JN"
+ * - State (1 byte): committed or applied
+ * - Reserved (1 byte)
+ * - Sequence (4 bytes, little endian): incremented at each commit
+ * - Page count (2 bytes, little endian)
+ * - CRC16-IBM3740 (2 bytes, little endian) of the state, the sequence, the page count, and the addresses
+ * - Addresses of the data pages (4 bytes each, little endian)
+ * The mount reads the header of the commit page, if the last transaction is
+ * applied (common case) there is nothing more to do. If it is committed and
+ * its CRC is good, the shadow pages are copied again to the data pages (the
+ * copy was interrupted by a power loss). A commit page with a bad CRC is a
+ * commit interrupted by a power loss: the data was not touched yet, or a mark
+ * as applied interrupted by a power loss: the data was already copied.
+ * The memory is given by the user, there is no dynamic allocation
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef EEPROMJOURNAL_H_INC
+#define EEPROMJOURNAL_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "EEPROM.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define EEPROMJOURNAL_HEADER_SIZE  ( 12u ) //!< Size of the header at the start of the commit page
+
+#define EEPROMJOURNAL_MAX_PAGES(journalSize,pageSize)  ( ((journalSize) / (pageSize) - 1u) < (((pageSize) - EEPROMJOURNAL_HEADER_SIZE) / 4u) ? ((journalSize) / (pageSize) - 1u) : (((pageSize) - EEPROMJOURNAL_HEADER_SIZE) / 4u) ) //!< Maximum count of data pages of a transaction with a journal of journalSize bytes
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM journal objects
+//********************************************************************************************************************
+
+//! EEPROM journal object structure
+typedef struct EEPROMJournal
+{
+  EEPROM *pEeprom;                  //!< EEPROM device of the data, this parameter is mandatory. Its Conf->OffsetAddress reserves the journal area before the data and shall be at the start of a page
+  EEPROM *pJournal;                 //!< EEPROM object of the journal area on the same device, this parameter is mandatory. Its Conf->OffsetAddress + Conf->TotalByteSize shall not be over the OffsetAddress of the data, and its Conf->PageSize shall be the same. Init_EEPROMJournal() sets its pSharedCurrentAddress to the address counter of pEeprom if NULL
+  uint8_t* Buffer;                  //!< Page buffer of Conf->PageSize bytes, this parameter is mandatory
+  uint32_t* Pages;                  //!< Array of PagesSize addresses of the data pages of the transaction, this parameter is mandatory
+  uint16_t PagesSize;               //!< Count of addresses of the Pages array. A transaction can touch up to EEPROMJOURNAL_MAX_PAGES(journal TotalByteSize, PageSize) pages with a big enough array
+
+  //--- Journal state ---
+  uint32_t Sequence;                //!< Sequence of the last commit
+  uint16_t PageCount;               //!< Count of data pages touched by the current transaction
+  uint16_t MaxPages;                //!< Maximum count of data pages of a transaction
+  bool InTransaction;               //!< 'true' if a transaction is in progress
+  bool Recovered;                   //!< 'true' if the last mount copied again a committed transaction to the data
+  bool Pending;                     //!< 'true' if a committed transaction is not copied to the data yet (error while copying it), EEPROMJournal_Begin() copies it first
+} EEPROMJournal;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM journal API
+//********************************************************************************************************************
+
+/*! @brief EEPROM journal initialization and mount
+ *
+ * This function checks the configuration and finishes the copy of a committed transaction interrupted by a power loss. In the common case, it is 1 read of the commit page header. The EEPROM objects shall be initialized before with Init_EEPROM()
+ * @param[in] *pJournal Is the pointed structure of the journal to be initialized
+ * @return Returns ERR__OUT_OF_MEMORY if a committed transaction touches more pages than the journal or the Pages array can hold, else an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_EEPROMJournal(EEPROMJournal *pJournal);
+
+/*! @brief Begin a transaction of the EEPROM journal
+ *
+ * If the copy of the last committed transaction to the data failed, it is copied again first
+ * @param[in] *pJournal Is the pointed structure of the journal to be used
+ * @return Returns ERR__NOT_READY if a transaction is already in progress, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMJournal_Begin(EEPROMJournal *pJournal);
+
+/*! @brief Write data in the transaction of the EEPROM journal
+ *
+ * The data is written to the shadow pages of the data pages, the data pages are not touched before the commit. The first write to a data page not fully covered reads it
+ * @param[in] *pJournal Is the pointed structure of the journal to be used
+ * @param[in] address Is the address of the data in the data EEPROM
+ * @param[in] *data Is the data array to store
+ * @param[in] size Is the size of the data
+ * @return Returns ERR__OUT_OF_MEMORY if the transaction touches more than MaxPages pages, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMJournal_Write(EEPROMJournal *pJournal, uint32_t address, const uint8_t* data, size_t size);
+
+/*! @brief Commit the transaction of the EEPROM journal
+ *
+ * The commit page is written (the transaction is durable from there), then the shadow pages are copied to the data pages and the commit page is marked as applied
+ * The function does not wait the end of the write cycle. Use EEPROM_WaitEndOfWrite() to wait it
+ * @param[in] *pJournal Is the pointed structure of the journal to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMJournal_Commit(EEPROMJournal *pJournal);
+
+/*! @brief Abort the transaction of the EEPROM journal
+ *
+ * The shadow pages are dropped, the data is not touched
+ * @param[in] *pJournal Is the pointed structure of the journal to be used
+ */
+void EEPROMJournal_Abort(EEPROMJournal *pJournal);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* EEPROMJOURNAL_H_INC */
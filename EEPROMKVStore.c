@@ -0,0 +1,514 @@
+/*!*****************************************************************************
+ * @file    EEPROMKVStore.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Log-structured key-value store for I2C EEPROM
+ * @details Append-only key-value store over the generic EEPROM driver with a
+ * RAM hash index and a compaction in the background
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <string.h>
+#include "EEPROMKVStore.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__EEPROMKVSTORE // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define EEPROMKVSTORE_RECORD_MAGIC  ( 0x4Bu )   // Magic of a record ('K')
+#define EEPROMKVSTORE_REGION_MAGIC  ( 0x564Bu ) // Magic of a region ("KV" in little endian)
+
+//! Flags of a record
+typedef enum
+{
+  EEPROMKVSTORE_VALUE  = 0x01, //!< The record is a value of the key
+  EEPROMKVSTORE_DELETE = 0x02, //!< The record is a delete of the key
+  EEPROMKVSTORE_COMMIT = 0x04, //!< The record is the commit of a compaction, the other region is dropped
+} eEEPROMKVStore_Flags;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// Get the index entry of a key (DO NOT USE DIRECTLY)
+static EEPROMKVStore_IndexEntry* __EEPROMKVStore_FindEntry(EEPROMKVStore *pKV, uint16_t key, bool insert);
+// Read the header of a region (DO NOT USE DIRECTLY, use Init_EEPROMKVStore() instead)
+static eERRORRESULT __EEPROMKVStore_ReadRegionHeader(EEPROMKVStore *pKV, uint8_t region, uint32_t* pGeneration, bool* pValid);
+// Write the header of the active region (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMKVStore_WriteRegionHeader(EEPROMKVStore *pKV);
+// Read and check a record (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMKVStore_ReadRecord(EEPROMKVStore *pKV, uint32_t address, uint16_t generation, uint16_t pagesLeft, uint8_t* pFlags, uint16_t* pKey, uint16_t* pSize, bool* pValid);
+// Replay the log of a region in the index (DO NOT USE DIRECTLY, use Init_EEPROMKVStore() instead)
+static eERRORRESULT __EEPROMKVStore_Replay(EEPROMKVStore *pKV, uint8_t region, uint32_t generation, bool* pCommitted, uint16_t* pEndPage);
+// Append a record to the log of the active region (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMKVStore_Append(EEPROMKVStore *pKV, uint8_t flags, uint16_t key, const uint8_t* data, uint16_t size, uint32_t* pAddress);
+// Get the count of pages of the live records of a region (DO NOT USE DIRECTLY)
+static uint32_t __EEPROMKVStore_LivePages(EEPROMKVStore *pKV, uint8_t region);
+// Make room in the active region for a record (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMKVStore_MakeRoom(EEPROMKVStore *pKV, uint16_t pages);
+// Start a compaction (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMKVStore_StartCompaction(EEPROMKVStore *pKV);
+// Copy 1 live record of the compaction, or commit the compaction (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMKVStore_CompactStep(EEPROMKVStore *pKV);
+//-----------------------------------------------------------------------------
+#define EEPROMKVSTORE_PAGE_SIZE(pKV)                ( (uint32_t)(pKV)->pEeprom->Conf->PageSize )
+#define EEPROMKVSTORE_PAGE_ADDRESS(pKV,region,page)  ( (pKV)->StartAddress + ((uint32_t)(region) * (pKV)->RegionPages + (page)) * EEPROMKVSTORE_PAGE_SIZE(pKV) )
+#define EEPROMKVSTORE_RECORD_PAGES(pKV,size)         ( (uint16_t)((EEPROMKVSTORE_RECORD_HEADER_SIZE + (size) + EEPROMKVSTORE_PAGE_SIZE(pKV) - 1u) / EEPROMKVSTORE_PAGE_SIZE(pKV)) )
+#define EEPROMKVSTORE_IS_IN_REGION(pKV,address,region)  ( ((address) >= EEPROMKVSTORE_PAGE_ADDRESS(pKV, region, 0)) && ((address) < EEPROMKVSTORE_PAGE_ADDRESS(pKV, region, (pKV)->RegionPages)) )
+#define EEPROMKVSTORE_GET16(pData)                   ( (uint16_t)((uint16_t)(pData)[0] | ((uint16_t)(pData)[1] << 8)) )
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// EEPROM key-value store initialization and mount
+//=============================================================================
+eERRORRESULT Init_EEPROMKVStore(EEPROMKVStore *pKV)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pKV == NULL) || (pKV->pEeprom == NULL) || (pKV->Index == NULL) || (pKV->Buffer == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pKV->pEeprom->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pConf = pKV->pEeprom->Conf;
+  uint32_t Generation[2];
+  bool Valid[2], Committed;
+  eERRORRESULT Error;
+
+  //--- Check the configuration ---
+  if ((pConf->PageSize < 16u) || (pKV->RegionPages < 2u)) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pKV->IndexSize == 0) || (pKV->IndexSize > 65536u) || ((pKV->IndexSize & (pKV->IndexSize - 1u)) != 0)) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pKV->StartAddress & (pConf->PageSize - 1u)) != 0) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pKV->StartAddress + EEPROMKVSTORE_AREA_SIZE(pKV->RegionPages, pConf->PageSize)) > pConf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  pKV->Compacting  = false;
+  pKV->PageWrites  = 0;
+  pKV->Compactions = 0;
+  for (size_t z = 0; z < pKV->IndexSize; ++z) pKV->Index[z].Key = EEPROMKVSTORE_NO_KEY;
+
+  //--- Get the active region ---
+  for (uint8_t zRegion = 0; zRegion < 2; ++zRegion)
+  {
+    Error = __EEPROMKVStore_ReadRegionHeader(pKV, zRegion, &Generation[zRegion], &Valid[zRegion]);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMKVStore_ReadRegionHeader() then return the error
+  }
+  if ((Valid[0] == false) && (Valid[1] == false))                                            // No store, format it
+  {
+    pKV->ActiveRegion = 0;
+    pKV->Generation   = 1;
+    pKV->NextPage     = 1;
+    return __EEPROMKVStore_WriteRegionHeader(pKV);
+  }
+  if (Valid[0] && Valid[1]) pKV->ActiveRegion = ((int32_t)(Generation[1] - Generation[0]) > 0 ? 1 : 0); // The newest region is the active one
+  else pKV->ActiveRegion = (Valid[1] ? 1 : 0);
+  pKV->Generation = Generation[pKV->ActiveRegion];
+  const uint8_t OldRegion = pKV->ActiveRegion ^ 1u;
+
+  //--- Replay the logs ---
+  Error = __EEPROMKVStore_Replay(pKV, pKV->ActiveRegion, pKV->Generation, &Committed, &pKV->NextPage);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMKVStore_Replay() then return the error
+  if ((Committed == false) && Valid[OldRegion])                                              // The compaction was not committed, the old region is replayed first
+  {
+    for (size_t z = 0; z < pKV->IndexSize; ++z) pKV->Index[z].Key = EEPROMKVSTORE_NO_KEY;
+    Error = __EEPROMKVStore_Replay(pKV, OldRegion, Generation[OldRegion], &Committed, NULL);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMKVStore_Replay() then return the error
+    Error = __EEPROMKVStore_Replay(pKV, pKV->ActiveRegion, pKV->Generation, &Committed, &pKV->NextPage);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMKVStore_Replay() then return the error
+    pKV->Compacting = true;                                                                  // Resume the compaction
+  }
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Get the index entry of a key
+//=============================================================================
+EEPROMKVStore_IndexEntry* __EEPROMKVStore_FindEntry(EEPROMKVStore *pKV, uint16_t key, bool insert)
+{
+  const size_t Mask = pKV->IndexSize - 1u;
+  const uint16_t Hash = (uint16_t)((uint32_t)key * 40503u);                                  // Fibonacci hashing of the key...
+  size_t Slot = (size_t)(((uint32_t)Hash * (uint32_t)pKV->IndexSize) >> 16);                 // ...the slot is the high bits of the hash, they mix all the bits of the key
+  for (size_t z = 0; z < pKV->IndexSize; ++z, Slot = (Slot + 1u) & Mask)                     // Linear probing, the keys are never removed from the index
+  {
+    EEPROMKVStore_IndexEntry* const pEntry = &pKV->Index[Slot];
+    if (pEntry->Key == key) return pEntry;
+    if (pEntry->Key != EEPROMKVSTORE_NO_KEY) continue;
+    if (insert == false) return NULL;
+    pEntry->Key     = key;
+    pEntry->Address = EEPROMKVSTORE_NO_ADDRESS;
+    pEntry->Size    = 0;
+    return pEntry;
+  }
+  return NULL;                                                                               // The index is full
+}
+
+
+//=============================================================================
+// [STATIC] Read the header of a region
+//=============================================================================
+eERRORRESULT __EEPROMKVStore_ReadRegionHeader(EEPROMKVStore *pKV, uint8_t region, uint32_t* pGeneration, bool* pValid)
+{
+  uint8_t* const pBuf = pKV->Buffer;
+  uint16_t CRC = 0xFFFF;
+  eERRORRESULT Error;
+
+  Error = EEPROM_ReadData(pKV->pEeprom, EEPROMKVSTORE_PAGE_ADDRESS(pKV, region, 0), pBuf, EEPROMKVSTORE_REGION_HEADER_SIZE);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_ReadData() then return the error
+  EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, EEPROMKVSTORE_REGION_HEADER_SIZE - 2u);
+  *pGeneration = (uint32_t)pBuf[2] | ((uint32_t)pBuf[3] << 8) | ((uint32_t)pBuf[4] << 16) | ((uint32_t)pBuf[5] << 24);
+  *pValid      = (EEPROMKVSTORE_GET16(&pBuf[0]) == EEPROMKVSTORE_REGION_MAGIC) && (EEPROMKVSTORE_GET16(&pBuf[6]) == CRC);
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Write the header of the active region
+//=============================================================================
+eERRORRESULT __EEPROMKVStore_WriteRegionHeader(EEPROMKVStore *pKV)
+{
+  uint8_t* const pBuf = pKV->Buffer;
+  uint16_t CRC = 0xFFFF;
+  eERRORRESULT Error;
+
+  pBuf[0] = (uint8_t)EEPROMKVSTORE_REGION_MAGIC; pBuf[1] = (uint8_t)(EEPROMKVSTORE_REGION_MAGIC >> 8);
+  pBuf[2] = (uint8_t)pKV->Generation; pBuf[3] = (uint8_t)(pKV->Generation >> 8); pBuf[4] = (uint8_t)(pKV->Generation >> 16); pBuf[5] = (uint8_t)(pKV->Generation >> 24);
+  EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, EEPROMKVSTORE_REGION_HEADER_SIZE - 2u);
+  pBuf[6] = (uint8_t)CRC; pBuf[7] = (uint8_t)(CRC >> 8);
+  Error = EEPROM_WriteData(pKV->pEeprom, EEPROMKVSTORE_PAGE_ADDRESS(pKV, pKV->ActiveRegion, 0), pBuf, EEPROMKVSTORE_REGION_HEADER_SIZE);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_WriteData() then return the error
+  pKV->PageWrites++;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Read and check a record
+//=============================================================================
+eERRORRESULT __EEPROMKVStore_ReadRecord(EEPROMKVStore *pKV, uint32_t address, uint16_t generation, uint16_t pagesLeft, uint8_t* pFlags, uint16_t* pKey, uint16_t* pSize, bool* pValid)
+{
+  const uint32_t PageSize = EEPROMKVSTORE_PAGE_SIZE(pKV);
+  uint8_t* const pBuf = pKV->Buffer;
+  uint16_t CRC = 0xFFFF, RecordCRC;
+  eERRORRESULT Error;
+  *pValid = false;
+
+  //--- Check the header ---
+  Error = EEPROM_ReadData(pKV->pEeprom, address, pBuf, EEPROMKVSTORE_RECORD_HEADER_SIZE);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_ReadData() then return the error
+  if ((pBuf[0] != EEPROMKVSTORE_RECORD_MAGIC) || (EEPROMKVSTORE_GET16(&pBuf[6]) != generation)) return ERR_NONE; // Blank page, old record of the region, or garbage: end of the log
+  *pFlags = pBuf[1];
+  *pKey   = EEPROMKVSTORE_GET16(&pBuf[2]);
+  *pSize  = EEPROMKVSTORE_GET16(&pBuf[4]);
+  RecordCRC = EEPROMKVSTORE_GET16(&pBuf[8]);
+  if (EEPROMKVSTORE_RECORD_PAGES(pKV, *pSize) > pagesLeft) return ERR_NONE;                 // Does not fit in the region: garbage
+  EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, EEPROMKVSTORE_RECORD_HEADER_SIZE - 2u);
+
+  //--- Check the value ---
+  for (uint32_t Pos = 0; Pos < *pSize; Pos += PageSize)
+  {
+    const size_t ChunkSize = ((*pSize - Pos) < PageSize ? (*pSize - Pos) : PageSize);
+    Error = EEPROM_ReadData(pKV->pEeprom, address + EEPROMKVSTORE_RECORD_HEADER_SIZE + Pos, pBuf, ChunkSize);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_ReadData() then return the error
+    EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, ChunkSize);
+  }
+  *pValid = (CRC == RecordCRC);
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Replay the log of a region in the index
+//=============================================================================
+eERRORRESULT __EEPROMKVStore_Replay(EEPROMKVStore *pKV, uint8_t region, uint32_t generation, bool* pCommitted, uint16_t* pEndPage)
+{
+  uint16_t Page = 1, Key, Size;
+  uint8_t Flags;
+  bool Valid;
+  eERRORRESULT Error;
+  *pCommitted = false;
+
+  while (Page < pKV->RegionPages)
+  {
+    const uint32_t Address = EEPROMKVSTORE_PAGE_ADDRESS(pKV, region, Page);
+    Error = __EEPROMKVStore_ReadRecord(pKV, Address, (uint16_t)generation, pKV->RegionPages - Page, &Flags, &Key, &Size, &Valid);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMKVStore_ReadRecord() then return the error
+    if (Valid == false) break;                                                               // End of the log
+    if ((Flags & EEPROMKVSTORE_COMMIT) > 0) *pCommitted = true;
+    else
+    {
+      EEPROMKVStore_IndexEntry* const pEntry = __EEPROMKVStore_FindEntry(pKV, Key, true);
+      if (pEntry == NULL) return ERR_GENERATE(ERR__OUT_OF_MEMORY);                           // The index is too small for the keys of the store
+      pEntry->Address = ((Flags & EEPROMKVSTORE_DELETE) > 0 ? EEPROMKVSTORE_NO_ADDRESS : Address);
+      pEntry->Size    = ((Flags & EEPROMKVSTORE_DELETE) > 0 ? 0 : Size);
+    }
+    Page += EEPROMKVSTORE_RECORD_PAGES(pKV, Size);
+  }
+  if (pEndPage != NULL) *pEndPage = Page;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Append a record to the log of the active region
+//=============================================================================
+eERRORRESULT __EEPROMKVStore_Append(EEPROMKVStore *pKV, uint8_t flags, uint16_t key, const uint8_t* data, uint16_t size, uint32_t* pAddress)
+{
+  const uint32_t PageSize = EEPROMKVSTORE_PAGE_SIZE(pKV);
+  const uint16_t Pages = EEPROMKVSTORE_RECORD_PAGES(pKV, size);
+  if ((pKV->NextPage + Pages) > pKV->RegionPages) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+  const uint32_t Address = EEPROMKVSTORE_PAGE_ADDRESS(pKV, pKV->ActiveRegion, pKV->NextPage);
+  const size_t FirstChunk = ((size_t)size < (PageSize - EEPROMKVSTORE_RECORD_HEADER_SIZE) ? (size_t)size : (PageSize - EEPROMKVSTORE_RECORD_HEADER_SIZE));
+  uint8_t* const pBuf = pKV->Buffer;
+  uint16_t CRC = 0xFFFF;
+  eERRORRESULT Error;
+
+  //--- Fill the first page ---
+  pBuf[0] = EEPROMKVSTORE_RECORD_MAGIC;
+  pBuf[1] = flags;
+  pBuf[2] = (uint8_t)key;  pBuf[3] = (uint8_t)(key >> 8);
+  pBuf[4] = (uint8_t)size; pBuf[5] = (uint8_t)(size >> 8);
+  pBuf[6] = (uint8_t)pKV->Generation; pBuf[7] = (uint8_t)(pKV->Generation >> 8);
+  EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, EEPROMKVSTORE_RECORD_HEADER_SIZE - 2u);
+  if (size > 0) EEPROM_ComputeCRC16IBM3740(&CRC, data, size);
+  pBuf[8] = (uint8_t)CRC; pBuf[9] = (uint8_t)(CRC >> 8);
+  if (FirstChunk > 0) memcpy(&pBuf[EEPROMKVSTORE_RECORD_HEADER_SIZE], data, FirstChunk);
+
+  //--- Write the next pages, then the first page so the record is valid only when complete ---
+  if (size > FirstChunk)
+  {
+    Error = EEPROM_WriteData(pKV->pEeprom, Address + PageSize, &data[FirstChunk], size - FirstChunk);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_WriteData() then return the error
+  }
+  Error = EEPROM_WriteData(pKV->pEeprom, Address, pBuf, EEPROMKVSTORE_RECORD_HEADER_SIZE + FirstChunk); // 1 page write for a value that fits in a page
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_WriteData() then return the error
+  pKV->NextPage   += Pages;
+  pKV->PageWrites += Pages;
+  if (pAddress != NULL) *pAddress = Address;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Get the count of pages of the live records of a region
+//=============================================================================
+uint32_t __EEPROMKVStore_LivePages(EEPROMKVStore *pKV, uint8_t region)
+{
+  uint32_t Pages = 0;
+  for (size_t z = 0; z < pKV->IndexSize; ++z)
+    if ((pKV->Index[z].Key != EEPROMKVSTORE_NO_KEY) && (pKV->Index[z].Address != EEPROMKVSTORE_NO_ADDRESS) && EEPROMKVSTORE_IS_IN_REGION(pKV, pKV->Index[z].Address, region))
+      Pages += EEPROMKVSTORE_RECORD_PAGES(pKV, pKV->Index[z].Size);
+  return Pages;
+}
+
+
+//=============================================================================
+// [STATIC] Make room in the active region for a record
+//=============================================================================
+eERRORRESULT __EEPROMKVStore_MakeRoom(EEPROMKVStore *pKV, uint16_t pages)
+{
+  eERRORRESULT Error;
+  if (pKV->Compacting)                                                                       // The records not copied yet and the commit record shall still fit after this record
+  {
+    if ((pKV->NextPage + pages + __EEPROMKVStore_LivePages(pKV, pKV->ActiveRegion ^ 1u) + 1u) <= pKV->RegionPages) return ERR_NONE;
+    while (pKV->Compacting)                                                                  // Finish the compaction now
+    {
+      Error = __EEPROMKVStore_CompactStep(pKV);
+      if (Error != ERR_NONE) return Error;                                                   // If there is an error while calling __EEPROMKVStore_CompactStep() then return the error
+    }
+  }
+  if ((pKV->NextPage + pages) <= pKV->RegionPages) return ERR_NONE;
+  Error = __EEPROMKVStore_StartCompaction(pKV);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMKVStore_StartCompaction() then return the error
+  while (pKV->Compacting)                                                                    // Finish the compaction now
+  {
+    Error = __EEPROMKVStore_CompactStep(pKV);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMKVStore_CompactStep() then return the error
+  }
+  if ((pKV->NextPage + pages) > pKV->RegionPages) return ERR_GENERATE(ERR__OUT_OF_MEMORY);  // The store is full
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Start a compaction
+//=============================================================================
+eERRORRESULT __EEPROMKVStore_StartCompaction(EEPROMKVStore *pKV)
+{
+  if ((1u + __EEPROMKVStore_LivePages(pKV, pKV->ActiveRegion) + 1u) > pKV->RegionPages) return ERR_GENERATE(ERR__OUT_OF_MEMORY); // The live records and the commit record shall fit in the other region
+  pKV->ActiveRegion ^= 1u;                                                                   // The records are appended to the other region from now on
+  pKV->Generation++;
+  pKV->NextPage   = 1;
+  pKV->Compacting = true;
+  return __EEPROMKVStore_WriteRegionHeader(pKV);
+}
+
+
+//=============================================================================
+// [STATIC] Copy 1 live record of the compaction, or commit the compaction
+//=============================================================================
+eERRORRESULT __EEPROMKVStore_CompactStep(EEPROMKVStore *pKV)
+{
+  const uint32_t PageSize = EEPROMKVSTORE_PAGE_SIZE(pKV);
+  const uint8_t OldRegion = pKV->ActiveRegion ^ 1u;
+  uint8_t* const pBuf = pKV->Buffer;
+  eERRORRESULT Error;
+
+  //--- Get a live record of the old region ---
+  EEPROMKVStore_IndexEntry* pEntry = NULL;
+  for (size_t z = 0; z < pKV->IndexSize; ++z)
+    if ((pKV->Index[z].Key != EEPROMKVSTORE_NO_KEY) && (pKV->Index[z].Address != EEPROMKVSTORE_NO_ADDRESS) && EEPROMKVSTORE_IS_IN_REGION(pKV, pKV->Index[z].Address, OldRegion))
+    {
+      pEntry = &pKV->Index[z];
+      break;
+    }
+  if (pEntry == NULL)                                                                        // All the live records are copied, commit the compaction
+  {
+    Error = __EEPROMKVStore_Append(pKV, EEPROMKVSTORE_COMMIT, EEPROMKVSTORE_NO_KEY, NULL, 0, NULL);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMKVStore_Append() then return the error
+    pKV->Compacting = false;
+    pKV->Compactions++;
+    return ERR_NONE;
+  }
+
+  //--- Copy the record ---
+  const uint16_t Pages = EEPROMKVSTORE_RECORD_PAGES(pKV, pEntry->Size);
+  if ((pKV->NextPage + Pages) > pKV->RegionPages) return ERR_GENERATE(ERR__OUT_OF_MEMORY);  // The live records do not fit in a region
+  const uint32_t Address = EEPROMKVSTORE_PAGE_ADDRESS(pKV, pKV->ActiveRegion, pKV->NextPage);
+  const uint32_t RecordSize = EEPROMKVSTORE_RECORD_HEADER_SIZE + pEntry->Size;
+  const uint32_t FirstSize = (RecordSize < PageSize ? RecordSize : PageSize);
+  uint16_t CRC = 0xFFFF;
+  Error = EEPROM_ReadData(pKV->pEeprom, pEntry->Address, pBuf, FirstSize);                   // Get the header and the first part of the value to compute the CRC with the new generation
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_ReadData() then return the error
+  pBuf[6] = (uint8_t)pKV->Generation; pBuf[7] = (uint8_t)(pKV->Generation >> 8);
+  EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, EEPROMKVSTORE_RECORD_HEADER_SIZE - 2u);
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pBuf[EEPROMKVSTORE_RECORD_HEADER_SIZE], FirstSize - EEPROMKVSTORE_RECORD_HEADER_SIZE);
+  for (uint32_t Pos = PageSize; Pos < RecordSize; Pos += PageSize)                           // Copy the next pages
+  {
+    const size_t ChunkSize = ((RecordSize - Pos) < PageSize ? (RecordSize - Pos) : PageSize);
+    Error = EEPROM_ReadData(pKV->pEeprom, pEntry->Address + Pos, pBuf, ChunkSize);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_ReadData() then return the error
+    EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, ChunkSize);
+    Error = EEPROM_WriteData(pKV->pEeprom, Address + Pos, pBuf, ChunkSize);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_WriteData() then return the error
+  }
+  if (RecordSize > PageSize)                                                                 // The first page was overwritten in the buffer, get it again
+  {
+    Error = EEPROM_ReadData(pKV->pEeprom, pEntry->Address, pBuf, FirstSize);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROM_ReadData() then return the error
+    pBuf[6] = (uint8_t)pKV->Generation; pBuf[7] = (uint8_t)(pKV->Generation >> 8);
+  }
+  pBuf[8] = (uint8_t)CRC; pBuf[9] = (uint8_t)(CRC >> 8);
+  Error = EEPROM_WriteData(pKV->pEeprom, Address, pBuf, FirstSize);                          // The first page last, so the record is valid only when complete
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_WriteData() then return the error
+  pEntry->Address  = Address;
+  pKV->NextPage   += Pages;
+  pKV->PageWrites += Pages;
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Get the value of a key from the EEPROM key-value store
+//=============================================================================
+eERRORRESULT EEPROMKVStore_Get(EEPROMKVStore *pKV, uint16_t key, uint8_t* data, size_t maxSize, size_t* pSize)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pKV == NULL) || (pKV->pEeprom == NULL) || (pKV->Index == NULL) || ((data == NULL) && (maxSize > 0))) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROMKVStore_IndexEntry* const pEntry = __EEPROMKVStore_FindEntry(pKV, key, false);
+  if ((pEntry == NULL) || (pEntry->Address == EEPROMKVSTORE_NO_ADDRESS)) return ERR_GENERATE(ERR__NO_DATA_AVAILABLE);
+  if (pSize != NULL) *pSize = pEntry->Size;
+  const size_t Size = (pEntry->Size < maxSize ? pEntry->Size : maxSize);
+  if (Size == 0) return ERR_NONE;
+  return EEPROM_ReadData(pKV->pEeprom, pEntry->Address + EEPROMKVSTORE_RECORD_HEADER_SIZE, data, Size);
+}
+
+
+//=============================================================================
+// Set the value of a key in the EEPROM key-value store
+//=============================================================================
+eERRORRESULT EEPROMKVStore_Set(EEPROMKVStore *pKV, uint16_t key, const uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pKV == NULL) || (pKV->pEeprom == NULL) || (pKV->Index == NULL) || ((data == NULL) && (size > 0))) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if ((key == EEPROMKVSTORE_NO_KEY) || (size > UINT16_MAX)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  const uint16_t Pages = EEPROMKVSTORE_RECORD_PAGES(pKV, size);
+  if (Pages >= pKV->RegionPages) return ERR_GENERATE(ERR__OUT_OF_MEMORY);                    // Never fits in a region
+  EEPROMKVStore_IndexEntry* const pEntry = __EEPROMKVStore_FindEntry(pKV, key, true);
+  if (pEntry == NULL) return ERR_GENERATE(ERR__OUT_OF_MEMORY);                               // The index is full
+  uint32_t Address;
+  eERRORRESULT Error;
+
+  Error = __EEPROMKVStore_MakeRoom(pKV, Pages);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMKVStore_MakeRoom() then return the error
+  Error = __EEPROMKVStore_Append(pKV, EEPROMKVSTORE_VALUE, key, data, (uint16_t)size, &Address);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMKVStore_Append() then return the error
+  pEntry->Address = Address;
+  pEntry->Size    = (uint16_t)size;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Delete a key of the EEPROM key-value store
+//=============================================================================
+eERRORRESULT EEPROMKVStore_Delete(EEPROMKVStore *pKV, uint16_t key)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pKV == NULL) || (pKV->pEeprom == NULL) || (pKV->Index == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  EEPROMKVStore_IndexEntry* const pEntry = __EEPROMKVStore_FindEntry(pKV, key, false);
+  if ((pEntry == NULL) || (pEntry->Address == EEPROMKVSTORE_NO_ADDRESS)) return ERR_GENERATE(ERR__NO_DATA_AVAILABLE);
+  eERRORRESULT Error;
+
+  Error = __EEPROMKVStore_MakeRoom(pKV, 1);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMKVStore_MakeRoom() then return the error
+  Error = __EEPROMKVStore_Append(pKV, EEPROMKVSTORE_DELETE, key, NULL, 0, NULL);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMKVStore_Append() then return the error
+  pEntry->Address = EEPROMKVSTORE_NO_ADDRESS;
+  pEntry->Size    = 0;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// EEPROM key-value store task
+//=============================================================================
+eERRORRESULT EEPROMKVStore_Task(EEPROMKVStore *pKV)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pKV == NULL) || (pKV->pEeprom == NULL) || (pKV->Index == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pKV->Compacting) return __EEPROMKVStore_CompactStep(pKV);                              // Copy 1 live record per call
+  if ((pKV->RegionPages - pKV->NextPage) < pKV->CompactThreshold) return __EEPROMKVStore_StartCompaction(pKV);
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
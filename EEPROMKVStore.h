@@ -0,0 +1,176 @@
+/*!*****************************************************************************
+ * @file    EEPROMKVStore.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Log-structured key-value store for I2C EEPROM
+ * @details Append-only key-value store over the generic EEPROM driver. A set
+ * of a value appends a record at the next page of the log instead of a
+ * read-modify-write of the old value, so a value that fits in a page with its
+ * header is 1 page write. The records start at a page boundary:
+ * - Magic (1 byte) 'K'
+ * - Flags (1 byte): value, delete, or commit of a compaction
+ * - Key (2 bytes, little endian)
+ * - Size (2 bytes, little endian) of the value
+ * - Generation (2 bytes, little endian): lower 16 bits of the generation of the region
+ * - CRC16-IBM3740 (2 bytes, little endian) of the header and the value
+ * The area is split in 2 regions of RegionPages pages. The first page of a
+ * region has its header (magic "KV", generation, CRC16). The log is appended
+ * to the active region. When it is nearly full, EEPROMKVStore_Task() copies
+ * one live record per call to the other region (compaction in the
+ * background), the new records are appended to the other region meanwhile.
+ * At the end, a commit record is appended and the old region is dropped.
+ * The mount replays the log of the active region (and of the old region first
+ * if the compaction was not committed) in a RAM hash index of the keys.
+ * A record with a bad CRC (write interrupted by a power loss) ends the log.
+ * The memory is given by the user, there is no dynamic allocation
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef EEPROMKVSTORE_H_INC
+#define EEPROMKVSTORE_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "EEPROM.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define EEPROMKVSTORE_RECORD_HEADER_SIZE  ( 10u )         //!< Size of the header at the start of each record
+#define EEPROMKVSTORE_REGION_HEADER_SIZE  ( 8u )          //!< Size of the header at the start of each region
+#define EEPROMKVSTORE_NO_KEY              ( 0xFFFFu )     //!< Key of an empty slot of the index, this key cannot be used
+#define EEPROMKVSTORE_NO_ADDRESS          ( UINT32_MAX )  //!< Address of a deleted key in the index
+
+#define EEPROMKVSTORE_AREA_SIZE(regionPages,pageSize)  ( 2u * (regionPages) * (pageSize) ) //!< Size in bytes of the EEPROM area used by a store of regions of regionPages pages
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM key-value store objects
+//********************************************************************************************************************
+
+//! EEPROM key-value store index entry structure
+typedef struct EEPROMKVStore_IndexEntry
+{
+  uint32_t Address;        //!< Address of the record of the newest value of the key, EEPROMKVSTORE_NO_ADDRESS if the key is deleted
+  uint16_t Key;            //!< Key of the entry, EEPROMKVSTORE_NO_KEY if the slot is empty
+  uint16_t Size;           //!< Size of the value of the key
+} EEPROMKVStore_IndexEntry;
+
+
+//! EEPROM key-value store object structure
+typedef struct EEPROMKVStore
+{
+  EEPROM *pEeprom;                  //!< EEPROM device of the store, this parameter is mandatory. Its Conf->PageSize shall be at least 16 bytes
+  EEPROMKVStore_IndexEntry* Index;  //!< Hash index of IndexSize entries, this parameter is mandatory
+  size_t IndexSize;                 //!< Count of entries of the index, shall be a power of 2 greater than the count of keys, at most 65536
+  uint8_t* Buffer;                  //!< Page buffer of Conf->PageSize bytes, this parameter is mandatory
+  uint32_t StartAddress;            //!< Address of the first page of the area, shall be at the start of a page. The area is EEPROMKVSTORE_AREA_SIZE(RegionPages, Conf->PageSize) bytes
+  uint16_t RegionPages;             //!< Count of pages of each of the 2 regions, at least 2. The live records shall fit in RegionPages - 2 pages, else the compaction returns ERR__OUT_OF_MEMORY
+  uint16_t CompactThreshold;        //!< Count of free pages of the active region under which EEPROMKVStore_Task() starts a compaction. Set 0 to compact only when a set does not fit
+
+  //--- Store state ---
+  uint8_t ActiveRegion;             //!< Region where the records are appended
+  uint32_t Generation;              //!< Generation of the active region, incremented at each compaction
+  uint16_t NextPage;                //!< Page of the active region where the next record will be appended
+  bool Compacting;                  //!< 'true' if the live records of the other region are being copied to the active region
+  uint32_t PageWrites;              //!< Count of pages written to the EEPROM by the store
+  uint32_t Compactions;             //!< Count of compactions committed since the initialization
+} EEPROMKVStore;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM key-value store API
+//********************************************************************************************************************
+
+/*! @brief EEPROM key-value store initialization and mount
+ *
+ * This function checks the configuration and rebuilds the index from the log. If no region is valid, the store is formatted (empty). The EEPROM device shall be initialized before with Init_EEPROM()
+ * @param[in] *pKV Is the pointed structure of the store to be initialized
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_EEPROMKVStore(EEPROMKVStore *pKV);
+
+/*! @brief Get the value of a key from the EEPROM key-value store
+ *
+ * @param[in] *pKV Is the pointed structure of the store to be used
+ * @param[in] key Is the key to get
+ * @param[out] *data Is where the value will be stored
+ * @param[in] maxSize Is the size of the data array. If the value is bigger, only maxSize bytes are read
+ * @param[out] *pSize Is where the size of the value will be stored. Can be NULL
+ * @return Returns ERR__NO_DATA_AVAILABLE if the key does not exist, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMKVStore_Get(EEPROMKVStore *pKV, uint16_t key, uint8_t* data, size_t maxSize, size_t* pSize);
+
+/*! @brief Set the value of a key in the EEPROM key-value store
+ *
+ * The value is appended to the log. If it does not fit in the active region, the compaction is done before
+ * The function does not wait the end of the write cycle. Use EEPROM_WaitEndOfWrite() to wait it
+ * @param[in] *pKV Is the pointed structure of the store to be used
+ * @param[in] key Is the key to set, any value except EEPROMKVSTORE_NO_KEY
+ * @param[in] *data Is the value to store
+ * @param[in] size Is the size of the value
+ * @return Returns ERR__OUT_OF_MEMORY if the store is full, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMKVStore_Set(EEPROMKVStore *pKV, uint16_t key, const uint8_t* data, size_t size);
+
+/*! @brief Delete a key of the EEPROM key-value store
+ *
+ * A delete record is appended to the log
+ * @param[in] *pKV Is the pointed structure of the store to be used
+ * @param[in] key Is the key to delete
+ * @return Returns ERR__NO_DATA_AVAILABLE if the key does not exist, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMKVStore_Delete(EEPROMKVStore *pKV, uint16_t key);
+
+/*! @brief EEPROM key-value store task
+ *
+ * Call this function periodically to compact the store in the background. It starts a compaction when the active region has less than CompactThreshold free pages, then copies 1 live record per call
+ * @param[in] *pKV Is the pointed structure of the store to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMKVStore_Task(EEPROMKVStore *pKV);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* EEPROMKVSTORE_H_INC */
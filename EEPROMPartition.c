@@ -0,0 +1,297 @@
+/*!*****************************************************************************
+ * @file    EEPROMPartition.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Partition manager for I2C EEPROM
+ * @details Runtime partition table in the first page of the device, each
+ * partition is an EEPROM view with its own cache and wear policies
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "EEPROMPartition.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__EEPROMPARTITION // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define EEPROMPARTITION_MAGIC  ( 0x5450u ) // Magic of the table page ("PT" in little endian)
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// Check an entry of the table (DO NOT USE DIRECTLY)
+static bool __EEPROMPartition_IsEntryValid(EEPROMPartitionTable *pTable, const EEPROMPartition_Entry* pEntry);
+// Check the table in the buffer and bind the partitions to its entries (DO NOT USE DIRECTLY, use Init_EEPROMPartition() instead)
+static eERRORRESULT __EEPROMPartition_MountTable(EEPROMPartitionTable *pTable);
+// Bind a partition to an entry of the table (DO NOT USE DIRECTLY, use Init_EEPROMPartition() instead)
+static eERRORRESULT __EEPROMPartition_MountPart(EEPROMPartitionTable *pTable, EEPROMPartition *pPart, const EEPROMPartition_Entry* pEntry);
+//-----------------------------------------------------------------------------
+#define EEPROMPARTITION_TABLE_SIZE(count)  ( EEPROMPARTITION_HEADER_SIZE + ((size_t)(count) * EEPROMPARTITION_ENTRY_SIZE) )
+#define EEPROMPARTITION_GET16(pData)       ( (uint16_t)((uint16_t)(pData)[0] | ((uint16_t)(pData)[1] << 8)) )
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// EEPROM partition table initialization and mount
+//=============================================================================
+eERRORRESULT Init_EEPROMPartition(EEPROMPartitionTable *pTable)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pTable == NULL) || (pTable->pEeprom == NULL) || (pTable->Buffer == NULL) || ((pTable->Parts == NULL) && (pTable->PartCount > 0))) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pTable->pEeprom->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pConf = pTable->pEeprom->Conf;
+  eERRORRESULT Error;
+
+  if (EEPROMPARTITION_MAX_ENTRIES(pConf->PageSize) == 0) return ERR_GENERATE(ERR__CONFIGURATION); // The page is too small for a table
+  for (size_t zPart = 0; zPart < pTable->PartCount; ++zPart) pTable->Parts[zPart].Mounted = false;
+  Error = EEPROM_ReadData(pTable->pEeprom, 0, pTable->Buffer, pConf->PageSize);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_ReadData() then return the error
+  return __EEPROMPartition_MountTable(pTable);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Check an entry of the table
+//=============================================================================
+bool __EEPROMPartition_IsEntryValid(EEPROMPartitionTable *pTable, const EEPROMPartition_Entry* pEntry)
+{
+  const EEPROM_Conf* const pConf = pTable->pEeprom->Conf;
+  const uint32_t DevicePages = pConf->TotalByteSize / pConf->PageSize;
+  if ((pEntry->FirstPage == 0) || (pEntry->PageCount == 0)) return false;                    // The page 0 has the table
+  if (((uint32_t)pEntry->FirstPage + pEntry->PageCount) > DevicePages) return false;
+  if (pEntry->Cache > EEPROMPARTITION_CACHE_WRITE_BACK) return false;
+  if (pEntry->Wear > EEPROMPARTITION_WEAR_LEVELING) return false;
+  if ((pEntry->Wear == EEPROMPARTITION_WEAR_LEVELING) && (pEntry->Cache != EEPROMPARTITION_CACHE_NONE)) return false; // The wear-leveling layer writes its pages itself
+  return true;
+}
+
+
+//=============================================================================
+// [STATIC] Check the table in the buffer and bind the partitions to its entries
+//=============================================================================
+eERRORRESULT __EEPROMPartition_MountTable(EEPROMPartitionTable *pTable)
+{
+  const uint8_t* const pBuf = pTable->Buffer;
+  const size_t Count = pBuf[2];
+  uint16_t CRC = 0xFFFF;
+  eERRORRESULT Error;
+
+  //--- Check the table ---
+  if (EEPROMPARTITION_GET16(&pBuf[0]) != EEPROMPARTITION_MAGIC) return ERR_GENERATE(ERR__NO_DATA_AVAILABLE);
+  if (Count > EEPROMPARTITION_MAX_ENTRIES(pTable->pEeprom->Conf->PageSize)) return ERR_GENERATE(ERR__NO_DATA_AVAILABLE);
+  EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, EEPROMPARTITION_TABLE_SIZE(Count));
+  if (EEPROMPARTITION_GET16(&pBuf[EEPROMPARTITION_TABLE_SIZE(Count)]) != CRC) return ERR_GENERATE(ERR__CRC_ERROR);
+
+  //--- Bind the partitions ---
+  for (size_t zEntry = 0; zEntry < Count; ++zEntry)
+  {
+    const uint8_t* const pData = &pBuf[EEPROMPARTITION_TABLE_SIZE(zEntry)];
+    const EEPROMPartition_Entry Entry =
+    {
+      .Id        = pData[0],
+      .Cache     = (eEEPROMPartition_CachePolicy)(pData[1] & 0x0F),
+      .Wear      = (eEEPROMPartition_WearPolicy)((pData[1] >> 4) & 0x0F),
+      .FirstPage = EEPROMPARTITION_GET16(&pData[2]),
+      .PageCount = EEPROMPARTITION_GET16(&pData[4]),
+    };
+    if (__EEPROMPartition_IsEntryValid(pTable, &Entry) == false) return ERR_GENERATE(ERR__CONFIGURATION);
+    for (size_t zPart = 0; zPart < pTable->PartCount; ++zPart)
+    {
+      if (pTable->Parts[zPart].Id != Entry.Id) continue;
+      Error = __EEPROMPartition_MountPart(pTable, &pTable->Parts[zPart], &Entry);
+      if (Error != ERR_NONE) return Error;                                                   // If there is an error while calling __EEPROMPartition_MountPart() then return the error
+    }
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Bind a partition to an entry of the table
+//=============================================================================
+eERRORRESULT __EEPROMPartition_MountPart(EEPROMPartitionTable *pTable, EEPROMPartition *pPart, const EEPROMPartition_Entry* pEntry)
+{
+  const EEPROM_Conf* const pConf = pTable->pEeprom->Conf;
+
+  //--- Set the view ---
+  pPart->Entry              = *pEntry;
+  pPart->Conf               = *pConf;
+  pPart->Conf.OffsetAddress = pConf->OffsetAddress + ((uint32_t)pEntry->FirstPage * pConf->PageSize);
+  pPart->Conf.TotalByteSize = (uint32_t)pEntry->PageCount * pConf->PageSize;
+  pPart->View               = *pTable->pEeprom;                                              // Same interface and options as the device
+  pPart->View.Conf          = &pPart->Conf;
+  if (pPart->View.pSharedCurrentAddress == NULL) pPart->View.pSharedCurrentAddress = &pTable->pEeprom->CurrentAddress; // The view and the device share the address counter of the device
+  pPart->View.Options      &= ~EEPROM_READ_COMPARE_WRITE;
+  if (pEntry->Wear == EEPROMPARTITION_WEAR_COMPARE) pPart->View.Options |= EEPROM_READ_COMPARE_WRITE;
+
+  //--- Set the cache ---
+  if (pEntry->Cache != EEPROMPARTITION_CACHE_NONE)
+  {
+    if ((pPart->Cache.Lines == NULL) || (pPart->Cache.Buffer == NULL) || (pPart->Cache.LineCount == 0)) return ERR_GENERATE(ERR__CONFIGURATION); // No memory for the cache of the partition
+    pPart->Cache.pEeprom      = &pPart->View;
+    pPart->Cache.WriteThrough = (pEntry->Cache == EEPROMPARTITION_CACHE_WRITE_THROUGH);
+    eERRORRESULT Error = Init_EEPROMCache(&pPart->Cache);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling Init_EEPROMCache() then return the error
+  }
+  pPart->Mounted = true;
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Write a new partition table to the EEPROM device and mount it
+//=============================================================================
+eERRORRESULT EEPROMPartition_Format(EEPROMPartitionTable *pTable, const EEPROMPartition_Entry* entries, size_t count)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pTable == NULL) || (pTable->pEeprom == NULL) || (pTable->Buffer == NULL) || ((entries == NULL) && (count > 0))) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (count > EEPROMPARTITION_MAX_ENTRIES(pTable->pEeprom->Conf->PageSize)) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  uint8_t* const pBuf = pTable->Buffer;
+  uint16_t CRC = 0xFFFF;
+  eERRORRESULT Error;
+
+  //--- Check the entries ---
+  for (size_t zEntry = 0; zEntry < count; ++zEntry)
+  {
+    const EEPROMPartition_Entry* const pEntry = &entries[zEntry];
+    if (__EEPROMPartition_IsEntryValid(pTable, pEntry) == false) return ERR_GENERATE(ERR__CONFIGURATION);
+    for (size_t zOther = 0; zOther < zEntry; ++zOther)
+    {
+      const EEPROMPartition_Entry* const pOther = &entries[zOther];
+      if (pOther->Id == pEntry->Id) return ERR_GENERATE(ERR__CONFIGURATION);                // The Id shall be unique
+      if ((pEntry->FirstPage < (pOther->FirstPage + pOther->PageCount)) && (pOther->FirstPage < (pEntry->FirstPage + pEntry->PageCount))) return ERR_GENERATE(ERR__CONFIGURATION); // The partitions shall not overlap
+    }
+  }
+
+  //--- Flush the caches of the current table ---
+  Error = EEPROMPartition_Sync(pTable);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROMPartition_Sync() then return the error
+  for (size_t zPart = 0; zPart < pTable->PartCount; ++zPart) pTable->Parts[zPart].Mounted = false;
+
+  //--- Fill the table page ---
+  pBuf[0] = (uint8_t)EEPROMPARTITION_MAGIC; pBuf[1] = (uint8_t)(EEPROMPARTITION_MAGIC >> 8);
+  pBuf[2] = (uint8_t)count;
+  pBuf[3] = 0x00;
+  for (size_t zEntry = 0; zEntry < count; ++zEntry)
+  {
+    uint8_t* const pData = &pBuf[EEPROMPARTITION_TABLE_SIZE(zEntry)];
+    pData[0] = entries[zEntry].Id;
+    pData[1] = (uint8_t)((entries[zEntry].Cache & 0x0F) | ((entries[zEntry].Wear & 0x0F) << 4));
+    pData[2] = (uint8_t)entries[zEntry].FirstPage; pData[3] = (uint8_t)(entries[zEntry].FirstPage >> 8);
+    pData[4] = (uint8_t)entries[zEntry].PageCount; pData[5] = (uint8_t)(entries[zEntry].PageCount >> 8);
+  }
+  EEPROM_ComputeCRC16IBM3740(&CRC, pBuf, EEPROMPARTITION_TABLE_SIZE(count));
+  pBuf[EEPROMPARTITION_TABLE_SIZE(count) + 0] = (uint8_t)CRC;
+  pBuf[EEPROMPARTITION_TABLE_SIZE(count) + 1] = (uint8_t)(CRC >> 8);
+
+  //--- Write the table page and mount it ---
+  Error = EEPROM_WriteData(pTable->pEeprom, 0, pBuf, EEPROMPARTITION_TABLE_SIZE(count) + 2u);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_WriteData() then return the error
+  Error = EEPROM_WaitEndOfWrite(pTable->pEeprom);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_WaitEndOfWrite() then return the error
+  return __EEPROMPartition_MountTable(pTable);
+}
+
+
+//=============================================================================
+// Read data from an EEPROM partition
+//=============================================================================
+eERRORRESULT EEPROMPartition_ReadData(EEPROMPartition *pPart, uint32_t address, uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pPart == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pPart->Mounted == false) return ERR_GENERATE(ERR__NOT_READY);
+  if (pPart->Entry.Cache == EEPROMPARTITION_CACHE_NONE) return EEPROM_ReadData(&pPart->View, address, data, size);
+  return EEPROMCache_ReadData(&pPart->Cache, address, data, size);
+}
+
+
+//=============================================================================
+// Write data to an EEPROM partition
+//=============================================================================
+eERRORRESULT EEPROMPartition_WriteData(EEPROMPartition *pPart, uint32_t address, const uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pPart == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pPart->Mounted == false) return ERR_GENERATE(ERR__NOT_READY);
+  if (pPart->Entry.Cache == EEPROMPARTITION_CACHE_NONE) return EEPROM_WriteData(&pPart->View, address, data, size);
+  return EEPROMCache_WriteData(&pPart->Cache, address, data, size);
+}
+
+
+//=============================================================================
+// Flush the write-back caches of all the mounted partitions and wait the end of the last write cycle
+//=============================================================================
+eERRORRESULT EEPROMPartition_Sync(EEPROMPartitionTable *pTable)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pTable == NULL) || (pTable->pEeprom == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  eERRORRESULT Error;
+
+  for (size_t zPart = 0; zPart < pTable->PartCount; ++zPart)
+  {
+    EEPROMPartition* const pPart = &pTable->Parts[zPart];
+    if ((pPart->Mounted == false) || (pPart->Entry.Cache != EEPROMPARTITION_CACHE_WRITE_BACK)) continue;
+    Error = EEPROMCache_Sync(&pPart->Cache);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROMCache_Sync() then return the error
+  }
+  return EEPROM_WaitEndOfWrite(pTable->pEeprom);                                             // The writes of the partitions without cache
+}
+
+
+//=============================================================================
+// EEPROM partition task
+//=============================================================================
+eERRORRESULT EEPROMPartition_Task(EEPROMPartitionTable *pTable)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pTable == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  eERRORRESULT Error;
+
+  for (size_t zPart = 0; zPart < pTable->PartCount; ++zPart)
+  {
+    EEPROMPartition* const pPart = &pTable->Parts[zPart];
+    if ((pPart->Mounted == false) || (pPart->Entry.Cache != EEPROMPARTITION_CACHE_WRITE_BACK)) continue;
+    Error = EEPROMCache_Task(&pPart->Cache);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling EEPROMCache_Task() then return the error
+  }
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
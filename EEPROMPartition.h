@@ -0,0 +1,198 @@
+/*!*****************************************************************************
+ * @file    EEPROMPartition.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Partition manager for I2C EEPROM
+ * @details Runtime partition table stored in the first page of the device.
+ * Each partition is an EEPROM view of its pages (an EEPROM object with its own
+ * EEPROM_Conf whose OffsetAddress and TotalByteSize are set from the table)
+ * with its own cache policy (none, write-through, or write-back with an
+ * EEPROMCache) and its own wear policy. The table page has:
+ * - Magic (2 bytes) "PT"
+ * - Entry count (1 byte)
+ * - Reserved (1 byte)
+ * - Entries (6 bytes each): Id, policies (cache in the low nibble, wear in the
+ *   high nibble), first page (2 bytes, little endian), page count (2 bytes,
+ *   little endian)
+ * - CRC16-IBM3740 (2 bytes, little endian) of the header and the entries
+ * The user gives the partitions to bind with their Id and the memory of their
+ * cache, the mount binds them to the entries of the table with the same Id.
+ * The memory is given by the user, there is no dynamic allocation
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef EEPROMPARTITION_H_INC
+#define EEPROMPARTITION_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "EEPROM.h"
+#include "EEPROMCache.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define EEPROMPARTITION_HEADER_SIZE  ( 4u ) //!< Size of the header at the start of the table page
+#define EEPROMPARTITION_ENTRY_SIZE   ( 6u ) //!< Size of an entry in the table page
+
+#define EEPROMPARTITION_MAX_ENTRIES(pageSize)  ( ((pageSize) - EEPROMPARTITION_HEADER_SIZE - 2u) / EEPROMPARTITION_ENTRY_SIZE ) //!< Maximum count of partitions in a table page of pageSize bytes
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM partition objects
+//********************************************************************************************************************
+
+//! Cache policy of a partition
+typedef enum
+{
+  EEPROMPARTITION_CACHE_NONE          = 0x0, //!< The reads and writes go directly to the EEPROM
+  EEPROMPARTITION_CACHE_WRITE_THROUGH = 0x1, //!< The writes go to the EEPROM at once, the pages written are kept in the cache for the reads
+  EEPROMPARTITION_CACHE_WRITE_BACK    = 0x2, //!< The writes to a page are merged in the cache and written at the sync, the eviction, or after the FlushDelay of the cache
+} eEEPROMPartition_CachePolicy;
+
+//! Wear policy of a partition
+typedef enum
+{
+  EEPROMPARTITION_WEAR_NONE     = 0x0, //!< The pages are written as requested
+  EEPROMPARTITION_WEAR_COMPARE  = 0x1, //!< The unchanged pages are not written, only the changed span of the others (EEPROM_READ_COMPARE_WRITE on the view)
+  EEPROMPARTITION_WEAR_LEVELING = 0x2, //!< The view of the partition is used by a wear-leveling layer (EEPROMWearLevel or EEPROMKVStore). Only with EEPROMPARTITION_CACHE_NONE
+} eEEPROMPartition_WearPolicy;
+
+
+//! EEPROM partition table entry structure
+typedef struct EEPROMPartition_Entry
+{
+  uint8_t Id;                             //!< Id of the partition, unique in the table
+  eEEPROMPartition_CachePolicy Cache;     //!< Cache policy of the partition
+  eEEPROMPartition_WearPolicy Wear;       //!< Wear policy of the partition
+  uint16_t FirstPage;                     //!< First page of the partition in the device, at least 1 (the page 0 has the table)
+  uint16_t PageCount;                     //!< Count of pages of the partition
+} EEPROMPartition_Entry;
+
+
+//! EEPROM partition object structure
+typedef struct EEPROMPartition
+{
+  uint8_t Id;                             //!< Id of the entry of the table to bind to this partition, this parameter is mandatory
+  EEPROMCache Cache;                      //!< Cache of the partition. Set its Lines, Buffer, LineCount, and FlushDelay for a partition with a cache, the other fields are set at the mount
+
+  //--- Partition state ---
+  bool Mounted;                           //!< 'true' if the partition is bound to an entry of the table
+  EEPROMPartition_Entry Entry;            //!< Entry of the table of the partition
+  EEPROM_Conf Conf;                       //!< Configuration of the view, OffsetAddress and TotalByteSize are the ones of the partition
+  EEPROM View;                            //!< EEPROM view of the partition, the address 0 is the first byte of the partition
+} EEPROMPartition;
+
+
+//! EEPROM partition table object structure
+typedef struct EEPROMPartitionTable
+{
+  EEPROM *pEeprom;                        //!< EEPROM device of the partitions, this parameter is mandatory. The table is in its first page
+  EEPROMPartition* Parts;                 //!< Array of PartCount partitions to bind, this parameter is mandatory
+  size_t PartCount;                       //!< Count of partitions of the Parts array
+  uint8_t* Buffer;                        //!< Page buffer of Conf->PageSize bytes, this parameter is mandatory
+} EEPROMPartitionTable;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM partition API
+//********************************************************************************************************************
+
+/*! @brief EEPROM partition table initialization and mount
+ *
+ * This function reads the table in the first page of the device and binds the partitions of the Parts array to the entries with the same Id. A partition without entry stays not mounted. The EEPROM device shall be initialized before with Init_EEPROM()
+ * @param[in] *pTable Is the pointed structure of the partition table to be initialized
+ * @return Returns ERR__NO_DATA_AVAILABLE if the device has no valid table (use EEPROMPartition_Format()), else an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_EEPROMPartition(EEPROMPartitionTable *pTable);
+
+/*! @brief Write a new partition table to the EEPROM device and mount it
+ *
+ * The entries are checked (unique Id, in the device, after the table page, no overlap). The data of the partitions is not touched
+ * @param[in] *pTable Is the pointed structure of the partition table to be used
+ * @param[in] *entries Is the array of the entries of the table
+ * @param[in] count Is the count of entries, at most EEPROMPARTITION_MAX_ENTRIES(Conf->PageSize)
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMPartition_Format(EEPROMPartitionTable *pTable, const EEPROMPartition_Entry* entries, size_t count);
+
+/*! @brief Read data from an EEPROM partition
+ *
+ * @param[in] *pPart Is the pointed structure of the partition to be used
+ * @param[in] address Is the address to read in the partition
+ * @param[out] *data Is where the data will be stored
+ * @param[in] size Is the size of the data array to read
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMPartition_ReadData(EEPROMPartition *pPart, uint32_t address, uint8_t* data, size_t size);
+
+/*! @brief Write data to an EEPROM partition
+ *
+ * The data is written with the cache policy of the partition
+ * @param[in] *pPart Is the pointed structure of the partition to be used
+ * @param[in] address Is the address where data will be written in the partition
+ * @param[in] *data Is the data array to store
+ * @param[in] size Is the size of the data array to write
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMPartition_WriteData(EEPROMPartition *pPart, uint32_t address, const uint8_t* data, size_t size);
+
+/*! @brief Flush the write-back caches of all the mounted partitions and wait the end of the last write cycle
+ *
+ * @param[in] *pTable Is the pointed structure of the partition table to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMPartition_Sync(EEPROMPartitionTable *pTable);
+
+/*! @brief EEPROM partition task
+ *
+ * Call this function periodically to flush the lines of the write-back caches that are dirty for more than their FlushDelay
+ * @param[in] *pTable Is the pointed structure of the partition table to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMPartition_Task(EEPROMPartitionTable *pTable);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* EEPROMPARTITION_H_INC */
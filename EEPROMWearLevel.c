@@ -0,0 +1,246 @@
+/*!*****************************************************************************
+ * @file    EEPROMWearLevel.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Wear-leveling of records for I2C EEPROM
+ * @details Record layer over the generic EEPROM driver that spreads the
+ * rewrites of each record over a ring of pages
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <string.h>
+#include "EEPROMWearLevel.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__EEPROMWEARLEVEL // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// Read a page of a ring and check it (DO NOT USE DIRECTLY)
+static eERRORRESULT __EEPROMWearLevel_ReadPage(EEPROMWearLevel *pWL, size_t record, uint16_t page, bool* pValid);
+// Find the newest copy of a record (DO NOT USE DIRECTLY, use Init_EEPROMWearLevel() instead)
+static eERRORRESULT __EEPROMWearLevel_MountRecord(EEPROMWearLevel *pWL, size_t record);
+//-----------------------------------------------------------------------------
+#define EEPROMWEARLEVEL_PAGE_ADDRESS(pWL,record,page)  ( (pWL)->StartAddress + ((uint32_t)(record) * (pWL)->PagesPerRecord + (page)) * (pWL)->pEeprom->Conf->PageSize )
+#define EEPROMWEARLEVEL_GET32(pData)                   ( (uint32_t)(pData)[0] | ((uint32_t)(pData)[1] << 8) | ((uint32_t)(pData)[2] << 16) | ((uint32_t)(pData)[3] << 24) )
+#define EEPROMWEARLEVEL_SEQUENCE(pWL)                  ( EEPROMWEARLEVEL_GET32(&(pWL)->Buffer[2]) )
+#define EEPROMWEARLEVEL_ERASE_COUNT(pWL)               ( EEPROMWEARLEVEL_GET32(&(pWL)->Buffer[6]) )
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// EEPROM wear-leveling initialization and mount
+//=============================================================================
+eERRORRESULT Init_EEPROMWearLevel(EEPROMWearLevel *pWL)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pWL == NULL) || (pWL->pEeprom == NULL) || (pWL->Records == NULL) || (pWL->Buffer == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+  if (pWL->pEeprom->Conf == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  const EEPROM_Conf* const pConf = pWL->pEeprom->Conf;
+  eERRORRESULT Error;
+
+  //--- Check the configuration ---
+  if ((pWL->RecordCount == 0) || (pWL->PagesPerRecord < 2) || (pWL->RecordSize == 0)) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pWL->RecordSize + EEPROMWEARLEVEL_HEADER_SIZE) > pConf->PageSize) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pWL->StartAddress & (pConf->PageSize - 1u)) != 0) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pWL->StartAddress + EEPROMWEARLEVEL_AREA_SIZE(pWL->RecordCount, pWL->PagesPerRecord, pConf->PageSize)) > pConf->TotalByteSize) return ERR_GENERATE(ERR__OUT_OF_MEMORY);
+
+  //--- Mount the records ---
+  pWL->MountReads = 0;
+  for (size_t zRecord = 0; zRecord < pWL->RecordCount; ++zRecord)
+  {
+    Error = __EEPROMWearLevel_MountRecord(pWL, zRecord);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMWearLevel_MountRecord() then return the error
+  }
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Read a page of a ring and check it
+//=============================================================================
+eERRORRESULT __EEPROMWearLevel_ReadPage(EEPROMWearLevel *pWL, size_t record, uint16_t page, bool* pValid)
+{
+  const size_t PageDataSize = EEPROMWEARLEVEL_BUFFER_SIZE(pWL->RecordSize);
+  uint16_t CRC = 0xFFFF;
+  eERRORRESULT Error;
+
+  Error = EEPROM_ReadData(pWL->pEeprom, EEPROMWEARLEVEL_PAGE_ADDRESS(pWL, record, page), pWL->Buffer, PageDataSize);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_ReadData() then return the error
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pWL->Buffer[0], EEPROMWEARLEVEL_HEADER_SIZE - 2u);       // CRC of the header without the CRC...
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pWL->Buffer[EEPROMWEARLEVEL_HEADER_SIZE], pWL->RecordSize); // ...and of the record data
+  *pValid = (((uint16_t)pWL->Buffer[0] | ((uint16_t)pWL->Buffer[1] << 8)) == EEPROMWEARLEVEL_MAGIC)
+         && (((uint16_t)pWL->Buffer[10] | ((uint16_t)pWL->Buffer[11] << 8)) == CRC);
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Find the newest copy of a record
+//=============================================================================
+eERRORRESULT __EEPROMWearLevel_MountRecord(EEPROMWearLevel *pWL, size_t record)
+{
+  EEPROMWearLevel_Record* const pRecord = &pWL->Records[record];
+  const uint16_t LastPage = pWL->PagesPerRecord - 1u;
+  bool Valid;
+  eERRORRESULT Error;
+  pRecord->Valid = false;
+
+  //--- Check the first page of the ring ---
+  Error = __EEPROMWearLevel_ReadPage(pWL, record, 0, &Valid);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMWearLevel_ReadPage() then return the error
+  pWL->MountReads++;
+  if (Valid == false)                                                                        // Never written or its write was interrupted, the newest copy can only be the last page
+  {
+    Error = __EEPROMWearLevel_ReadPage(pWL, record, LastPage, &Valid);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMWearLevel_ReadPage() then return the error
+    pWL->MountReads++;
+    if (Valid == false) return ERR_NONE;                                                     // The record was never written
+    pRecord->Head       = LastPage;
+    pRecord->Sequence   = EEPROMWEARLEVEL_SEQUENCE(pWL);
+    pRecord->EraseCount = EEPROMWEARLEVEL_ERASE_COUNT(pWL);
+    pRecord->Valid      = true;
+    return ERR_NONE;
+  }
+  const uint32_t FirstSequence = EEPROMWEARLEVEL_SEQUENCE(pWL);
+  uint32_t HeadEraseCount = EEPROMWEARLEVEL_ERASE_COUNT(pWL);
+
+  //--- Binary search of the last page that follows the sequence of the first page ---
+  uint16_t Low = 0, High = pWL->PagesPerRecord;                                              // The page Low follows the sequence, the page High does not (or is out of the ring)
+  while ((High - Low) > 1)
+  {
+    const uint16_t Middle = Low + (High - Low) / 2u;
+    Error = __EEPROMWearLevel_ReadPage(pWL, record, Middle, &Valid);
+    if (Error != ERR_NONE) return Error;                                                     // If there is an error while calling __EEPROMWearLevel_ReadPage() then return the error
+    pWL->MountReads++;
+    if (Valid && ((uint32_t)(EEPROMWEARLEVEL_SEQUENCE(pWL) - FirstSequence) == Middle))      // Written after the first page in the same turn of the ring
+    {
+      Low = Middle;
+      HeadEraseCount = EEPROMWEARLEVEL_ERASE_COUNT(pWL);
+    }
+    else High = Middle;                                                                      // Older copy, blank page, or interrupted write
+  }
+  pRecord->Head       = Low;
+  pRecord->Sequence   = FirstSequence + Low;
+  pRecord->EraseCount = HeadEraseCount;
+  pRecord->Valid      = true;
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Read a record from the EEPROM wear-leveling
+//=============================================================================
+eERRORRESULT EEPROMWearLevel_ReadRecord(EEPROMWearLevel *pWL, size_t record, uint8_t* data)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pWL == NULL) || (pWL->pEeprom == NULL) || (pWL->Records == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (record >= pWL->RecordCount) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  const EEPROMWearLevel_Record* const pRecord = &pWL->Records[record];
+  if (pRecord->Valid == false) return ERR_GENERATE(ERR__NO_DATA_AVAILABLE);
+  bool Valid;
+  eERRORRESULT Error;
+
+  Error = __EEPROMWearLevel_ReadPage(pWL, record, pRecord->Head, &Valid);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMWearLevel_ReadPage() then return the error
+  if ((Valid == false) || (EEPROMWEARLEVEL_SEQUENCE(pWL) != pRecord->Sequence)) return ERR_GENERATE(ERR__CRC_ERROR);
+  memcpy(data, &pWL->Buffer[EEPROMWEARLEVEL_HEADER_SIZE], pWL->RecordSize);
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Write a record to the EEPROM wear-leveling
+//=============================================================================
+eERRORRESULT EEPROMWearLevel_WriteRecord(EEPROMWearLevel *pWL, size_t record, const uint8_t* data)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pWL == NULL) || (pWL->pEeprom == NULL) || (pWL->Records == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (record >= pWL->RecordCount) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  EEPROMWearLevel_Record* const pRecord = &pWL->Records[record];
+  const uint16_t Page = (pRecord->Valid ? (uint16_t)((pRecord->Head + 1u) % pWL->PagesPerRecord) : 0u);
+  const uint32_t Sequence = (pRecord->Valid ? pRecord->Sequence + 1u : 0u);
+  uint32_t EraseCount;
+  uint16_t CRC = 0xFFFF;
+  bool Valid;
+  eERRORRESULT Error;
+
+  //--- Get the erase count of the page ---
+  Error = __EEPROMWearLevel_ReadPage(pWL, record, Page, &Valid);                              // The page has the oldest copy of the record
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMWearLevel_ReadPage() then return the error
+  if (Valid) EraseCount = EEPROMWEARLEVEL_ERASE_COUNT(pWL) + 1u;
+  else EraseCount = (pRecord->Valid && (pRecord->EraseCount > 0) ? pRecord->EraseCount : 1u); // Blank or interrupted page, it is at least as used as the page before
+
+  //--- Fill the page ---
+  uint8_t* const pBuf = pWL->Buffer;
+  pBuf[0] = (uint8_t)(EEPROMWEARLEVEL_MAGIC & 0xFF); pBuf[1] = (uint8_t)(EEPROMWEARLEVEL_MAGIC >> 8);
+  pBuf[2] = (uint8_t)Sequence;   pBuf[3] = (uint8_t)(Sequence >> 8);   pBuf[4] = (uint8_t)(Sequence >> 16);   pBuf[5] = (uint8_t)(Sequence >> 24);
+  pBuf[6] = (uint8_t)EraseCount; pBuf[7] = (uint8_t)(EraseCount >> 8); pBuf[8] = (uint8_t)(EraseCount >> 16); pBuf[9] = (uint8_t)(EraseCount >> 24);
+  memcpy(&pBuf[EEPROMWEARLEVEL_HEADER_SIZE], data, pWL->RecordSize);
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pBuf[0], EEPROMWEARLEVEL_HEADER_SIZE - 2u);
+  EEPROM_ComputeCRC16IBM3740(&CRC, &pBuf[EEPROMWEARLEVEL_HEADER_SIZE], pWL->RecordSize);
+  pBuf[10] = (uint8_t)CRC; pBuf[11] = (uint8_t)(CRC >> 8);
+
+  //--- Write the page ---
+  Error = EEPROM_WriteData(pWL->pEeprom, EEPROMWEARLEVEL_PAGE_ADDRESS(pWL, record, Page), pBuf, EEPROMWEARLEVEL_BUFFER_SIZE(pWL->RecordSize)); // 1 page write
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling EEPROM_WriteData() then return the error
+  pRecord->Head       = Page;
+  pRecord->Sequence   = Sequence;
+  pRecord->EraseCount = EraseCount;
+  pRecord->Valid      = true;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Get the erase count of a page of the EEPROM wear-leveling
+//=============================================================================
+eERRORRESULT EEPROMWearLevel_GetEraseCount(EEPROMWearLevel *pWL, size_t record, uint16_t page, uint32_t* pEraseCount)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pWL == NULL) || (pWL->pEeprom == NULL) || (pEraseCount == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if ((record >= pWL->RecordCount) || (page >= pWL->PagesPerRecord)) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  bool Valid;
+  eERRORRESULT Error;
+
+  Error = __EEPROMWearLevel_ReadPage(pWL, record, page, &Valid);
+  if (Error != ERR_NONE) return Error;                                                       // If there is an error while calling __EEPROMWearLevel_ReadPage() then return the error
+  *pEraseCount = (Valid ? EEPROMWEARLEVEL_ERASE_COUNT(pWL) : 0u);
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
@@ -0,0 +1,158 @@
+/*!*****************************************************************************
+ * @file    EEPROMWearLevel.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Wear-leveling of records for I2C EEPROM
+ * @details Record layer over the generic EEPROM driver that spreads the
+ * rewrites of each record over a ring of pages. Each record has its own ring
+ * of PagesPerRecord pages and each write of a record goes to the next page of
+ * its ring, so a page is written once every PagesPerRecord writes of the
+ * record. Each page starts with a header:
+ * - Magic (2 bytes) "WL"
+ * - Sequence (4 bytes, little endian): incremented at each write of the record
+ * - Erase count (4 bytes, little endian): count of writes of this page
+ * - CRC16-IBM3740 (2 bytes, little endian) of the header and the record data
+ * The pages of a ring are written in order, so the sequence of the page i is
+ * the sequence of the page 0 + i up to the newest copy. The mount finds the
+ * newest copy of each record with a binary search on this property (about
+ * log2(PagesPerRecord) + 1 page reads per record instead of PagesPerRecord).
+ * A page with a bad CRC (write interrupted by a power loss) is ignored and
+ * the previous copy of the record is used.
+ * The memory is given by the user, there is no dynamic allocation
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef EEPROMWEARLEVEL_H_INC
+#define EEPROMWEARLEVEL_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "EEPROM.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define EEPROMWEARLEVEL_HEADER_SIZE  ( 12u )     //!< Size of the header at the start of each page
+#define EEPROMWEARLEVEL_MAGIC        ( 0x4C57u ) //!< Magic of the header ("WL" in little endian)
+
+#define EEPROMWEARLEVEL_BUFFER_SIZE(recordSize)  ( EEPROMWEARLEVEL_HEADER_SIZE + (recordSize) ) //!< Size of the page buffer of records of recordSize bytes
+#define EEPROMWEARLEVEL_AREA_SIZE(recordCount,pagesPerRecord,pageSize)  ( (recordCount) * (pagesPerRecord) * (pageSize) ) //!< Size in bytes of the EEPROM area used
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM wear-leveling objects
+//********************************************************************************************************************
+
+//! EEPROM wear-leveling record state structure
+typedef struct EEPROMWearLevel_Record
+{
+  uint32_t Sequence;       //!< Sequence of the newest copy of the record
+  uint32_t EraseCount;     //!< Erase count of the page of the newest copy of the record
+  uint16_t Head;           //!< Page index in the ring of the newest copy of the record
+  bool Valid;              //!< 'true' if the record has a copy in the EEPROM
+} EEPROMWearLevel_Record;
+
+
+//! EEPROM wear-leveling object structure
+typedef struct EEPROMWearLevel
+{
+  EEPROM *pEeprom;                  //!< EEPROM device of the records, this parameter is mandatory
+  EEPROMWearLevel_Record* Records;  //!< Array of RecordCount record states, this parameter is mandatory
+  uint8_t* Buffer;                  //!< Page buffer of EEPROMWEARLEVEL_BUFFER_SIZE(RecordSize) bytes, this parameter is mandatory
+  size_t RecordCount;               //!< Count of records
+  uint32_t StartAddress;            //!< Address of the first page of the area, shall be at the start of a page. The area is EEPROMWEARLEVEL_AREA_SIZE(RecordCount, PagesPerRecord, Conf->PageSize) bytes
+  uint16_t PagesPerRecord;          //!< Count of pages in the ring of each record, at least 2. The endurance of a record is multiplied by this count
+  uint16_t RecordSize;              //!< Size of a record in bytes, at most Conf->PageSize - EEPROMWEARLEVEL_HEADER_SIZE
+
+  //--- Wear-leveling state ---
+  uint32_t MountReads;              //!< Count of pages read by the last mount
+} EEPROMWearLevel;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// EEPROM wear-leveling API
+//********************************************************************************************************************
+
+/*! @brief EEPROM wear-leveling initialization and mount
+ *
+ * This function checks the configuration and finds the newest copy of each record with a binary search in its ring. The EEPROM device shall be initialized before with Init_EEPROM()
+ * @param[in] *pWL Is the pointed structure of the wear-leveling to be initialized
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_EEPROMWearLevel(EEPROMWearLevel *pWL);
+
+/*! @brief Read a record from the EEPROM wear-leveling
+ *
+ * The newest copy of the record is read and its CRC is checked
+ * @param[in] *pWL Is the pointed structure of the wear-leveling to be used
+ * @param[in] record Is the index of the record to read
+ * @param[out] *data Is where the RecordSize bytes of the record will be stored
+ * @return Returns ERR__NO_DATA_AVAILABLE if the record was never written, else an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMWearLevel_ReadRecord(EEPROMWearLevel *pWL, size_t record, uint8_t* data);
+
+/*! @brief Write a record to the EEPROM wear-leveling
+ *
+ * The record is written with 1 page write to the page after its newest copy in its ring. The previous copy is not touched, so if the write is interrupted by a power loss, the next mount gives back the previous copy
+ * The function does not wait the end of the write cycle. Use EEPROM_WaitEndOfWrite() to wait it
+ * @param[in] *pWL Is the pointed structure of the wear-leveling to be used
+ * @param[in] record Is the index of the record to write
+ * @param[in] *data Is the RecordSize bytes of the record to store
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMWearLevel_WriteRecord(EEPROMWearLevel *pWL, size_t record, const uint8_t* data);
+
+/*! @brief Get the erase count of a page of the EEPROM wear-leveling
+ *
+ * @param[in] *pWL Is the pointed structure of the wear-leveling to be used
+ * @param[in] record Is the index of the record of the ring
+ * @param[in] page Is the page index in the ring of the record
+ * @param[out] *pEraseCount Is where the count of writes of the page will be stored, 0 if the page has no valid copy
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT EEPROMWearLevel_GetEraseCount(EEPROMWearLevel *pWL, size_t record, uint16_t page, uint32_t* pEraseCount);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* EEPROMWEARLEVEL_H_INC */
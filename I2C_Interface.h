@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    I2C_Interface.h
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.1.1
- * @date    18/11/2023
+ * @version 1.2.0
+ * @date    16/10/2026
  * @brief   I2C interface for drivers
  * @details This I2C interface definitions for all the https://github.com/Emandhal
  * drivers and developments
@@ -31,6 +31,7 @@
  *****************************************************************************/
 
 /* Revision history:
+ * 1.2.0    Add optional fnI2C_TransferChain for scatter-gather packet chains
  * 1.1.1    Add STM32cubeIDE
  * 1.1.0    Add Arduino
  * 1.0.0    Release version
@@ -276,6 +277,21 @@ typedef eERRORRESULT (*I2CInit_Func)(I2C_Interface *pIntDev, const uint32_t sclF
  */
 typedef eERRORRESULT (*I2CTransferPacket_Func)(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc);
 
+
+/*! @brief Interface packet chain function for I2C peripheral transfer
+ *
+ * This function will be called when the driver needs to transfer several packets in one call (ex: the address then the data of a memory). The packets are transferred in order as if #I2CTransferPacket_Func was called for each packet,
+ * so a packet with Start set is a (repeated) START and the Stop of the last packet ends the transfer. This gives the possibility to the interface to turn the whole transfer into one DMA linked list or one Linux I2C_RDWR ioctl
+ * The transfer stops at the first packet in error. Only the last packet can be non-blocking, its transaction number is set in its Config
+ * @note This function is optional, when it is NULL the drivers call #I2CTransferPacket_Func for each packet
+ * @warning A I2CInit_Func() must be called before using this function
+ * @param[in] *pIntDev Is the I2C interface container structure used for the communication
+ * @param[in] *pPacketsDesc Is the array of the packet descriptions to transfer through I2C
+ * @param[in] count Is the count of packets in the array
+ * @return Returns an #eERRORRESULT value enum
+ */
+typedef eERRORRESULT (*I2CTransferChain_Func)(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketsDesc, size_t count);
+
 //-----------------------------------------------------------------------------
 
 #ifdef ARDUINO
@@ -285,6 +301,7 @@ struct I2C_Interface
   TwoWire& _I2Cclass;                    //!< Arduino I2C class
   I2CInit_Func fnI2C_Init;               //!< This function will be called at driver initialization to configure the interface driver
   I2CTransferPacket_Func fnI2C_Transfer; //!< This function will be called when the driver needs to transfer data over the I2C communication with the device
+  I2CTransferChain_Func fnI2C_TransferChain; //!< Optional, this function will be called when the driver needs to transfer several packets in one call. Can be NULL
 };
 
 #elif defined(USE_HAL_DRIVER) || defined(USE_FULL_LL_DRIVER) // STM32cubeIDE
@@ -300,6 +317,7 @@ struct I2C_Interface
   I2CInit_Func fnI2C_Init;               //!< This function will be called at driver initialization to configure the interface driver
   I2CTransferPacket_Func fnI2C_Transfer; //!< This function will be called when the driver needs to transfer data over the I2C communication with the device
   uint32_t I2Ctimeout;                   //!< I2C timeout
+  I2CTransferChain_Func fnI2C_TransferChain; //!< Optional, this function will be called when the driver needs to transfer several packets in one call. Can be NULL
 };
 
 #else
@@ -311,6 +329,7 @@ struct I2C_Interface
   I2CInit_Func fnI2C_Init;               //!< This function will be called at driver initialization to configure the interface driver
   I2CTransferPacket_Func fnI2C_Transfer; //!< This function will be called when the driver needs to transfer data over the I2C communication with the device
   uint8_t Channel;                       //!< I2C channel of the interface device
+  I2CTransferChain_Func fnI2C_TransferChain; //!< Optional, this function will be called when the driver needs to transfer several packets in one call. Can be NULL
 };
 #endif //#ifdef ARDUINO && USE_HAL_DRIVER
 
@@ -0,0 +1,314 @@
+/*!*****************************************************************************
+ * @file    I2C_LinuxDev.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Linux i2c-dev I2C interface
+ * @details I2C interface for a Linux host that sends each transfer with 1
+ * I2C_RDWR ioctl
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c-dev.h>
+#include "I2C_LinuxDev.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__I2C_LINUXDEV // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define I2CLINUXDEV_MAX_MESSAGE_LENGTH  ( 8192u ) // Maximum length of an I2C message accepted by the I2C_RDWR of i2c-dev
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// System open() of the device file (DO NOT USE DIRECTLY)
+static int __I2CLinuxDev_SysOpen(const char* pathname, int flags);
+// System ioctl() of the device file (DO NOT USE DIRECTLY)
+static int __I2CLinuxDev_SysIoctl(int fd, unsigned long request, void* arg);
+// Convert the errno of a failed I2C_RDWR to an error (DO NOT USE DIRECTLY)
+static eERRORRESULT __I2CLinuxDev_ErrnoToError(int error);
+// Probe the chip address of a message with a zero length write (DO NOT USE DIRECTLY)
+static bool __I2CLinuxDev_ProbeChip(I2C_LinuxDev *pDev, I2CLinuxDev_Ioctl_Func fnIoctl, const struct i2c_msg* pMessage);
+// Add a packet to the messages of the current transfer (DO NOT USE DIRECTLY)
+static eERRORRESULT __I2CLinuxDev_AddPacket(I2C_LinuxDev *pDev, I2CInterface_Packet* const pPacketDesc);
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// [STATIC] System open() of the device file (DO NOT USE DIRECTLY)
+//=============================================================================
+int __I2CLinuxDev_SysOpen(const char* pathname, int flags)
+{
+  return open(pathname, flags);
+}
+
+
+//=============================================================================
+// [STATIC] System ioctl() of the device file (DO NOT USE DIRECTLY)
+//=============================================================================
+int __I2CLinuxDev_SysIoctl(int fd, unsigned long request, void* arg)
+{
+  return ioctl(fd, request, arg);
+}
+
+
+//=============================================================================
+// [STATIC] Convert the errno of a failed I2C_RDWR to an error (DO NOT USE DIRECTLY)
+//=============================================================================
+eERRORRESULT __I2CLinuxDev_ErrnoToError(int error)
+{
+  switch (error)
+  {
+    case ENXIO:                                                      // The adapters return ENXIO or EREMOTEIO for a NACK on the chip address or on the data
+    case EREMOTEIO:  return ERR_GENERATE(ERR__I2C_NACK);             // EREMOTEIO in a transfer of several messages is checked by I2CLinuxDev_InterfaceTransfer()
+    case ETIMEDOUT:  return ERR_GENERATE(ERR__I2C_TIMEOUT);
+    case EAGAIN:                                                     // Arbitration lost
+    case EBUSY:      return ERR_GENERATE(ERR__I2C_OTHER_BUSY);
+    case EINVAL:                                                     // The adapter does not support the messages (zero length message, 10-bits address...)
+    case EOPNOTSUPP: return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);
+    default: break;
+  }
+  return ERR_GENERATE(ERR__I2C_COMM_ERROR);
+}
+
+
+
+//=============================================================================
+// [STATIC] Probe the chip address of a message with a zero length write (DO NOT USE DIRECTLY)
+//=============================================================================
+bool __I2CLinuxDev_ProbeChip(I2C_LinuxDev *pDev, I2CLinuxDev_Ioctl_Func fnIoctl, const struct i2c_msg* pMessage)
+{
+  struct i2c_msg Probe;
+  Probe.addr  = pMessage->addr;
+  Probe.flags = (uint16_t)(pMessage->flags & I2C_M_TEN);
+  Probe.len   = 0;
+  Probe.buf   = NULL;
+  struct i2c_rdwr_ioctl_data Transfer;
+  Transfer.msgs  = &Probe;
+  Transfer.nmsgs = 1;
+  const int Result = fnIoctl(pDev->File, I2C_RDWR, &Transfer);
+  pDev->RdwrCalls++;
+  return (Result >= 0);                                               // An adapter that does not support zero length messages gives a NACK
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Linux i2c-dev interface initialization
+//=============================================================================
+eERRORRESULT I2CLinuxDev_InterfaceInit(I2C_Interface *pIntDev, const uint32_t sclFreq)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != I2CLINUXDEV_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  I2C_LinuxDev* pDev = (I2C_LinuxDev*)pIntDev->InterfaceDevice;
+  if (pDev == NULL) return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);
+  if (sclFreq == 0) return ERR_GENERATE(ERR__I2C_FREQUENCY_ERROR);                          // The SCL frequency is set by the kernel, only check the driver asks for one
+  I2CLinuxDev_Open_Func  fnOpen  = (pDev->fnOpen  != NULL ? pDev->fnOpen  : __I2CLinuxDev_SysOpen);
+  I2CLinuxDev_Ioctl_Func fnIoctl = (pDev->fnIoctl != NULL ? pDev->fnIoctl : __I2CLinuxDev_SysIoctl);
+  eERRORRESULT Error;
+
+  //--- Open the device file ---
+  if (pDev->IsOpen)
+  {
+    Error = I2CLinuxDev_Close(pDev);
+    if (Error != ERR_NONE) return Error;                                                    // If there is an error while calling I2CLinuxDev_Close() then return the error
+  }
+  char Path[24];
+  const char* pPath = pDev->DevicePath;
+  if (pPath == NULL)
+  {
+    snprintf(&Path[0], sizeof(Path), "/dev/i2c-%u", (unsigned int)pIntDev->Channel);
+    pPath = &Path[0];
+  }
+  pDev->File = fnOpen(pPath, O_RDWR);
+  if (pDev->File < 0) return ERR_GENERATE(ERR__UNKNOWN_CHANNEL);
+  pDev->IsOpen = true;
+
+  //--- Check the adapter ---
+  unsigned long Functionality = 0;
+  if ((fnIoctl(pDev->File, I2C_FUNCS, &Functionality) < 0) || ((Functionality & I2C_FUNC_I2C) == 0)) // The adapter shall support the I2C_RDWR transfers, not only SMBus
+  {
+    I2CLinuxDev_Close(pDev);
+    return ERR_GENERATE(ERR__I2C_CONFIG_ERROR);
+  }
+
+  //--- Reset the interface state ---
+  pDev->Functionality = Functionality;
+  pDev->RdwrCalls     = 0;
+  pDev->MessageCount  = 0;
+  pDev->MergeCount    = 0;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Add a packet to the messages of the current transfer (DO NOT USE DIRECTLY)
+//=============================================================================
+eERRORRESULT __I2CLinuxDev_AddPacket(I2C_LinuxDev *pDev, I2CInterface_Packet* const pPacketDesc)
+{
+  const size_t Size = pPacketDesc->BufferSize;
+  struct i2c_msg* pMsg;
+
+  //--- New message at a START or a repeated START ---
+  if (pPacketDesc->Start)
+  {
+    if (pDev->MessageCount >= I2CLINUXDEV_MAX_MESSAGES) return ERR_GENERATE(ERR__I2C_OVERFLOW_ERROR);
+    const bool Addr10bits = I2C_IS_10BITS_ADDRESS(pPacketDesc->Config.Value);
+    pMsg = &pDev->Messages[pDev->MessageCount++];
+    pMsg->addr  = (uint16_t)((pPacketDesc->ChipAddr & (Addr10bits ? I2C_ONLY_ADDR10_Mask : I2C_ONLY_ADDR8_Mask)) >> 1);
+    pMsg->flags = (uint16_t)((Addr10bits ? I2C_M_TEN : 0) | ((pPacketDesc->ChipAddr & I2C_READ_ORMASK) > 0 ? I2C_M_RD : 0));
+    pMsg->len   = 0;
+    pMsg->buf   = pPacketDesc->pBuffer;
+  }
+  else if (pDev->MessageCount == 0) return ERR_GENERATE(ERR__I2C_COMM_ERROR);              // The transfer cannot continue without a START
+  else pMsg = &pDev->Messages[pDev->MessageCount - 1];
+  if (((size_t)pMsg->len + Size) > I2CLINUXDEV_MAX_MESSAGE_LENGTH) return ERR_GENERATE(ERR__I2C_OVERFLOW_ERROR);
+
+  //--- Read data, received directly in the buffer of the packet ---
+  if ((pMsg->flags & I2C_M_RD) > 0)
+  {
+    if (pMsg->len > 0) return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);                        // A read message cannot be received in 2 buffers
+    pMsg->buf = pPacketDesc->pBuffer;
+    pMsg->len = (uint16_t)Size;
+    return ERR_NONE;
+  }
+
+  //--- Write data at the Stop, sent directly from the buffer of the packet ---
+  if (pPacketDesc->Stop && ((pMsg->len == 0) || ((pDev->Functionality & I2C_FUNC_NOSTART) > 0)))
+  {
+    if (pMsg->len > 0)                                                                      // Continue the message without repeated START
+    {
+      if (pDev->MessageCount >= I2CLINUXDEV_MAX_MESSAGES) return ERR_GENERATE(ERR__I2C_OVERFLOW_ERROR);
+      const uint16_t Addr = pMsg->addr, Flags = pMsg->flags;
+      pMsg = &pDev->Messages[pDev->MessageCount++];
+      pMsg->addr  = Addr;
+      pMsg->flags = (uint16_t)(Flags | I2C_M_NOSTART);
+    }
+    pMsg->buf = pPacketDesc->pBuffer;
+    pMsg->len = (uint16_t)Size;
+    return ERR_NONE;
+  }
+
+  //--- Other write data, merged in the message ---
+  if ((pDev->MergeCount + Size) > I2CLINUXDEV_MERGE_BUFFER_SIZE) return ERR_GENERATE(ERR__I2C_OVERFLOW_ERROR);
+  if (pMsg->len == 0) pMsg->buf = &pDev->MergeBuffer[pDev->MergeCount];                     // The data of the last message are always at the end of the merge buffer
+  if (Size > 0) memcpy(&pDev->MergeBuffer[pDev->MergeCount], pPacketDesc->pBuffer, Size);
+  pDev->MergeCount += Size;
+  pMsg->len = (uint16_t)(pMsg->len + Size);
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Linux i2c-dev interface transfer
+//=============================================================================
+eERRORRESULT I2CLinuxDev_InterfaceTransfer(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pIntDev == NULL) || (pPacketDesc == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != I2CLINUXDEV_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  I2C_LinuxDev* pDev = (I2C_LinuxDev*)pIntDev->InterfaceDevice;
+  if (pDev == NULL) return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);
+  if (pDev->IsOpen == false) return ERR_GENERATE(ERR__I2C_CONFIG_ERROR);                    // The interface is not initialized
+  if ((pPacketDesc->pBuffer == NULL) && (pPacketDesc->BufferSize > 0)) return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);
+  eERRORRESULT Error;
+
+  //--- Add the packet to the transfer ---
+  Error = __I2CLinuxDev_AddPacket(pDev, pPacketDesc);
+  if (Error != ERR_NONE)
+  {
+    pDev->MessageCount = 0;                                                                 // The transfer is dropped
+    pDev->MergeCount   = 0;
+    return Error;
+  }
+  if (pPacketDesc->Stop == false) return ERR_NONE;                                          // The transfer is sent at the Stop
+
+  //--- Send the whole transfer ---
+  I2CLinuxDev_Ioctl_Func fnIoctl = (pDev->fnIoctl != NULL ? pDev->fnIoctl : __I2CLinuxDev_SysIoctl);
+  struct i2c_rdwr_ioctl_data Transfer;
+  Transfer.msgs  = &pDev->Messages[0];
+  Transfer.nmsgs = (uint32_t)pDev->MessageCount;
+  const int Result = fnIoctl(pDev->File, I2C_RDWR, &Transfer);
+  const int ErrorNumber = errno;
+  const size_t MessageCount = pDev->MessageCount;
+  pDev->RdwrCalls++;
+  pDev->MessageCount = 0;
+  pDev->MergeCount   = 0;
+  if (Result >= 0) return ERR_NONE;
+  if ((ErrorNumber == EREMOTEIO) && (MessageCount > 1) && __I2CLinuxDev_ProbeChip(pDev, fnIoctl, &pDev->Messages[0]))
+    return ERR_GENERATE(ERR__I2C_NACK_DATA);                                                // The chip acknowledges its address, the NACK was after the first message
+  return __I2CLinuxDev_ErrnoToError(ErrorNumber);
+}
+
+
+//=============================================================================
+// Linux i2c-dev interface packet chain transfer
+//=============================================================================
+eERRORRESULT I2CLinuxDev_InterfaceTransferChain(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketsDesc, size_t count)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pIntDev == NULL) || (pPacketsDesc == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  eERRORRESULT Error = ERR_NONE;
+
+  for (size_t zPacket = 0; zPacket < count; ++zPacket)
+  {
+    Error = I2CLinuxDev_InterfaceTransfer(pIntDev, &pPacketsDesc[zPacket]);
+    if (Error != ERR_NONE) break;                                                           // The transfer stops at the first packet in error
+  }
+  return Error;
+}
+
+
+//=============================================================================
+// Close the device file of a Linux i2c-dev interface
+//=============================================================================
+eERRORRESULT I2CLinuxDev_Close(I2C_LinuxDev *pDev)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pDev == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pDev->IsOpen == false) return ERR_NONE;
+  I2CLinuxDev_Close_Func fnClose = (pDev->fnClose != NULL ? pDev->fnClose : close);
+  pDev->IsOpen       = false;
+  pDev->MessageCount = 0;
+  pDev->MergeCount   = 0;
+  if (fnClose(pDev->File) < 0) return ERR_GENERATE(ERR__I2C_COMM_ERROR);
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
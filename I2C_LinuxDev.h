@@ -0,0 +1,161 @@
+/*!*****************************************************************************
+ * @file    I2C_LinuxDev.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Linux i2c-dev I2C interface
+ * @details I2C interface for a Linux host (single board computer) that can be
+ * set in a struct I2C_Interface. The packets of a transfer are kept until the
+ * packet with the Stop and the whole transfer is sent with 1 I2C_RDWR ioctl:
+ * - A packet with Start begins a new I2C message (START or repeated START)
+ * - A packet without Start continues the last message, the write data are merged in 1 message
+ * So a FIRST_PART/SECOND_PART pair of #eI2C_TransferType (the address then the
+ * data of a memory) is 1 system call instead of 2.
+ * The open(), ioctl(), and close() functions can be replaced by fake ones to
+ * run the drivers without a real bus.
+ * Only the generic struct I2C_Interface is supported (not the Arduino, nor the STM32 ones)
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef I2C_LINUXDEV_H_INC
+#define I2C_LINUXDEV_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include <linux/i2c.h>
+#include "ErrorsDef.h"
+#include "I2C_Interface.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define I2CLINUXDEV_UNIQUE_ID          ( 0x49324C44u ) //!< Unique ID of the Linux i2c-dev interface, to set in the I2C_Interface.UniqueID
+#define I2CLINUXDEV_MAX_MESSAGES       ( 8u )          //!< Maximum I2C messages (START and repeated STARTs) of a transfer. The kernel limit is 42 (I2C_RDWR_IOCTL_MAX_MSGS)
+#define I2CLINUXDEV_MERGE_BUFFER_SIZE  ( 520u )        //!< Size of the buffer of the merged write data of a transfer (word address + a page of 512 bytes)
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Linux i2c-dev interface
+//********************************************************************************************************************
+
+/*! @brief open() function of the i2c-dev device file
+ * @param[in] *pathname Is the path of the device file
+ * @param[in] flags Is the open flags (O_RDWR)
+ * @return Returns the file descriptor, or -1 with errno set
+ */
+typedef int (*I2CLinuxDev_Open_Func)(const char* pathname, int flags);
+
+/*! @brief ioctl() function of the i2c-dev device file
+ * @param[in] fd Is the file descriptor of the device file
+ * @param[in] request Is the ioctl request (I2C_FUNCS, I2C_RDWR)
+ * @param[in,out] *arg Is the argument of the request
+ * @return Returns a positive value or 0 if succeed, or -1 with errno set
+ */
+typedef int (*I2CLinuxDev_Ioctl_Func)(int fd, unsigned long request, void* arg);
+
+/*! @brief close() function of the i2c-dev device file
+ * @param[in] fd Is the file descriptor of the device file
+ * @return Returns 0 if succeed, or -1 with errno set
+ */
+typedef int (*I2CLinuxDev_Close_Func)(int fd);
+
+
+//! Linux i2c-dev interface object structure
+typedef struct I2C_LinuxDev
+{
+  const char* DevicePath;             //!< Path of the device file (ex: "/dev/i2c-1"). Set NULL to use "/dev/i2c-<I2C_Interface.Channel>"
+  I2CLinuxDev_Open_Func fnOpen;       //!< open() function. Set NULL to use the system open(), or set a fake one to run without a real bus
+  I2CLinuxDev_Ioctl_Func fnIoctl;     //!< ioctl() function. Set NULL to use the system ioctl(), or set a fake one to run without a real bus
+  I2CLinuxDev_Close_Func fnClose;     //!< close() function. Set NULL to use the system close(), or set a fake one to run without a real bus
+
+  //--- Interface state ---
+  int File;                           //!< File descriptor of the device file, set by I2CLinuxDev_InterfaceInit()
+  bool IsOpen;                        //!< 'true' if the device file is opened
+  unsigned long Functionality;        //!< Functionality of the adapter (I2C_FUNC_*) get at the initialization
+  uint32_t RdwrCalls;                 //!< Count of I2C_RDWR ioctl since the initialization (1 per transfer)
+  size_t MessageCount;                //!< Count of messages of the current transfer
+  size_t MergeCount;                  //!< Count of bytes used in the merge buffer by the current transfer
+  struct i2c_msg Messages[I2CLINUXDEV_MAX_MESSAGES]; //!< Messages of the current transfer
+  uint8_t MergeBuffer[I2CLINUXDEV_MERGE_BUFFER_SIZE]; //!< Write data of the current transfer that are merged in a message or that shall be kept until the Stop
+} I2C_LinuxDev;
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Linux i2c-dev interface initialization
+ *
+ * Set this function in the I2C_Interface.fnI2C_Init of the driver with I2C_Interface.InterfaceDevice pointing to an #I2C_LinuxDev and I2C_Interface.UniqueID set to #I2CLINUXDEV_UNIQUE_ID
+ * It opens the device file and checks that the adapter supports the plain I2C transfers (I2C_FUNC_I2C). If the device file is already opened, it is closed and opened again
+ * @note The SCL frequency of a Linux adapter is set by the kernel (device tree), it is not changed by this function
+ * @param[in] *pIntDev Is the I2C interface container structure used for the interface initialization
+ * @param[in] sclFreq Is the SCL frequency in Hz asked by the driver
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT I2CLinuxDev_InterfaceInit(I2C_Interface *pIntDev, const uint32_t sclFreq);
+
+/*! @brief Linux i2c-dev interface transfer
+ *
+ * Set this function in the I2C_Interface.fnI2C_Transfer of the driver. A packet without Stop is kept and the transfer is sent with 1 I2C_RDWR ioctl at the packet with the Stop
+ * The write data of a packet without Stop are copied, the buffers of the packets that receive data shall be valid until the packet with the Stop
+ * All transfers are blocking. The kernel does not tell which message got the NACK: ENXIO (NACK of the chip address) is returned as ERR__I2C_NACK. On EREMOTEIO in a transfer of several messages, the chip address is probed with a zero length write:
+ * if the chip acknowledges, the NACK was after the first message and ERR__I2C_NACK_DATA is returned, else ERR__I2C_NACK is returned
+ * @param[in] *pIntDev Is the I2C interface container structure used for the communication
+ * @param[in] *pPacketDesc Is the packet description to transfer through I2C
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT I2CLinuxDev_InterfaceTransfer(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc);
+
+/*! @brief Linux i2c-dev interface packet chain transfer
+ *
+ * Set this function in the I2C_Interface.fnI2C_TransferChain of the driver. The packets are transferred as with I2CLinuxDev_InterfaceTransfer(), a chain that ends with a Stop is 1 I2C_RDWR ioctl
+ * @param[in] *pIntDev Is the I2C interface container structure used for the communication
+ * @param[in] *pPacketsDesc Is the array of the packet descriptions to transfer through I2C
+ * @param[in] count Is the count of packets in the array
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT I2CLinuxDev_InterfaceTransferChain(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketsDesc, size_t count);
+
+/*! @brief Close the device file of a Linux i2c-dev interface
+ *
+ * @param[in] *pDev Is the pointed structure of the Linux i2c-dev interface
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT I2CLinuxDev_Close(I2C_LinuxDev *pDev);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* I2C_LINUXDEV_H_INC */
@@ -0,0 +1,369 @@
+/*!*****************************************************************************
+ * @file    I2C_MemorySim.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Simulated I2C bus with EEPROM and EERAM devices
+ * @details Host-side I2C interface that can be set in a struct I2C_Interface
+ * instead of a real I2C peripheral
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <string.h>
+#include "I2C_MemorySim.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__I2C_MEMORYSIM // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define I2CMEMSIM_MEMORY_SIZE(pDev)  ( (pDev)->Conf->OffsetAddress + (pDev)->Conf->TotalByteSize ) // Total memory size of a device
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Simulated I2C interface initialization
+//=============================================================================
+eERRORRESULT I2CMemSim_InterfaceInit(I2C_Interface *pIntDev, const uint32_t sclFreq)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != I2CMEMSIM_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  I2C_MemorySim* pSim = (I2C_MemorySim*)pIntDev->InterfaceDevice;
+  if ((pSim == NULL) || (pSim->Devices == NULL)) return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);
+  if (sclFreq == 0) return ERR_GENERATE(ERR__I2C_FREQUENCY_ERROR);
+
+  //--- Check the devices ---
+  for (size_t z = 0; z < pSim->DeviceCount; ++z)
+  {
+    I2CMemSim_Device* pDev = &pSim->Devices[z];
+    if ((pDev->Conf == NULL) || (pDev->Memory == NULL)) return ERR_GENERATE(ERR__I2C_CONFIG_ERROR);
+    if (I2CMEMSIM_MEMORY_SIZE(pDev) == 0) return ERR_GENERATE(ERR__I2C_CONFIG_ERROR);
+    if (pDev->Type == I2CMEMSIM_EEPROM)
+    {
+      const uint16_t PageSize = pDev->Conf->PageSize;
+      if ((PageSize == 0) || (PageSize > I2CMEMSIM_PAGE_LATCH_SIZE)) return ERR_GENERATE(ERR__I2C_CONFIG_ERROR); // The page shall fit in the page latch
+      if ((PageSize & (PageSize - 1)) != 0) return ERR_GENERATE(ERR__I2C_CONFIG_ERROR);                          // The page size shall be a power of 2
+    }
+  }
+
+  //--- Reset the bus state ---
+  pSim->SCLfrequency     = sclFreq;
+  pSim->pCurrent         = NULL;
+  pSim->InTransaction    = false;
+  pSim->LatchCount       = 0;
+  pSim->NonBlockingEndns = 0;
+  pSim->NonBlockingError = ERR_NONE;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Reset the statistics of a simulated I2C bus
+//=============================================================================
+void I2CMemSim_ResetStats(I2C_MemorySim *pSim)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pSim == NULL) return;
+#endif
+  memset(&pSim->Stats, 0, sizeof(pSim->Stats));
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Select the device that acknowledges a chip address
+//=============================================================================
+static I2CMemSim_Device* __I2CMemSim_SelectDevice(I2C_MemorySim *pSim, uint8_t chipAddr, uint64_t now)
+{
+  for (size_t z = 0; z < pSim->DeviceCount; ++z)
+  {
+    I2CMemSim_Device* pDev = &pSim->Devices[z];
+    const EEPROM_Conf* const pConf = pDev->Conf;
+    const uint8_t PinsMask = (uint8_t)(((uint8_t)pConf->ChipSelect << 1) & 0x0E); // Chip select pins A2, A1, and A0 are on bits ....210_
+    if ((chipAddr & PinsMask) != (pDev->AddrA2A1A0 & PinsMask)) continue;          // The chip select pins do not match, try next device
+    const uint8_t Base = (chipAddr & 0xF0);
+    bool IsRegister = false;
+    if (Base != (pConf->ChipAddress & 0xF0))
+    {
+      if ((pDev->Type != I2CMEMSIM_EERAM47xxx) || (Base != I2CMEMSIM_EERAM_REG_CHIPADDRESS)) continue; // Not this device, try next device
+      IsRegister = true;
+    }
+    if (now < pDev->BusyUntilns) return NULL;                                      // The device is in an internal cycle, it does not acknowledge
+
+    //--- Prepare the transaction ---
+    const uint8_t AddrBytes  =  (pConf->AddressType & (uint8_t)EEPROM_ADDRESS_Bytes_MASK);
+    const uint8_t AddrTypeAx = ((pConf->AddressType & (uint8_t)EEPROM_ADDRESS_plus_Ax_MASK) >> 4);
+    pSim->IsRead        = ((chipAddr & I2C_READ_ORMASK) > 0);
+    pSim->IsRegister    = IsRegister;
+    pSim->AddrBytesLeft = (IsRegister ? 1 : AddrBytes);
+    pSim->WordAddress   = (IsRegister ? 0 : ((uint32_t)(chipAddr & AddrTypeAx) << (8 * AddrBytes - 1))); // Block bits of the chip address are the upper bits of the address
+    return pDev;
+  }
+  return NULL;
+}
+
+
+//=============================================================================
+// [STATIC] Write a byte to the selected device
+//=============================================================================
+static bool __I2CMemSim_WriteByte(I2C_MemorySim *pSim, uint8_t data)
+{
+  I2CMemSim_Device* pDev = pSim->pCurrent;
+  const uint32_t MemSize = I2CMEMSIM_MEMORY_SIZE(pDev);
+
+  //--- Word address ---
+  if (pSim->AddrBytesLeft > 0)
+  {
+    pSim->AddrBytesLeft--;
+    if (pSim->IsRegister) { pSim->RegisterAddress = data; return true; }
+    pSim->WordAddress |= ((uint32_t)data << (8 * pSim->AddrBytesLeft));
+    if (pSim->AddrBytesLeft == 0)
+    {
+      pDev->AddressCounter = (pSim->WordAddress % MemSize);                           // The address is complete, set the address counter
+      pSim->LatchPageBase  = pDev->AddressCounter & ~((uint32_t)pDev->Conf->PageSize - 1u);
+      pSim->LatchPos       = pDev->AddressCounter &  ((uint32_t)pDev->Conf->PageSize - 1u);
+      pSim->LatchCount     = 0;
+      memset(&pSim->LatchMask[0], 0, sizeof(pSim->LatchMask));
+    }
+    return true;
+  }
+
+  //--- Control registers ---
+  if (pSim->IsRegister)
+  {
+    if (pSim->RegisterAddress == I2CMEMSIM_EERAM_STATUS_REGISTER)
+    {
+      pDev->StatusRegister = (pDev->StatusRegister & ~I2CMEMSIM_EERAM_STATUS_WRITABLE) | (data & I2CMEMSIM_EERAM_STATUS_WRITABLE);
+      return true;
+    }
+    if ((pSim->RegisterAddress == I2CMEMSIM_EERAM_COMMAND_REGISTER)
+     && ((data == I2CMEMSIM_EERAM_STORE_COMMAND) || (data == I2CMEMSIM_EERAM_RECALL_COMMAND)))
+    {
+      pDev->PendingCommand = data;                                                    // The command will be executed at the STOP condition
+      return true;
+    }
+    return false;                                                                     // Invalid register or command, NACK the data
+  }
+
+  //--- SRAM of the EERAM ---
+  if (pDev->Type == I2CMEMSIM_EERAM47xxx)
+  {
+    pDev->Memory[pDev->AddressCounter] = data;
+    pDev->AddressCounter = ((pDev->AddressCounter + 1u) % MemSize);                  // Roll-over at the end of the memory
+    pDev->StatusRegister |= I2CMEMSIM_EERAM_ARRAY_MODIFIED;
+    return true;
+  }
+
+  //--- Page latch of the EEPROM ---
+  pSim->Latch[pSim->LatchPos] = data;
+  pSim->LatchMask[pSim->LatchPos >> 3] |= (uint8_t)(1u << (pSim->LatchPos & 0x7));
+  pSim->LatchPos = ((pSim->LatchPos + 1u) & ((uint32_t)pDev->Conf->PageSize - 1u));  // Roll-over inside the page
+  pSim->LatchCount++;
+  return true;
+}
+
+
+//=============================================================================
+// [STATIC] Read a byte from the selected device
+//=============================================================================
+static uint8_t __I2CMemSim_ReadByte(I2C_MemorySim *pSim)
+{
+  I2CMemSim_Device* pDev = pSim->pCurrent;
+  if (pSim->IsRegister) return pDev->StatusRegister;                                  // The EERAM control registers always read the status register
+  const uint8_t Data = pDev->Memory[pDev->AddressCounter];
+  const uint8_t AddrBytes = (pDev->Conf->AddressType & (uint8_t)EEPROM_ADDRESS_Bytes_MASK);
+  if (pDev->ReadRollOverInBlock && ((pDev->Conf->AddressType & (uint8_t)EEPROM_ADDRESS_plus_Ax_MASK) > 0) && (AddrBytes < EEPROM_ADDRESS_4Bytes))
+  {
+    const uint32_t BlockMask = (1ul << (8 * AddrBytes)) - 1u;
+    pDev->AddressCounter = (pDev->AddressCounter & ~BlockMask) | ((pDev->AddressCounter + 1u) & BlockMask); // Roll-over at the end of the block
+  }
+  else pDev->AddressCounter = ((pDev->AddressCounter + 1u) % I2CMEMSIM_MEMORY_SIZE(pDev)); // Roll-over at the end of the memory
+  return Data;
+}
+
+
+//=============================================================================
+// [STATIC] End the current transaction
+//=============================================================================
+static void __I2CMemSim_EndTransaction(I2C_MemorySim *pSim, bool program, uint64_t endTimens)
+{
+  I2CMemSim_Device* pDev = pSim->pCurrent;
+  if (program && (pDev != NULL) && (pSim->IsRead == false))
+  {
+    //--- Program the page latch of the EEPROM ---
+    if ((pDev->Type == I2CMEMSIM_EEPROM) && (pSim->LatchCount > 0))
+    {
+      for (uint32_t z = 0; z < pDev->Conf->PageSize; ++z)
+        if ((pSim->LatchMask[z >> 3] & (1u << (z & 0x7))) > 0) pDev->Memory[pSim->LatchPageBase + z] = pSim->Latch[z];
+      pDev->AddressCounter = pSim->LatchPageBase + pSim->LatchPos;
+      pDev->BusyUntilns = endTimens + (pDev->WriteCycleTimeus > 0 ? pDev->WriteCycleTimeus : pDev->Conf->PageWriteTime * 1000ull) * 1000ull;
+      pDev->WriteCycles++;
+    }
+    //--- Execute the EERAM command ---
+    if (pDev->PendingCommand == I2CMEMSIM_EERAM_STORE_COMMAND)
+    {
+      pDev->StatusRegister &= ~I2CMEMSIM_EERAM_ARRAY_MODIFIED;
+      pDev->BusyUntilns = endTimens + (pDev->WriteCycleTimeus > 0 ? pDev->WriteCycleTimeus : pDev->Conf->PageWriteTime * 1000ull) * 1000ull;
+      pDev->WriteCycles++;
+    }
+    if (pDev->PendingCommand == I2CMEMSIM_EERAM_RECALL_COMMAND)
+    {
+      pDev->BusyUntilns = endTimens + (pDev->RecallTimeus > 0 ? pDev->RecallTimeus : I2CMEMSIM_EERAM_RECALL_DEFAULT_US) * 1000ull;
+    }
+  }
+  if (pDev != NULL) pDev->PendingCommand = 0;
+  pSim->LatchCount    = 0;                                                            // A repeated START or a NACK aborts the page write
+  pSim->pCurrent      = NULL;
+  pSim->InTransaction = false;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Simulated I2C interface transfer
+//=============================================================================
+eERRORRESULT I2CMemSim_InterfaceTransfer(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pIntDev == NULL) || (pPacketDesc == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != I2CMEMSIM_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  I2C_MemorySim* pSim = (I2C_MemorySim*)pIntDev->InterfaceDevice;
+  if (pSim == NULL) return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);
+  if (pSim->SCLfrequency == 0) return ERR_GENERATE(ERR__I2C_CONFIG_ERROR);                  // The interface is not initialized
+  if ((pPacketDesc->pBuffer == NULL) && (pPacketDesc->BufferSize > 0)) return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);
+  const bool NonBlocking = (pSim->SupportNonBlocking && (pPacketDesc->Config.Bits.IsNonBlocking > 0));
+  uint64_t Now = MemorySim_GetTimens();
+  pSim->Stats.TransferCalls++;
+  pSim->Stats.LastCallBusTimens = 0;
+
+  //--- Non-blocking transfers ---
+  const uint8_t TransactionNumber = (uint8_t)I2C_TRANSACTION_NUMBER_GET(pPacketDesc->Config.Value);
+  if (NonBlocking && (TransactionNumber != 0))                                              // This is a check of the status of a non-blocking transfer
+  {
+    if (TransactionNumber != pSim->TransactionNumber) return ERR_NONE;
+    if (Now < pSim->NonBlockingEndns) return ERR_GENERATE(ERR__I2C_BUSY);
+    const eERRORRESULT Result = pSim->NonBlockingError;                                     // The transfer is complete, give its result once
+    pSim->NonBlockingError = ERR_NONE;
+    return Result;
+  }
+  if (Now < pSim->NonBlockingEndns)                                                         // A non-blocking transfer is in progress
+  {
+    if (NonBlocking) return ERR_GENERATE(ERR__I2C_OTHER_BUSY);
+    MemorySim_AdvanceTime(pSim->NonBlockingEndns - Now);                                    // A blocking transfer waits the end of the non-blocking one
+    Now = pSim->NonBlockingEndns;
+  }
+
+  //--- Chip address ---
+  eERRORRESULT Error = ERR_NONE;
+  uint64_t Cycles = 0;
+  bool Stop = pPacketDesc->Stop;
+  if (pPacketDesc->Start)
+  {
+    __I2CMemSim_EndTransaction(pSim, false, Now);                                           // A repeated START ends the previous transaction without programming the device
+    const bool Addr10bits = I2C_IS_10BITS_ADDRESS(pPacketDesc->Config.Value);
+    Cycles += I2CMEMSIM_CYCLES_PER_CONDITION + I2CMEMSIM_CYCLES_PER_BYTE * (Addr10bits ? 2u : 1u);
+    pSim->Stats.Starts++;
+    pSim->Stats.Bytes += (Addr10bits ? 2u : 1u);
+    pSim->InTransaction = true;
+    pSim->pCurrent = (Addr10bits ? NULL : __I2CMemSim_SelectDevice(pSim, (uint8_t)pPacketDesc->ChipAddr, Now));
+    if (pSim->pCurrent == NULL)                                                             // No device acknowledges the chip address
+    {
+      Error = ERR_GENERATE(ERR__I2C_NACK);
+      Stop  = true;                                                                         // The master ends the transfer with a STOP after a NACK
+    }
+  }
+  else if ((pSim->InTransaction == false) || (pSim->pCurrent == NULL)) return ERR_GENERATE(ERR__I2C_COMM_ERROR);
+
+  //--- Data ---
+  if (Error == ERR_NONE)
+  {
+    size_t Count = pPacketDesc->BufferSize;
+    for (size_t z = 0; z < pPacketDesc->BufferSize; ++z)
+    {
+      if (pSim->IsRead) pPacketDesc->pBuffer[z] = __I2CMemSim_ReadByte(pSim);
+      else if (__I2CMemSim_WriteByte(pSim, pPacketDesc->pBuffer[z]) == false)               // The device does not acknowledge the data
+      {
+        Count = z + 1;
+        Error = ERR_GENERATE(ERR__I2C_NACK_DATA);
+        Stop  = true;                                                                       // The master ends the transfer with a STOP after a NACK
+        break;
+      }
+    }
+    Cycles += I2CMEMSIM_CYCLES_PER_BYTE * (uint64_t)Count;
+    pSim->Stats.Bytes += Count;
+  }
+  if (Error != ERR_NONE) pSim->Stats.Nacks++;
+
+  //--- Bus time and STOP ---
+  if (Stop)
+  {
+    Cycles += I2CMEMSIM_CYCLES_PER_CONDITION;
+    pSim->Stats.Transactions++;
+  }
+  const uint64_t BusTimens = MemorySim_AddBusActivity(&pSim->Stats, Cycles, pSim->SCLfrequency);
+  if (Stop) __I2CMemSim_EndTransaction(pSim, (Error == ERR_NONE), Now + BusTimens);    // The device starts its internal cycle at the STOP condition
+  if (NonBlocking && Stop && ((Error == ERR_NONE) || pSim->NonBlockingNack))                // The transfer continues in background. The first part of a transaction is always blocking
+  {
+    pSim->NonBlockingEndns  = Now + BusTimens;
+    pSim->NonBlockingError  = Error;                                                        // A NACK is seen at the status check of the transfer
+    pSim->TransactionNumber = (uint8_t)((pSim->TransactionNumber % I2C_TRANSACTION_NUMBER_Mask) + 1u);
+    pPacketDesc->Config.Value &= ~((uint32_t)I2C_TRANSACTION_NUMBER_Mask << I2C_TRANSACTION_NUMBER_Pos);
+    pPacketDesc->Config.Value |= I2C_TRANSACTION_NUMBER_SET(pSim->TransactionNumber);
+    return ERR_GENERATE(ERR__I2C_BUSY);
+  }
+  MemorySim_AdvanceTime(BusTimens);
+  return Error;
+}
+
+
+//=============================================================================
+// Simulated I2C interface packet chain transfer
+//=============================================================================
+eERRORRESULT I2CMemSim_InterfaceTransferChain(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketsDesc, size_t count)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pIntDev == NULL) || (pPacketsDesc == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != I2CMEMSIM_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  I2C_MemorySim* pSim = (I2C_MemorySim*)pIntDev->InterfaceDevice;
+  if (pSim == NULL) return ERR_GENERATE(ERR__I2C_PARAMETER_ERROR);
+  const uint32_t TransferCalls = pSim->Stats.TransferCalls;
+  uint64_t BusTimens = 0;
+  eERRORRESULT Error = ERR_NONE;
+
+  for (size_t zPacket = 0; zPacket < count; ++zPacket)
+  {
+    Error = I2CMemSim_InterfaceTransfer(pIntDev, &pPacketsDesc[zPacket]);
+    BusTimens += pSim->Stats.LastCallBusTimens;
+    if (Error != ERR_NONE) break;                                                           // The transfer stops at the first packet in error (or the last packet in background)
+  }
+  pSim->Stats.TransferCalls     = TransferCalls + 1u;                                       // The whole chain is 1 call
+  pSim->Stats.LastCallBusTimens = BusTimens;
+  return Error;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
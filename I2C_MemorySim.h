@@ -0,0 +1,193 @@
+/*!*****************************************************************************
+ * @file    I2C_MemorySim.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Simulated I2C bus with EEPROM and EERAM devices
+ * @details Host-side I2C interface that can be set in a struct I2C_Interface
+ * instead of a real I2C peripheral. Each simulated device is described by an
+ * #EEPROM_Conf and models:
+ * - The chip address with the A2, A1, and A0 chip select pins and the block bits of the #eEEPROM_AddressType
+ * - The page buffer of the EEPROM with the page roll-over, the data are programmed at the STOP condition
+ * - The NACK of the chip address during the write cycle time (tWR)
+ * - The EERAM 47x04/47x16 SRAM, status register, and STORE/RECALL commands with their busy time
+ * - The SCL-accurate bus time at the frequency set by the interface initialization
+ * Only the generic struct I2C_Interface is supported (not the Arduino, nor the STM32 ones)
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.1.0    Add I2CMemSim_InterfaceTransferChain()
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef I2C_MEMORYSIM_H_INC
+#define I2C_MEMORYSIM_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "I2C_Interface.h"
+#include "EEPROM.h"
+#include "MemorySim.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define I2CMEMSIM_UNIQUE_ID                 ( 0x4932434Du ) //!< Unique ID of the simulated I2C interface, to set in the I2C_Interface.UniqueID
+#define I2CMEMSIM_PAGE_LATCH_SIZE           ( 512u )        //!< Maximum page size of a simulated EEPROM device
+
+#define I2CMEMSIM_CYCLES_PER_BYTE           ( 9u )          //!< SCL clock cycles per byte (8 data bits + ACK/NACK bit)
+#define I2CMEMSIM_CYCLES_PER_CONDITION      ( 1u )          //!< SCL clock cycles per START, repeated START, or STOP condition
+
+#define I2CMEMSIM_EERAM_REG_CHIPADDRESS     ( 0x30u )       //!< EERAM control register chip base address
+#define I2CMEMSIM_EERAM_STATUS_REGISTER     ( 0x00u )       //!< EERAM status register address
+#define I2CMEMSIM_EERAM_COMMAND_REGISTER    ( 0x55u )       //!< EERAM command register address
+#define I2CMEMSIM_EERAM_STORE_COMMAND       ( 0x33u )       //!< EERAM command to store SRAM data to EEPROM
+#define I2CMEMSIM_EERAM_RECALL_COMMAND      ( 0xDDu )       //!< EERAM command to recall data from EEPROM to SRAM
+#define I2CMEMSIM_EERAM_ARRAY_MODIFIED      ( 0x80u )       //!< EERAM status register AM bit
+#define I2CMEMSIM_EERAM_STATUS_WRITABLE     ( 0x1Fu )       //!< EERAM status register writable bits (BP, ASE, EVENT)
+#define I2CMEMSIM_EERAM_RECALL_DEFAULT_US   ( 5000u )       //!< EERAM default recall time if the device RecallTimeus is 0
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Simulated device
+//********************************************************************************************************************
+
+//! Simulated I2C memory device type enumerator
+typedef enum
+{
+  I2CMEMSIM_EEPROM      = 0, //!< I2C EEPROM device (AT24Cxx, 24XX256, AT24CM02, AT24MACx02, ...)
+  I2CMEMSIM_EERAM47xxx  = 1, //!< I2C EERAM device (47x04, 47x16) with SRAM at the EEPROM_Conf.ChipAddress and control registers at the chip address 0x30
+} eI2CMemSim_DeviceType;
+
+
+//! Simulated I2C memory device
+typedef struct I2CMemSim_Device
+{
+  eI2CMemSim_DeviceType Type;  //!< Type of the device
+  const EEPROM_Conf *Conf;     //!< Configuration of the device, this parameter is mandatory. The device memory is Conf->OffsetAddress + Conf->TotalByteSize bytes
+  uint8_t AddrA2A1A0;          //!< Level of the chip select pins A2, A1, and A0 of the device. Same format as EEPROM.AddrA2A1A0
+  uint8_t* Memory;             //!< Memory array of the device of Conf->OffsetAddress + Conf->TotalByteSize bytes, this parameter is mandatory
+  uint32_t WriteCycleTimeus;   //!< Write cycle time of a page (EEPROM) or store time (EERAM) in microseconds. Set 0 to use Conf->PageWriteTime
+  uint32_t RecallTimeus;       //!< Recall time (EERAM only) in microseconds. Set 0 to use #I2CMEMSIM_EERAM_RECALL_DEFAULT_US
+  bool ReadRollOverInBlock;    //!< 'true' if the address counter of the reads rolls over inside the block selected by the Ax bits, else it rolls over the whole memory (EEPROM with Ax bits only)
+
+  //--- Simulation state ---
+  uint32_t AddressCounter;     //!< Internal address counter of the device
+  uint64_t BusyUntilns;        //!< The device does not acknowledge its chip address until this simulated time
+  uint8_t StatusRegister;      //!< Status register of the device (EERAM only)
+  uint8_t PendingCommand;      //!< Command received and to execute at the STOP condition (EERAM only)
+  uint32_t WriteCycles;        //!< Count of page programming (EEPROM) or store operations (EERAM) since the device declaration
+} I2CMemSim_Device;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Simulated I2C bus
+//********************************************************************************************************************
+
+//! Simulated I2C bus object structure
+typedef struct I2C_MemorySim
+{
+  I2CMemSim_Device* Devices;          //!< Array of the devices on the bus, this parameter is mandatory
+  size_t DeviceCount;                 //!< Count of devices in the Devices array
+  bool SupportNonBlocking;            //!< 'true' = the last packet of a transaction with I2C_USE_NON_BLOCKING is simulated as a DMA transfer in background ; 'false' = all packets are blocking transfers
+  bool NonBlockingNack;               //!< 'true' = a NACK during a non-blocking transfer is returned by the status check of the transfer, as with a DMA ; 'false' = it is returned by the transfer call
+  MemorySim_BusStats Stats;           //!< Bus statistics, use I2CMemSim_ResetStats() to clear
+
+  //--- Simulation state ---
+  uint32_t SCLfrequency;              //!< SCL frequency in Hertz set at the interface initialization
+  I2CMemSim_Device* pCurrent;         //!< Device addressed by the current transaction, NULL if no device
+  bool InTransaction;                 //!< A START has been sent and no STOP yet
+  bool IsRead;                        //!< The current transaction is a read
+  bool IsRegister;                    //!< The current transaction is on the EERAM control registers
+  uint8_t AddrBytesLeft;              //!< Count of word address bytes left to receive
+  uint32_t WordAddress;               //!< Word address being received (including the block bits of the chip address)
+  uint8_t RegisterAddress;            //!< EERAM control register address
+  uint32_t LatchPageBase;             //!< Base address of the page in the page latch
+  uint32_t LatchPos;                  //!< Current position in the page latch
+  uint32_t LatchCount;                //!< Count of bytes received in the page latch
+  uint8_t Latch[I2CMEMSIM_PAGE_LATCH_SIZE];          //!< Page latch of the EEPROM being written
+  uint8_t LatchMask[I2CMEMSIM_PAGE_LATCH_SIZE / 8];  //!< Bytes of the page latch that have been written
+  uint64_t NonBlockingEndns;          //!< Simulated time of the end of the current non-blocking transfer
+  uint8_t TransactionNumber;          //!< Transaction number of the last non-blocking transfer (1 to 63)
+  eERRORRESULT NonBlockingError;      //!< Result of the last non-blocking transfer, returned once by its status check
+} I2C_MemorySim;
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Simulated I2C interface initialization
+ *
+ * Set this function in the I2C_Interface.fnI2C_Init of the driver with I2C_Interface.InterfaceDevice pointing to an #I2C_MemorySim and I2C_Interface.UniqueID set to #I2CMEMSIM_UNIQUE_ID
+ * It checks the devices and sets the SCL frequency. The memory of the devices is not changed
+ * @param[in] *pIntDev Is the I2C interface container structure used for the interface initialization
+ * @param[in] sclFreq Is the SCL frequency in Hz to set at the interface initialization
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT I2CMemSim_InterfaceInit(I2C_Interface *pIntDev, const uint32_t sclFreq);
+
+/*! @brief Simulated I2C interface transfer
+ *
+ * Set this function in the I2C_Interface.fnI2C_Transfer of the driver. The simulated time advances by the bus time of the packet for a blocking transfer
+ * The bus time of the call is available in I2C_MemorySim.Stats.LastCallBusTimens
+ * @param[in] *pIntDev Is the I2C interface container structure used for the communication
+ * @param[in] *pPacketDesc Is the packet description to transfer through I2C
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT I2CMemSim_InterfaceTransfer(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc);
+
+/*! @brief Simulated I2C interface packet chain transfer
+ *
+ * Set this function in the I2C_Interface.fnI2C_TransferChain of the driver. The packets are transferred as with I2CMemSim_InterfaceTransfer() but the chain counts as 1 call in I2C_MemorySim.Stats.TransferCalls
+ * @param[in] *pIntDev Is the I2C interface container structure used for the communication
+ * @param[in] *pPacketsDesc Is the array of the packet descriptions to transfer through I2C
+ * @param[in] count Is the count of packets in the array
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT I2CMemSim_InterfaceTransferChain(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketsDesc, size_t count);
+
+/*! @brief Reset the statistics of a simulated I2C bus
+ *
+ * @param[in] *pSim Is the pointed structure of the simulated bus
+ */
+void I2CMemSim_ResetStats(I2C_MemorySim *pSim);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* I2C_MEMORYSIM_H_INC */
@@ -0,0 +1,192 @@
+/*!*****************************************************************************
+ * @file    MemoryBench.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Throughput and latency measurement of the drivers on simulated buses
+ * @details Host-side helper that runs a driver function on a simulated bus and
+ * reports its throughput, CPU cost, transaction count, and latency
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryBench.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__MEMORYBENCH // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Reset the accumulated results of a benchmark
+//=============================================================================
+void MemoryBench_Reset(MemoryBench *pBench)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pBench == NULL) return;
+#endif
+  pBench->Calls        = 0;
+  pBench->PayloadBytes = 0;
+  pBench->Elapsedns    = 0;
+  pBench->BusTimens    = 0;
+  pBench->Transactions = 0;
+  pBench->HostCPUns    = 0;
+  pBench->LatencyCount = 0;
+}
+
+
+//=============================================================================
+// Run one call of the measured function and accumulate its results
+//=============================================================================
+eERRORRESULT MemoryBench_Run(MemoryBench *pBench, uint32_t address, uint8_t* data, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pBench == NULL) || (data == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if ((pBench->fnOperation == NULL) || (pBench->pBusStats == NULL)) return ERR_GENERATE(ERR__CONFIGURATION);
+  const MemorySim_BusStats StartStats = *pBench->pBusStats;
+  const uint64_t StartHostns = (pBench->fnGetHostns != NULL ? pBench->fnGetHostns() : 0);
+  const uint64_t StartTimens = MemorySim_GetTimens();
+
+  //--- Run the operation ---
+  const eERRORRESULT Error = pBench->fnOperation(pBench->pContext, address, data, size);
+
+  //--- Accumulate the results ---
+  const uint64_t Latencyns = MemorySim_GetTimens() - StartTimens;
+  if (pBench->fnGetHostns != NULL) pBench->HostCPUns += pBench->fnGetHostns() - StartHostns;
+  pBench->Calls++;
+  pBench->PayloadBytes += size;
+  pBench->Elapsedns    += Latencyns;
+  pBench->BusTimens    += pBench->pBusStats->BusTimens - StartStats.BusTimens;
+  pBench->Transactions += pBench->pBusStats->Transactions - StartStats.Transactions;
+  if ((pBench->Latencies != NULL) && (pBench->LatencyCount < pBench->LatencyCapacity)) pBench->Latencies[pBench->LatencyCount++] = Latencyns;
+  return Error;
+}
+
+
+//=============================================================================
+// Run the measured function for all the sizes at all the address offsets
+//=============================================================================
+eERRORRESULT MemoryBench_Sweep(MemoryBench *pBench, uint32_t baseAddress, uint8_t* data, const size_t* sizes, size_t sizeCount, const uint32_t* offsets, size_t offsetCount, MemoryBench_Report* sizeReports)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pBench == NULL) || (data == NULL) || (sizes == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (offsets == NULL) offsetCount = 1;
+  eERRORRESULT Error;
+  for (size_t s = 0; s < sizeCount; ++s)
+  {
+    const MemoryBench Start = *pBench;                                       // Accumulated results before this size
+    for (size_t o = 0; o < offsetCount; ++o)
+    {
+      const uint32_t Address = baseAddress + (offsets != NULL ? offsets[o] : 0u);
+      Error = MemoryBench_Run(pBench, Address, data, sizes[s]);
+      if (Error != ERR_NONE) return Error;                                   // If there is an error while calling MemoryBench_Run() then return the error
+    }
+
+    //--- Report of this size only ---
+    if (sizeReports != NULL)
+    {
+      MemoryBench SizeBench = *pBench;
+      SizeBench.Calls        -= Start.Calls;
+      SizeBench.PayloadBytes -= Start.PayloadBytes;
+      SizeBench.Elapsedns    -= Start.Elapsedns;
+      SizeBench.BusTimens    -= Start.BusTimens;
+      SizeBench.Transactions -= Start.Transactions;
+      SizeBench.HostCPUns    -= Start.HostCPUns;
+      SizeBench.LatencyCount -= Start.LatencyCount;
+      if (SizeBench.Latencies != NULL) SizeBench.Latencies += Start.LatencyCount; // The latencies of this size follow the ones of the previous sizes
+      Error = MemoryBench_GetReport(&SizeBench, &sizeReports[s]);
+      if ((Error != ERR_NONE) && (ERR_ERROR_Get(Error) != ERR__NO_DATA_AVAILABLE)) return Error; // A size of 0 has no payload to report
+    }
+  }
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Compare two latencies for qsort()
+//=============================================================================
+static int __MemoryBench_CompareLatencies(const void* pA, const void* pB)
+{
+  const uint64_t A = *(const uint64_t*)pA;
+  const uint64_t B = *(const uint64_t*)pB;
+  return (A > B) - (A < B);
+}
+
+
+//=============================================================================
+// [STATIC] Get a percentile of sorted latencies (nearest-rank method)
+//=============================================================================
+static uint64_t __MemoryBench_Percentile(const uint64_t* sorted, size_t count, uint32_t percent)
+{
+  if (count == 0) return 0;
+  size_t Rank = (size_t)(((uint64_t)count * percent + 99u) / 100u); // Ceil of count x percent / 100
+  if (Rank == 0) Rank = 1;
+  return sorted[Rank - 1];
+}
+
+
+//=============================================================================
+// Get the report of the accumulated results
+//=============================================================================
+eERRORRESULT MemoryBench_GetReport(MemoryBench *pBench, MemoryBench_Report* pReport)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pBench == NULL) || (pReport == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  memset(pReport, 0, sizeof(MemoryBench_Report));
+  if (pBench->PayloadBytes == 0) return ERR_GENERATE(ERR__NO_DATA_AVAILABLE);
+  if (pBench->Elapsedns > 0) pReport->BytesPerSecond    = (pBench->PayloadBytes * 1000000000ull) / pBench->Elapsedns;
+  if (pBench->BusTimens > 0) pReport->BusBytesPerSecond = (pBench->PayloadBytes * 1000000000ull) / pBench->BusTimens;
+  pReport->CPUnsPerByte      = (uint32_t)(pBench->HostCPUns / pBench->PayloadBytes);
+  pReport->TransactionsPerKB = (uint32_t)(((uint64_t)pBench->Transactions * 1024u + (pBench->PayloadBytes - 1u)) / pBench->PayloadBytes); // Round up
+  if (pBench->Latencies != NULL)
+  {
+    qsort(pBench->Latencies, pBench->LatencyCount, sizeof(uint64_t), __MemoryBench_CompareLatencies);
+    pReport->P50ns = __MemoryBench_Percentile(pBench->Latencies, pBench->LatencyCount, 50);
+    pReport->P99ns = __MemoryBench_Percentile(pBench->Latencies, pBench->LatencyCount, 99);
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Check a report against a budget
+//=============================================================================
+eERRORRESULT MemoryBench_CheckBudget(const MemoryBench_Report* pReport, const MemoryBench_Budget* pBudget)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pReport == NULL) || (pBudget == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if ((pBudget->MinBytesPerSecond    > 0) && (pReport->BytesPerSecond    < pBudget->MinBytesPerSecond   )) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  if ((pBudget->MinBusBytesPerSecond > 0) && (pReport->BusBytesPerSecond < pBudget->MinBusBytesPerSecond)) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  if ((pBudget->MaxCPUnsPerByte      > 0) && (pReport->CPUnsPerByte      > pBudget->MaxCPUnsPerByte     )) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  if ((pBudget->MaxTransactionsPerKB > 0) && (pReport->TransactionsPerKB > pBudget->MaxTransactionsPerKB)) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  if ((pBudget->MaxP50ns             > 0) && (pReport->P50ns             > pBudget->MaxP50ns            )) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  if ((pBudget->MaxP99ns             > 0) && (pReport->P99ns             > pBudget->MaxP99ns            )) return ERR_GENERATE(ERR__OUT_OF_RANGE);
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
@@ -0,0 +1,190 @@
+/*!*****************************************************************************
+ * @file    MemoryBench.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Throughput and latency measurement of the drivers on simulated buses
+ * @details Host-side helper that runs a driver function over sizes and address
+ * alignments on a simulated bus (I2C_MemorySim or SPI_MemorySim) and reports:
+ * - The payload bytes per second of simulated time and of bus time
+ * - The host CPU nanoseconds per payload byte (if a host time function is given)
+ * - The bus transactions per KB of payload
+ * - The p50 and p99 latency of the calls in simulated time, overall and per size
+ * A report can be checked against a budget so that a performance regression
+ * returns an error
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.1.0    Add the report of each size to MemoryBench_Sweep()
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef MEMORYBENCH_H_INC
+#define MEMORYBENCH_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "MemorySim.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+/*! @brief Function of a driver to measure
+ *
+ * Wrap the driver function to measure in this prototype (ex: call EEPROM_WriteData() with the EEPROM set in pContext)
+ * @param[in] *pContext Is the MemoryBench.pContext value
+ * @param[in] address Is the address of the operation
+ * @param[in,out] *data Is the data buffer of the operation
+ * @param[in] size Is the size of the operation
+ * @return Returns an #eERRORRESULT value enum
+ */
+typedef eERRORRESULT (*MemoryBench_Func)(void *pContext, uint32_t address, uint8_t* data, size_t size);
+
+/*! @brief Function that gives the current host time
+ *
+ * @return Returns the current host time in nanoseconds (ex: CLOCK_MONOTONIC or QueryPerformanceCounter converted to ns)
+ */
+typedef uint64_t (*MemoryBench_GetHostns_Func)(void);
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Benchmark objects
+//********************************************************************************************************************
+
+//! Benchmark object structure
+typedef struct MemoryBench
+{
+  MemoryBench_Func fnOperation;           //!< Driver function to measure, this parameter is mandatory
+  void *pContext;                         //!< Context given to fnOperation
+  MemorySim_BusStats* pBusStats;          //!< Statistics of the simulated bus used by the driver (I2C_MemorySim.Stats or SPI_MemorySim.Stats), this parameter is mandatory
+  MemoryBench_GetHostns_Func fnGetHostns; //!< Host time function to measure the CPU time of the driver. Can be NULL, then MemoryBench_Report.CPUnsPerByte is 0
+  uint64_t* Latencies;                    //!< Array where the latency of each call is stored. Can be NULL, then MemoryBench_Report.P50ns and P99ns are 0
+  size_t LatencyCapacity;                 //!< Count of items of the Latencies array. The latencies of the calls after this count are not used for the percentiles
+
+  //--- Accumulated results, cleared by MemoryBench_Reset() ---
+  uint32_t Calls;                         //!< Count of calls of fnOperation
+  uint64_t PayloadBytes;                  //!< Count of payload bytes of the calls
+  uint64_t Elapsedns;                     //!< Simulated time spent in the calls in nanoseconds
+  uint64_t BusTimens;                     //!< Bus time of the calls in nanoseconds
+  uint32_t Transactions;                  //!< Count of bus transactions of the calls
+  uint64_t HostCPUns;                     //!< Host time spent in the calls in nanoseconds
+  size_t LatencyCount;                    //!< Count of latencies stored in the Latencies array
+} MemoryBench;
+
+
+//! Benchmark report structure
+typedef struct MemoryBench_Report
+{
+  uint64_t BytesPerSecond;                //!< Payload bytes per second of simulated time (includes the device internal cycles and the polling)
+  uint64_t BusBytesPerSecond;             //!< Payload bytes per second of bus time
+  uint32_t CPUnsPerByte;                  //!< Host CPU nanoseconds per payload byte
+  uint32_t TransactionsPerKB;             //!< Bus transactions per 1024 payload bytes
+  uint64_t P50ns;                         //!< Median latency of a call in simulated nanoseconds
+  uint64_t P99ns;                         //!< 99th percentile latency of a call in simulated nanoseconds
+} MemoryBench_Report;
+
+
+//! Benchmark budget structure. A field at 0 is not checked
+typedef struct MemoryBench_Budget
+{
+  uint64_t MinBytesPerSecond;             //!< Minimum payload bytes per second of simulated time
+  uint64_t MinBusBytesPerSecond;          //!< Minimum payload bytes per second of bus time
+  uint32_t MaxCPUnsPerByte;               //!< Maximum host CPU nanoseconds per payload byte
+  uint32_t MaxTransactionsPerKB;          //!< Maximum bus transactions per 1024 payload bytes
+  uint64_t MaxP50ns;                      //!< Maximum median latency in simulated nanoseconds
+  uint64_t MaxP99ns;                      //!< Maximum 99th percentile latency in simulated nanoseconds
+} MemoryBench_Budget;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Benchmark API
+//********************************************************************************************************************
+
+/*! @brief Reset the accumulated results of a benchmark
+ *
+ * @param[in] *pBench Is the pointed structure of the benchmark
+ */
+void MemoryBench_Reset(MemoryBench *pBench);
+
+/*! @brief Run one call of the measured function and accumulate its results
+ *
+ * @param[in] *pBench Is the pointed structure of the benchmark
+ * @param[in] address Is the address of the operation
+ * @param[in,out] *data Is the data buffer of the operation
+ * @param[in] size Is the size of the operation
+ * @return Returns an #eERRORRESULT value enum, the error of the measured function if any
+ */
+eERRORRESULT MemoryBench_Run(MemoryBench *pBench, uint32_t address, uint8_t* data, size_t size);
+
+/*! @brief Run the measured function for all the sizes at all the address offsets
+ *
+ * The function is called sizeCount x offsetCount times at address baseAddress + offsets[o] with a size of sizes[s]
+ * @param[in] *pBench Is the pointed structure of the benchmark
+ * @param[in] baseAddress Is the base address of the operations
+ * @param[in,out] *data Is the data buffer of the operations, it shall be at least the biggest size
+ * @param[in] *sizes Is the array of the sizes to sweep
+ * @param[in] sizeCount Is the count of sizes
+ * @param[in] *offsets Is the array of the address offsets to sweep (ex: 0 for aligned, 1 and PageSize-1 for unaligned). Can be NULL, then only the offset 0 is used
+ * @param[in] offsetCount Is the count of offsets
+ * @param[out] *sizeReports Is an array of sizeCount reports where the report of the calls of each size will be stored, the latencies of a size are not mixed with the other sizes. Can be NULL
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT MemoryBench_Sweep(MemoryBench *pBench, uint32_t baseAddress, uint8_t* data, const size_t* sizes, size_t sizeCount, const uint32_t* offsets, size_t offsetCount, MemoryBench_Report* sizeReports);
+
+/*! @brief Get the report of the accumulated results
+ *
+ * @note The Latencies array is sorted by this function
+ * @param[in] *pBench Is the pointed structure of the benchmark
+ * @param[out] *pReport Is where the report will be stored
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT MemoryBench_GetReport(MemoryBench *pBench, MemoryBench_Report* pReport);
+
+/*! @brief Check a report against a budget
+ *
+ * @param[in] *pReport Is the report to check
+ * @param[in] *pBudget Is the budget to respect
+ * @return Returns ERR_NONE if the budget is respected or ERR__OUT_OF_RANGE if at least one value is out of the budget
+ */
+eERRORRESULT MemoryBench_CheckBudget(const MemoryBench_Report* pReport, const MemoryBench_Budget* pBudget);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* MEMORYBENCH_H_INC */
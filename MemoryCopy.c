@@ -0,0 +1,168 @@
+/*!*****************************************************************************
+ * @file    MemoryCopy.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Pipelined copy between 2 memory devices
+ * @details Copy engine that reads the next chunk of the source device while
+ * the current chunk is written to the destination device
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "MemoryCopy.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__MEMORYCOPY // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// Start or check the transfer of the next chunk to read or to write (DO NOT USE DIRECTLY)
+static void __MemoryCopy_Transfer(MemoryCopy *pCopy, bool isWrite);
+//-----------------------------------------------------------------------------
+#define MEMORYCOPY_IS_BUSY(error)  ( ((error) == ERR__BUSY) || ((error) == ERR__I2C_BUSY) || ((error) == ERR__SPI_BUSY) || ((error) == ERR__I2C_OTHER_BUSY) || ((error) == ERR__SPI_OTHER_BUSY) )
+#define MEMORYCOPY_CHUNK_BUFFER(pCopy,offset)  ( &(pCopy)->Buffer[(((offset) / (pCopy)->ChunkSize) & 1u) * (pCopy)->ChunkSize] )
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Memory copy initialization
+//=============================================================================
+eERRORRESULT Init_MemoryCopy(MemoryCopy *pCopy)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pCopy == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if ((pCopy->Source.fnTransfer == NULL) || (pCopy->Destination.fnTransfer == NULL)) return ERR_GENERATE(ERR__CONFIGURATION);
+  if ((pCopy->Buffer == NULL) || (pCopy->ChunkSize == 0)) return ERR_GENERATE(ERR__CONFIGURATION);
+
+  //--- Reset the state ---
+  pCopy->SourceAddress      = 0;
+  pCopy->DestinationAddress = 0;
+  pCopy->Size               = 0;
+  pCopy->ReadOffset         = 0;
+  pCopy->WriteOffset        = 0;
+  pCopy->Reading            = false;
+  pCopy->Writing            = false;
+  pCopy->Error              = ERR_NONE;
+  return ERR_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Start a copy of an area of the source device to the destination device
+//=============================================================================
+eERRORRESULT MemoryCopy_Start(MemoryCopy *pCopy, uint32_t sourceAddress, uint32_t destinationAddress, size_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pCopy == NULL) || (pCopy->Buffer == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pCopy->Reading || pCopy->Writing) return ERR_GENERATE(ERR__BUSY);                 // The transfers of the previous copy are still in progress
+
+  //--- Prepare the copy ---
+  pCopy->SourceAddress      = sourceAddress;
+  pCopy->DestinationAddress = destinationAddress;
+  pCopy->Size               = size;
+  pCopy->ReadOffset         = 0;
+  pCopy->WriteOffset        = 0;
+  pCopy->Error              = ERR_NONE;
+  return MemoryCopy_Poll(pCopy);                                                        // Start the read of the first chunk
+}
+
+
+//=============================================================================
+// Poll a copy
+//=============================================================================
+eERRORRESULT MemoryCopy_Poll(MemoryCopy *pCopy)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pCopy == NULL) || (pCopy->Buffer == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+
+  //--- Check the transfers in progress ---
+  if (pCopy->Reading) __MemoryCopy_Transfer(pCopy, false);
+  if (pCopy->Writing) __MemoryCopy_Transfer(pCopy, true);
+
+  //--- Start the next transfers ---
+  if (pCopy->Error == ERR_NONE)
+  {
+    const bool BufferFree = ((pCopy->ReadOffset - pCopy->WriteOffset) < (2u * pCopy->ChunkSize)); // The chunk being written and the chunk read ahead use the 2 buffers
+    if ((pCopy->Reading == false) && (pCopy->ReadOffset < pCopy->Size) && BufferFree)
+      __MemoryCopy_Transfer(pCopy, false);                                              // The read is started first, to be in the background of a blocking write
+    if ((pCopy->Writing == false) && (pCopy->WriteOffset < pCopy->ReadOffset) && (pCopy->Error == ERR_NONE))
+      __MemoryCopy_Transfer(pCopy, true);
+  }
+
+  //--- Get the state of the copy ---
+  if (pCopy->Reading || pCopy->Writing) return ERR_GENERATE(ERR__BUSY);                 // Wait the end of the transfers in progress, even after an error, before releasing the buffers
+  if (pCopy->Error != ERR_NONE) return pCopy->Error;
+  if (pCopy->WriteOffset < pCopy->Size) return ERR_GENERATE(ERR__BUSY);
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Start or check the transfer of the next chunk to read or to write
+//=============================================================================
+void __MemoryCopy_Transfer(MemoryCopy *pCopy, bool isWrite)
+{
+  size_t* const pOffset = (isWrite ? &pCopy->WriteOffset : &pCopy->ReadOffset);
+  bool* const pInProgress = (isWrite ? &pCopy->Writing : &pCopy->Reading);
+  const MemoryCopy_Device* const pDevice = (isWrite ? &pCopy->Destination : &pCopy->Source);
+  const uint32_t Address = (isWrite ? pCopy->DestinationAddress : pCopy->SourceAddress) + (uint32_t)(*pOffset);
+  const size_t ChunkSize = ((pCopy->Size - *pOffset) < pCopy->ChunkSize ? (pCopy->Size - *pOffset) : pCopy->ChunkSize);
+
+  eERRORRESULT Error = pDevice->fnTransfer(pDevice->pContext, Address, MEMORYCOPY_CHUNK_BUFFER(pCopy, *pOffset), ChunkSize);
+  *pInProgress = MEMORYCOPY_IS_BUSY(ERR_ERROR_Get(Error));                              // The transfer continues in the background or waits its device
+  if (*pInProgress) return;
+  if (Error == ERR_NONE) *pOffset += ChunkSize;                                         // The chunk is complete, continue with the next one
+  else if (pCopy->Error == ERR_NONE) pCopy->Error = Error;                              // Keep the first error, the copy stops
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Copy an area of the source device to the destination device
+//=============================================================================
+eERRORRESULT MemoryCopy_Copy(MemoryCopy *pCopy, uint32_t sourceAddress, uint32_t destinationAddress, size_t size)
+{
+  eERRORRESULT Error = MemoryCopy_Start(pCopy, sourceAddress, destinationAddress, size);
+  while (ERR_ERROR_Get(Error) == ERR__BUSY)
+    Error = MemoryCopy_Poll(pCopy);                                                     // Move the copy forward until its end
+  return Error;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
@@ -0,0 +1,161 @@
+/*!*****************************************************************************
+ * @file    MemoryCopy.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Pipelined copy between 2 memory devices
+ * @details Copy engine that moves an area of a source device to a destination
+ * device (ex: I2C EEPROM to SPI SRAM, SPI EERAM to I2C EEPROM) through 2 chunk
+ * buffers given by the user. While the chunk N is written to the destination,
+ * the chunk N+1 is read from the source, so with 2 devices that work in the
+ * background (DMA transfers, EEPROM write cycles) the copy time approaches the
+ * longest of the read time and of the write time instead of their sum.
+ * Each device is given by a transfer function that follows the ...WithDMA()
+ * functions of the drivers: the first call starts the transfer of a chunk and
+ * the next calls with the same parameters return its state. A blocking driver
+ * function can be used as is, it completes at the first call
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef MEMORYCOPY_H_INC
+#define MEMORYCOPY_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ErrorsDef.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+/*! @brief Function that starts or checks the transfer of a chunk with a device
+ *
+ * Wrap the driver function to use in this prototype (ex: call EERAM48LM01_ReadSRAMDataWithDMA() with the EERAM48LM01 set in pContext, or EEPROM_StartWriteData() then EEPROM_PollTransfer() with an EEPROM_AsyncTransfer)
+ * The first call starts the transfer of the chunk. While the function returns a busy error, it is called again with the same parameters to get the state of the transfer
+ * @param[in] *pContext Is the MemoryCopy_Device.pContext value
+ * @param[in] address Is the address of the chunk in the device
+ * @param[in,out] *data Is the chunk buffer, where the data read are stored or the data to write
+ * @param[in] size Is the size of the chunk
+ * @return Returns ERR_NONE if the transfer is complete, ERR__BUSY, ERR__I2C_BUSY, ERR__SPI_BUSY, ERR__I2C_OTHER_BUSY, or ERR__SPI_OTHER_BUSY if the transfer is in progress or not started yet, else an #eERRORRESULT value enum
+ */
+typedef eERRORRESULT (*MemoryCopy_Transfer_Func)(void *pContext, uint32_t address, uint8_t* data, size_t size);
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Memory copy objects
+//********************************************************************************************************************
+
+//! Memory copy device structure
+typedef struct MemoryCopy_Device
+{
+  MemoryCopy_Transfer_Func fnTransfer;  //!< Read function of the source or write function of the destination, this parameter is mandatory
+  void *pContext;                       //!< Context given to fnTransfer
+} MemoryCopy_Device;
+
+
+//! Memory copy object structure
+typedef struct MemoryCopy
+{
+  MemoryCopy_Device Source;             //!< Device where the data are read
+  MemoryCopy_Device Destination;        //!< Device where the data are written
+  uint8_t* Buffer;                      //!< Buffer of 2 chunks (2 x ChunkSize bytes), this parameter is mandatory
+  size_t ChunkSize;                     //!< Size of a chunk. With an EEPROM destination, a multiple of its page size gives full page writes
+
+  //--- Copy state ---
+  uint32_t SourceAddress;               //!< Address of the area in the source device
+  uint32_t DestinationAddress;          //!< Address of the area in the destination device
+  size_t Size;                          //!< Size of the area to copy
+  size_t ReadOffset;                    //!< Offset in the area of the next chunk to read
+  size_t WriteOffset;                   //!< Offset in the area of the next chunk to write
+  bool Reading;                         //!< 'true' if the read of the chunk at ReadOffset is in progress
+  bool Writing;                         //!< 'true' if the write of the chunk at WriteOffset is in progress
+  eERRORRESULT Error;                   //!< First error of the copy, the copy stops at the end of the transfer in progress
+} MemoryCopy;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Memory copy API
+//********************************************************************************************************************
+
+/*! @brief Memory copy initialization
+ *
+ * This function checks the configuration of the copy engine
+ * @param[in] *pCopy Is the pointed structure of the copy engine to be initialized
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT Init_MemoryCopy(MemoryCopy *pCopy);
+
+/*! @brief Start a copy of an area of the source device to the destination device
+ *
+ * This function starts the read of the first chunk and returns. Call MemoryCopy_Poll() until it returns something else than ERR__BUSY
+ * @param[in] *pCopy Is the pointed structure of the copy engine to be used
+ * @param[in] sourceAddress Is the address of the area in the source device
+ * @param[in] destinationAddress Is the address of the area in the destination device
+ * @param[in] size Is the size of the area to copy
+ * @return Returns ERR__BUSY if the copy is in progress, ERR_NONE if already complete, else an #eERRORRESULT value enum
+ */
+eERRORRESULT MemoryCopy_Start(MemoryCopy *pCopy, uint32_t sourceAddress, uint32_t destinationAddress, size_t size);
+
+/*! @brief Poll a copy
+ *
+ * This function checks the transfers in progress, starts the read of the next chunk when a buffer is free and the write of the next chunk when it is read. The read is started first, so a blocking write overlaps a background read and a blocking read overlaps a background write
+ * @param[in] *pCopy Is the pointed structure of the copy engine to be used
+ * @return Returns ERR__BUSY if the copy is in progress, ERR_NONE if complete, else the first error of the copy once the transfer in progress has ended
+ */
+eERRORRESULT MemoryCopy_Poll(MemoryCopy *pCopy);
+
+/*! @brief Copy an area of the source device to the destination device
+ *
+ * This function starts the copy with MemoryCopy_Start() then calls MemoryCopy_Poll() until the end of the copy
+ * @param[in] *pCopy Is the pointed structure of the copy engine to be used
+ * @param[in] sourceAddress Is the address of the area in the source device
+ * @param[in] destinationAddress Is the address of the area in the destination device
+ * @param[in] size Is the size of the area to copy
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT MemoryCopy_Copy(MemoryCopy *pCopy, uint32_t sourceAddress, uint32_t destinationAddress, size_t size);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* MEMORYCOPY_H_INC */
@@ -0,0 +1,115 @@
+/*!*****************************************************************************
+ * @file    MemorySim.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Simulated time base for the memory bus simulators
+ * @details Host-side time base shared by the I2C and SPI memory simulators.
+ * The time only advances with the simulated bus activity, the polling of the
+ * time functions and the explicit calls to MemorySim_AdvanceTime(). This gives
+ * deterministic bus-time measurements of the drivers on any build machine
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "MemorySim.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+static uint64_t __MemorySim_Timens = 0;                                       //!< Current simulated time in nanoseconds
+static uint32_t __MemorySim_PollingCostns = MEMORYSIM_DEFAULT_POLLING_COST_NS; //!< Simulated time consumed by a time function call
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Reset the simulated time base
+//=============================================================================
+void MemorySim_ResetTime(void)
+{
+  __MemorySim_Timens = 0;
+  __MemorySim_PollingCostns = MEMORYSIM_DEFAULT_POLLING_COST_NS;
+}
+
+
+//=============================================================================
+// Set the simulated CPU time consumed by each call of a time function
+//=============================================================================
+void MemorySim_SetPollingCost(uint32_t pollingCostns)
+{
+  __MemorySim_PollingCostns = pollingCostns;
+}
+
+
+//=============================================================================
+// Advance the simulated time
+//=============================================================================
+void MemorySim_AdvanceTime(uint64_t timens)
+{
+  __MemorySim_Timens += timens;
+}
+
+
+//=============================================================================
+// Get the current simulated time without polling cost
+//=============================================================================
+uint64_t MemorySim_GetTimens(void)
+{
+  return __MemorySim_Timens;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Gives the current simulated millisecond to a driver
+//=============================================================================
+uint32_t MemorySim_GetCurrentms(void)
+{
+  __MemorySim_Timens += __MemorySim_PollingCostns;
+  return (uint32_t)(__MemorySim_Timens / 1000000u);
+}
+
+
+//=============================================================================
+// Gives the current simulated microsecond to a driver
+//=============================================================================
+uint32_t MemorySim_GetCurrentus(void)
+{
+  __MemorySim_Timens += __MemorySim_PollingCostns;
+  return (uint32_t)(__MemorySim_Timens / 1000u);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Add a bus activity to bus statistics
+//=============================================================================
+uint64_t MemorySim_AddBusActivity(MemorySim_BusStats* pStats, uint64_t clockCycles, uint32_t clockFreq)
+{
+  if (clockFreq == 0) return 0;
+  const uint64_t BusTimens = (clockCycles * 1000000000ull + (clockFreq - 1)) / clockFreq; // Round up to the next nanosecond
+  if (pStats != NULL)
+  {
+    pStats->ClockCycles += clockCycles;
+    pStats->BusTimens   += BusTimens;
+    pStats->LastCallBusTimens += BusTimens;
+  }
+  return BusTimens;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
@@ -0,0 +1,147 @@
+/*!*****************************************************************************
+ * @file    MemorySim.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Simulated time base for the memory bus simulators
+ * @details Host-side time base shared by the I2C and SPI memory simulators.
+ * The time only advances with the simulated bus activity, the polling of the
+ * time functions and the explicit calls to MemorySim_AdvanceTime(). This gives
+ * deterministic bus-time measurements of the drivers on any build machine
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef MEMORYSIM_H_INC
+#define MEMORYSIM_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define MEMORYSIM_DEFAULT_POLLING_COST_NS  ( 1000u ) //!< Default simulated CPU time consumed by each call of a time function (1us)
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Simulated bus statistics
+//********************************************************************************************************************
+
+//! Simulated bus statistics
+typedef struct MemorySim_BusStats
+{
+  uint32_t TransferCalls;     //!< Count of calls of the transfer function of the interface
+  uint32_t Transactions;      //!< Count of bus transactions (I2C: START to STOP ; SPI: chip select assert to deassert)
+  uint32_t Starts;            //!< Count of I2C START and repeated START conditions (0 for SPI)
+  uint32_t Nacks;             //!< Count of I2C not acknowledge received by the master (0 for SPI)
+  uint64_t Bytes;             //!< Count of bytes transferred on the bus (including addresses, opcodes and dummy bytes)
+  uint64_t ClockCycles;       //!< Count of SCL (I2C) or SCK (SPI) clock cycles
+  uint64_t BusTimens;         //!< Total bus time in nanoseconds
+  uint64_t LastCallBusTimens; //!< Bus time of the last transfer function call in nanoseconds
+} MemorySim_BusStats;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Simulated time base API
+//********************************************************************************************************************
+
+/*! @brief Reset the simulated time base
+ *
+ * Set the current simulated time to 0 and the polling cost to #MEMORYSIM_DEFAULT_POLLING_COST_NS
+ */
+void MemorySim_ResetTime(void);
+
+/*! @brief Set the simulated CPU time consumed by each call of a time function
+ *
+ * Drivers poll the time while waiting a device. Each poll advances the simulated time by this value so that a wait loop without bus activity ends
+ * @param[in] pollingCostns Is the time to add at each call of a time function in nanoseconds
+ */
+void MemorySim_SetPollingCost(uint32_t pollingCostns);
+
+/*! @brief Advance the simulated time
+ *
+ * @param[in] timens Is the time to add to the current simulated time in nanoseconds
+ */
+void MemorySim_AdvanceTime(uint64_t timens);
+
+/*! @brief Get the current simulated time without polling cost
+ *
+ * @return Returns the current simulated time in nanoseconds
+ */
+uint64_t MemorySim_GetTimens(void);
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Gives the current simulated millisecond to a driver
+ *
+ * This function can be directly used as a GetCurrentms_Func of the drivers. Each call advances the simulated time by the polling cost
+ * @return Returns the current simulated millisecond
+ */
+uint32_t MemorySim_GetCurrentms(void);
+
+/*! @brief Gives the current simulated microsecond to a driver
+ *
+ * Each call advances the simulated time by the polling cost
+ * @return Returns the current simulated microsecond
+ */
+uint32_t MemorySim_GetCurrentus(void);
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Add a bus activity to bus statistics
+ *
+ * Used by the bus simulators to account the bus time of a transfer function call. The simulated time is not advanced here because a non-blocking transfer runs in background of the CPU
+ * @param[in,out] *pStats Is the bus statistics to update
+ * @param[in] clockCycles Is the count of clock cycles of the activity
+ * @param[in] clockFreq Is the clock frequency of the bus in Hertz
+ * @return Returns the bus time of the activity in nanoseconds
+ */
+uint64_t MemorySim_AddBusActivity(MemorySim_BusStats* pStats, uint64_t clockCycles, uint32_t clockFreq);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* MEMORYSIM_H_INC */
@@ -1,15 +1,15 @@
 /*!*****************************************************************************
  * @file    SPI_Interface.h
  * @author  Fabien 'Emandhal' MAILLY
- * @version 2.0.0
- * @date    24/11/2024
+ * @version 2.1.0
+ * @date    16/10/2026
  * @brief   SPI interface for drivers
  * @details This SPI interface definitions for all the https://github.com/Emandhal
  * drivers and developments
  ******************************************************************************/
  /* @page License
  *
- * Copyright (c) 2020-2024 Fabien MAILLY
+ * Copyright (c) 2020-2026 Fabien MAILLY
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -31,6 +31,7 @@
  *****************************************************************************/
 
 /* Revision history:
+ * 2.1.0    Add optional fnSPI_TransferV for multi-segment transfers under one chip select assertion
  * 2.0.0    Add data bit-length support
  * 1.1.1    Add specific for STM32cubeIDE
  * 1.1.0    Add specific for Arduino, change SPI_MODEs names to comply with Arduino library
@@ -367,6 +368,21 @@ typedef eERRORRESULT (*SPIInit_Func)(SPI_Interface *pIntDev, uint8_t chipSelect,
  */
 typedef eERRORRESULT (*SPITransferPacket_Func)(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketDesc);
 
+
+/*! @brief Interface vectored function for SPI peripheral transfer
+ *
+ * This function will be called when the driver needs to transfer several segments under one chip select assertion (ex: the opcode and address, then the data, then the CRC of a memory). The segments are transferred in order as if #SPITransferPacket_Func was called for each segment,
+ * so the chip select stays asserted between segments and the Terminate of the last segment ends the transfer. This gives the possibility to the interface to turn the whole transfer into one DMA descriptor chain or one Linux SPI_IOC_MESSAGE(n) ioctl
+ * The transfer stops at the first segment in error and the chip select is released. Only the last segment can be non-blocking, its transaction number is set in its Config
+ * @note This function is optional, when it is NULL the drivers call #SPITransferPacket_Func for each segment
+ * @warning A SPIInit_Func() must be called before using this function
+ * @param[in] *pIntDev Is the SPI interface container structure used for the communication
+ * @param[in] *pPacketsDesc Is the array of the segment descriptions to transfer through SPI
+ * @param[in] count Is the count of segments in the array
+ * @return Returns an #eERRORRESULT value enum
+ */
+typedef eERRORRESULT (*SPITransferV_Func)(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketsDesc, size_t count);
+
 //-----------------------------------------------------------------------------
 
 #ifdef ARDUINO
@@ -377,6 +393,7 @@ struct SPI_Interface
   SPIClass& _SPIclass;                   //!< Arduino SPI class
   SPIInit_Func fnSPI_Init;               //!< This function will be called at driver initialization to configure the interface driver
   SPITransferPacket_Func fnSPI_Transfer; //!< This function will be called at driver read/write data from/to the interface driver SPI
+  SPITransferV_Func fnSPI_TransferV;     //!< Optional, this function will be called when the driver needs to transfer several segments under one chip select assertion. Can be NULL
 };
 
 #elif defined(USE_HAL_DRIVER) //#ifdef STM32cubeIDE
@@ -389,6 +406,7 @@ struct SPI_Interface
   GPIO_TypeDef* pGPIOx;                  //!< Pointer to General Purpose I/O register
   uint16_t GPIOpin;                      //!< General Purpose I/O pin number
   uint32_t SPItimeout;                   //!< SPI timeout
+  SPITransferV_Func fnSPI_TransferV;     //!< Optional, this function will be called when the driver needs to transfer several segments under one chip select assertion. Can be NULL
 };
 
 #else
@@ -400,6 +418,7 @@ struct SPI_Interface
   SPIInit_Func fnSPI_Init;               //!< This function will be called at driver initialization to configure the interface driver
   SPITransferPacket_Func fnSPI_Transfer; //!< This function will be called when the driver needs to transfer data over the SPI communication with the device
   uint8_t Channel;                       //!< SPI channel of the interface device in case of multiple virtual SPI channels (This is not the ChipSelect)
+  SPITransferV_Func fnSPI_TransferV;     //!< Optional, this function will be called when the driver needs to transfer several segments under one chip select assertion. Can be NULL
 };
 #endif //#ifdef ARDUINO && USE_HAL_DRIVER
 
@@ -0,0 +1,309 @@
+/*!*****************************************************************************
+ * @file    SPI_LinuxDev.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Linux spidev SPI interface
+ * @details SPI interface for a Linux host that sends each transfer with 1
+ * SPI_IOC_MESSAGE(n) ioctl
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+#undef SPI_LSB_FIRST // <linux/spi/spi.h> and SPI_Interface.h use the same name, the SPI_Interface.h one is used in this file
+#include "SPI_LinuxDev.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__SPI_LINUXDEV // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define SPILINUXDEV_MODE_LSB_FIRST  ( 1u << 3 ) // SPI_LSB_FIRST of the spidev mode in <linux/spi/spi.h>
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Prototypes for private functions
+//=============================================================================
+// System open() of the device file (DO NOT USE DIRECTLY)
+static int __SPILinuxDev_SysOpen(const char* pathname, int flags);
+// System ioctl() of the device file (DO NOT USE DIRECTLY)
+static int __SPILinuxDev_SysIoctl(int fd, unsigned long request, void* arg);
+// Convert the errno of a failed SPI_IOC_MESSAGE to an error (DO NOT USE DIRECTLY)
+static eERRORRESULT __SPILinuxDev_ErrnoToError(int error);
+// Add a packet to the segments of the current transfer (DO NOT USE DIRECTLY)
+static eERRORRESULT __SPILinuxDev_AddPacket(SPI_LinuxDev *pDev, SPIInterface_Packet* const pPacketDesc);
+// Send a SPI_IOC_MESSAGE of the current transfer (DO NOT USE DIRECTLY)
+static eERRORRESULT __SPILinuxDev_SendMessage(SPI_LinuxDev *pDev, struct spi_ioc_transfer* pTransfers, uint32_t count, bool keepChipSelect);
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// [STATIC] System open() of the device file (DO NOT USE DIRECTLY)
+//=============================================================================
+int __SPILinuxDev_SysOpen(const char* pathname, int flags)
+{
+  return open(pathname, flags);
+}
+
+
+//=============================================================================
+// [STATIC] System ioctl() of the device file (DO NOT USE DIRECTLY)
+//=============================================================================
+int __SPILinuxDev_SysIoctl(int fd, unsigned long request, void* arg)
+{
+  return ioctl(fd, request, arg);
+}
+
+
+//=============================================================================
+// [STATIC] Convert the errno of a failed SPI_IOC_MESSAGE to an error (DO NOT USE DIRECTLY)
+//=============================================================================
+eERRORRESULT __SPILinuxDev_ErrnoToError(int error)
+{
+  switch (error)
+  {
+    case EMSGSIZE:  return ERR_GENERATE(ERR__SPI_OVERFLOW_ERROR);  // The transfer is bigger than the bufsiz of spidev
+    case ETIMEDOUT: return ERR_GENERATE(ERR__SPI_TIMEOUT);
+    case EBUSY:     return ERR_GENERATE(ERR__SPI_OTHER_BUSY);
+    case EINVAL:    return ERR_GENERATE(ERR__SPI_PARAMETER_ERROR); // The controller does not support the transfer (width, length...)
+    default: break;
+  }
+  return ERR_GENERATE(ERR__SPI_COMM_ERROR);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Linux spidev interface initialization
+//=============================================================================
+eERRORRESULT SPILinuxDev_InterfaceInit(SPI_Interface *pIntDev, uint8_t chipSelect, eSPIInterface_Mode mode, const uint32_t sckFreq)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != SPILINUXDEV_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  SPI_LinuxDev* pDev = (SPI_LinuxDev*)pIntDev->InterfaceDevice;
+  if (pDev == NULL) return ERR_GENERATE(ERR__SPI_PARAMETER_ERROR);
+  if (chipSelect >= SPILINUXDEV_MAX_CHIP_SELECTS) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);
+  if (sckFreq == 0) return ERR_GENERATE(ERR__SPI_FREQUENCY_ERROR);
+  const uint8_t Pins = (uint8_t)SPI_PIN_COUNT_GET(mode);
+  if ((Pins != 0) && (Pins != 1) && (Pins != 2) && (Pins != 4)) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);
+  SPILinuxDev_ChipSelect* pCS = &pDev->ChipSelects[chipSelect];
+  SPILinuxDev_Ioctl_Func fnIoctl = (pDev->fnIoctl != NULL ? pDev->fnIoctl : __SPILinuxDev_SysIoctl);
+
+  //--- Open the device file of the chip select ---
+  if (pCS->IsOpen == false)                                                                  // The device file stays opened when the driver changes the mode
+  {
+    SPILinuxDev_Open_Func fnOpen = (pDev->fnOpen != NULL ? pDev->fnOpen : __SPILinuxDev_SysOpen);
+    char Path[32];
+    snprintf(&Path[0], sizeof(Path), "/dev/spidev%u.%u", (unsigned int)pIntDev->Channel, (unsigned int)chipSelect);
+    pCS->File = fnOpen(&Path[0], O_RDWR);
+    if (pCS->File < 0) return ERR_GENERATE(ERR__UNKNOWN_CHANNEL);
+    pCS->IsOpen = true;
+  }
+
+  //--- Configure the chip select ---
+  uint32_t Mode = (SPI_CPHA_GET(mode) > 0 ? SPI_CPHA : 0) | (SPI_CPOL_GET(mode) > 0 ? SPI_CPOL : 0) | (SPI_IS_LSB_FIRST(mode) ? SPILINUXDEV_MODE_LSB_FIRST : 0);
+  if (Pins == 0) Mode |= SPI_3WIRE;                                                          // SDI and SDO on the same pin
+  if (Pins == 2) Mode |= SPI_TX_DUAL | SPI_RX_DUAL;
+  if (Pins == 4) Mode |= SPI_TX_QUAD | SPI_RX_QUAD;
+  uint8_t BitsPerWord = (uint8_t)SPI_DATA_BITCOUNT_GET(mode);
+  if (BitsPerWord == 0) BitsPerWord = 8;
+  uint32_t SpeedHz = sckFreq;
+  if (fnIoctl(pCS->File, SPI_IOC_WR_MODE32, &Mode) < 0) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);
+  if (fnIoctl(pCS->File, SPI_IOC_WR_BITS_PER_WORD, &BitsPerWord) < 0) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);
+  if (fnIoctl(pCS->File, SPI_IOC_WR_MAX_SPEED_HZ, &SpeedHz) < 0) return ERR_GENERATE(ERR__SPI_FREQUENCY_ERROR);
+  pCS->Pins = Pins;
+
+  //--- Reset the transfer ---
+  pDev->SegmentCount = 0;
+  pDev->DummyCount   = 0;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Add a packet to the segments of the current transfer (DO NOT USE DIRECTLY)
+//=============================================================================
+eERRORRESULT __SPILinuxDev_AddPacket(SPI_LinuxDev *pDev, SPIInterface_Packet* const pPacketDesc)
+{
+  if ((pDev->SegmentCount > 0) && (pPacketDesc->ChipSelect != pDev->ChipSelect)) return ERR_GENERATE(ERR__SPI_COMM_ERROR); // The chip select cannot change during a transfer
+  if (pDev->SegmentCount >= SPILINUXDEV_MAX_SEGMENTS) return ERR_GENERATE(ERR__SPI_OVERFLOW_ERROR);
+  const bool HalfDuplex = (pDev->ChipSelects[pPacketDesc->ChipSelect].Pins != 1);           // 3-wire, dual, and quad cannot send and receive at the same time
+  SPILinuxDev_Segment* pSegment = &pDev->Segments[pDev->SegmentCount];
+  pSegment->TxData = pPacketDesc->TxData;
+  pSegment->RxData = pPacketDesc->RxData;
+  pSegment->Size   = pPacketDesc->DataSize;
+
+  //--- Set the data to send ---
+  if (HalfDuplex && (pSegment->RxData != NULL)) pSegment->TxData = NULL;                     // The segment only receives
+  else if ((pPacketDesc->Config.Bits.UseDummyByte > 0) || (pSegment->TxData == NULL))
+  {
+    pSegment->TxData = NULL;                                                                 // The kernel sends 0x00 bytes without TX buffer
+    if ((HalfDuplex == false) && (pPacketDesc->DummyByte != 0x00) && (pSegment->Size > 0))
+    {
+      if ((pDev->DummyCount + pSegment->Size) > SPILINUXDEV_DUMMY_BUFFER_SIZE) return ERR_GENERATE(ERR__SPI_OVERFLOW_ERROR);
+      pSegment->TxData = &pDev->DummyBuffer[pDev->DummyCount];
+      memset(pSegment->TxData, pPacketDesc->DummyByte, pSegment->Size);
+      pDev->DummyCount += pSegment->Size;
+    }
+  }
+  pDev->ChipSelect = pPacketDesc->ChipSelect;
+  pDev->SegmentCount++;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// [STATIC] Send a SPI_IOC_MESSAGE of the current transfer (DO NOT USE DIRECTLY)
+//=============================================================================
+eERRORRESULT __SPILinuxDev_SendMessage(SPI_LinuxDev *pDev, struct spi_ioc_transfer* pTransfers, uint32_t count, bool keepChipSelect)
+{
+  if (keepChipSelect) pTransfers[count - 1].cs_change = 1;                                   // On the last segment of a message, cs_change keeps the chip select asserted for the next message
+  SPILinuxDev_Ioctl_Func fnIoctl = (pDev->fnIoctl != NULL ? pDev->fnIoctl : __SPILinuxDev_SysIoctl);
+  const int Result = fnIoctl(pDev->ChipSelects[pDev->ChipSelect].File, SPI_IOC_MESSAGE(count), pTransfers);
+  pDev->MessageCalls++;
+  if (Result < 0) return __SPILinuxDev_ErrnoToError(errno);
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Linux spidev interface transfer
+//=============================================================================
+eERRORRESULT SPILinuxDev_InterfaceTransfer(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketDesc)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pIntDev == NULL) || (pPacketDesc == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != SPILINUXDEV_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  SPI_LinuxDev* pDev = (SPI_LinuxDev*)pIntDev->InterfaceDevice;
+  if (pDev == NULL) return ERR_GENERATE(ERR__SPI_PARAMETER_ERROR);
+  if (pPacketDesc->ChipSelect >= SPILINUXDEV_MAX_CHIP_SELECTS) return ERR_GENERATE(ERR__SPI_PARAMETER_ERROR);
+  if (pDev->ChipSelects[pPacketDesc->ChipSelect].IsOpen == false) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR); // The chip select is not initialized
+  eERRORRESULT Error;
+
+  //--- Add the packet to the transfer ---
+  Error = __SPILinuxDev_AddPacket(pDev, pPacketDesc);
+  if (Error != ERR_NONE)
+  {
+    pDev->SegmentCount = 0;                                                                  // The transfer is dropped
+    pDev->DummyCount   = 0;
+    return Error;
+  }
+  if (pPacketDesc->Terminate == false) return ERR_NONE;                                      // The transfer is sent at the Terminate
+
+  //--- Send the whole transfer ---
+  const uint8_t Pins = (pDev->ChipSelects[pDev->ChipSelect].Pins == 0 ? 1 : pDev->ChipSelects[pDev->ChipSelect].Pins); // 3-wire SPI uses 1 bit per clock
+  const size_t MaxMessageSize = (pDev->MaxMessageSize > 0 ? pDev->MaxMessageSize : SPILINUXDEV_DEFAULT_BUFSIZ);
+  size_t RemainingSize = 0;
+  for (size_t zSeg = 0; zSeg < pDev->SegmentCount; ++zSeg) RemainingSize += pDev->Segments[zSeg].Size;
+  struct spi_ioc_transfer Transfers[SPILINUXDEV_MAX_SEGMENTS];
+  uint32_t TransferCount = 0;
+  size_t MessageSize = 0;
+  Error = ERR_NONE;
+  memset(&Transfers[0], 0, sizeof(Transfers));
+  for (size_t zSeg = 0; (zSeg < pDev->SegmentCount) && (Error == ERR_NONE); ++zSeg)
+  {
+    const SPILinuxDev_Segment* pSegment = &pDev->Segments[zSeg];
+    size_t Offset = 0;
+    while ((Offset < pSegment->Size) && (Error == ERR_NONE))                                 // A segment of size 0 has nothing to clock
+    {
+      const size_t ChunkSize = ((pSegment->Size - Offset) < (MaxMessageSize - MessageSize) ? (pSegment->Size - Offset) : (MaxMessageSize - MessageSize)); // A message is at most bufsiz bytes
+      struct spi_ioc_transfer* pTransfer = &Transfers[TransferCount++];
+      pTransfer->tx_buf   = (pSegment->TxData != NULL ? (uint64_t)(uintptr_t)&pSegment->TxData[Offset] : 0);
+      pTransfer->rx_buf   = (pSegment->RxData != NULL ? (uint64_t)(uintptr_t)&pSegment->RxData[Offset] : 0);
+      pTransfer->len      = (uint32_t)ChunkSize;
+      pTransfer->tx_nbits = Pins;
+      pTransfer->rx_nbits = Pins;
+      Offset        += ChunkSize;
+      MessageSize   += ChunkSize;
+      RemainingSize -= ChunkSize;
+      if ((RemainingSize > 0) && ((MessageSize >= MaxMessageSize) || (TransferCount >= SPILINUXDEV_MAX_SEGMENTS))) // The message is full, send it and continue the transfer in the next one
+      {
+        Error = __SPILinuxDev_SendMessage(pDev, &Transfers[0], TransferCount, true);
+        memset(&Transfers[0], 0, sizeof(Transfers));
+        TransferCount = 0;
+        MessageSize   = 0;
+      }
+    }
+  }
+  pDev->SegmentCount = 0;
+  pDev->DummyCount   = 0;
+  if ((Error != ERR_NONE) || (TransferCount == 0)) return Error;
+  return __SPILinuxDev_SendMessage(pDev, &Transfers[0], TransferCount, false);              // The chip select is released after the last transfer
+}
+
+
+//=============================================================================
+// Linux spidev interface vectored transfer
+//=============================================================================
+eERRORRESULT SPILinuxDev_InterfaceTransferV(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketsDesc, size_t count)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pIntDev == NULL) || (pPacketsDesc == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  eERRORRESULT Error = ERR_NONE;
+
+  for (size_t zSeg = 0; zSeg < count; ++zSeg)
+  {
+    Error = SPILinuxDev_InterfaceTransfer(pIntDev, &pPacketsDesc[zSeg]);
+    if (Error != ERR_NONE) break;                                                            // The transfer stops at the first segment in error
+  }
+  return Error;
+}
+
+
+//=============================================================================
+// Close the device files of a Linux spidev interface
+//=============================================================================
+eERRORRESULT SPILinuxDev_Close(SPI_LinuxDev *pDev)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pDev == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  SPILinuxDev_Close_Func fnClose = (pDev->fnClose != NULL ? pDev->fnClose : close);
+  eERRORRESULT Error = ERR_NONE;
+
+  for (size_t zCS = 0; zCS < SPILINUXDEV_MAX_CHIP_SELECTS; ++zCS)
+  {
+    SPILinuxDev_ChipSelect* pCS = &pDev->ChipSelects[zCS];
+    if (pCS->IsOpen == false) continue;
+    pCS->IsOpen = false;
+    if (fnClose(pCS->File) < 0) Error = ERR_GENERATE(ERR__SPI_COMM_ERROR);
+  }
+  pDev->SegmentCount = 0;
+  pDev->DummyCount   = 0;
+  return Error;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
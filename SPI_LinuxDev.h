@@ -0,0 +1,181 @@
+/*!*****************************************************************************
+ * @file    SPI_LinuxDev.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Linux spidev SPI interface
+ * @details SPI interface for a Linux host (single board computer) that can be
+ * set in a struct SPI_Interface. Each chip select is a spidev device file
+ * (/dev/spidev<Channel>.<chipSelect>). The packets of a transfer are kept
+ * while their Terminate is 'false' and the whole transfer is sent with 1
+ * SPI_IOC_MESSAGE(n) ioctl at the packet with the Terminate, the chip select
+ * stays asserted between the packets. So the instruction, the address, the
+ * dummy byte, the data, and the CRC of a memory access are 1 system call.
+ * The dual and quad widths of the transfers are taken from the pin count of
+ * the #eSPIInterface_Mode set at the initialization.
+ * The open(), ioctl(), and close() functions can be replaced by fake ones to
+ * run the drivers without a real bus.
+ * Only the generic struct SPI_Interface is supported (not the Arduino, nor the STM32 ones)
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef SPI_LINUXDEV_H_INC
+#define SPI_LINUXDEV_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "SPI_Interface.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define SPILINUXDEV_UNIQUE_ID          ( 0x53504C44u ) //!< Unique ID of the Linux spidev interface, to set in the SPI_Interface.UniqueID
+#define SPILINUXDEV_MAX_CHIP_SELECTS   ( 4u )          //!< Maximum chip selects of the interface (1 spidev device file per chip select)
+#define SPILINUXDEV_MAX_SEGMENTS       ( 8u )          //!< Maximum packets of a transfer under one chip select assertion
+#define SPILINUXDEV_DUMMY_BUFFER_SIZE  ( 64u )         //!< Size of the buffer of the dummy bytes of a transfer that are not 0x00
+#define SPILINUXDEV_DEFAULT_BUFSIZ     ( 4096u )       //!< Default bufsiz parameter of the spidev module, maximum bytes of 1 SPI_IOC_MESSAGE
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Linux spidev interface
+//********************************************************************************************************************
+
+/*! @brief open() function of the spidev device file
+ * @param[in] *pathname Is the path of the device file
+ * @param[in] flags Is the open flags (O_RDWR)
+ * @return Returns the file descriptor, or -1 with errno set
+ */
+typedef int (*SPILinuxDev_Open_Func)(const char* pathname, int flags);
+
+/*! @brief ioctl() function of the spidev device file
+ * @param[in] fd Is the file descriptor of the device file
+ * @param[in] request Is the ioctl request (SPI_IOC_WR_MODE32, SPI_IOC_WR_BITS_PER_WORD, SPI_IOC_WR_MAX_SPEED_HZ, SPI_IOC_MESSAGE(n))
+ * @param[in,out] *arg Is the argument of the request
+ * @return Returns a positive value or 0 if succeed, or -1 with errno set
+ */
+typedef int (*SPILinuxDev_Ioctl_Func)(int fd, unsigned long request, void* arg);
+
+/*! @brief close() function of the spidev device file
+ * @param[in] fd Is the file descriptor of the device file
+ * @return Returns 0 if succeed, or -1 with errno set
+ */
+typedef int (*SPILinuxDev_Close_Func)(int fd);
+
+
+//! Linux spidev chip select structure
+typedef struct SPILinuxDev_ChipSelect
+{
+  int File;                           //!< File descriptor of the device file of the chip select
+  bool IsOpen;                        //!< 'true' if the device file is opened
+  uint8_t Pins;                       //!< Data pin count of the mode set at the initialization (0 for 3-wire, 1, 2, or 4)
+} SPILinuxDev_ChipSelect;
+
+
+//! Linux spidev segment of a transfer structure
+typedef struct SPILinuxDev_Segment
+{
+  uint8_t* TxData;                    //!< Data to send, NULL to send 0x00 bytes (or nothing in 3-wire, dual, and quad)
+  uint8_t* RxData;                    //!< Where the data received will be stored, NULL if no received data is expected
+  size_t Size;                        //!< Size of the segment in bytes
+} SPILinuxDev_Segment;
+
+
+//! Linux spidev interface object structure
+typedef struct SPI_LinuxDev
+{
+  SPILinuxDev_Open_Func fnOpen;       //!< open() function. Set NULL to use the system open(), or set a fake one to run without a real bus
+  SPILinuxDev_Ioctl_Func fnIoctl;     //!< ioctl() function. Set NULL to use the system ioctl(), or set a fake one to run without a real bus
+  SPILinuxDev_Close_Func fnClose;     //!< close() function. Set NULL to use the system close(), or set a fake one to run without a real bus
+  uint32_t MessageCalls;              //!< Count of SPI_IOC_MESSAGE ioctl (1 per transfer, more if the transfer is bigger than MaxMessageSize). Can be cleared by the user
+  uint32_t MaxMessageSize;            //!< bufsiz parameter of the spidev module (/sys/module/spidev/parameters/bufsiz). Set 0 to use SPILINUXDEV_DEFAULT_BUFSIZ
+
+  //--- Interface state ---
+  SPILinuxDev_ChipSelect ChipSelects[SPILINUXDEV_MAX_CHIP_SELECTS]; //!< Device files of the chip selects
+  uint8_t ChipSelect;                 //!< Chip select of the current transfer
+  size_t SegmentCount;                //!< Count of segments of the current transfer
+  size_t DummyCount;                  //!< Count of bytes used in the dummy buffer by the current transfer
+  SPILinuxDev_Segment Segments[SPILINUXDEV_MAX_SEGMENTS]; //!< Segments of the current transfer
+  uint8_t DummyBuffer[SPILINUXDEV_DUMMY_BUFFER_SIZE];     //!< Dummy bytes of the current transfer that are not 0x00
+} SPI_LinuxDev;
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Linux spidev interface initialization
+ *
+ * Set this function in the SPI_Interface.fnSPI_Init of the driver with SPI_Interface.InterfaceDevice pointing to an #SPI_LinuxDev and SPI_Interface.UniqueID set to #SPILINUXDEV_UNIQUE_ID
+ * It opens the device file of the chip select if needed, then sets its mode, data bit count, and maximum SCK frequency. The pin count of the mode sets the dual or quad width of the transfers
+ * @param[in] *pIntDev Is the SPI interface container structure used for the interface initialization
+ * @param[in] chipSelect Is the Chip Select index to use for the SPI/Dual-SPI/Quad-SPI initialization
+ * @param[in] mode Is the mode of the SPI to configure
+ * @param[in] sckFreq Is the SCK frequency in Hz to set at the interface initialization
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SPILinuxDev_InterfaceInit(SPI_Interface *pIntDev, uint8_t chipSelect, eSPIInterface_Mode mode, const uint32_t sckFreq);
+
+/*! @brief Linux spidev interface transfer
+ *
+ * Set this function in the SPI_Interface.fnSPI_Transfer of the driver. A packet with Terminate at 'false' is kept and the transfer is sent with 1 SPI_IOC_MESSAGE(n) ioctl at the packet with the Terminate
+ * The buffers of the packets shall be valid until the packet with the Terminate. In 3-wire, dual, and quad, a packet with RxData only receives and a packet without RxData only sends
+ * All transfers are blocking. A transfer bigger than the bufsiz parameter of the spidev module (SPI_LinuxDev.MaxMessageSize) is split in several SPI_IOC_MESSAGE, the chip select stays asserted between them (cs_change on the last segment of each SPI_IOC_MESSAGE but the last one)
+ * @param[in] *pIntDev Is the SPI interface container structure used for the communication
+ * @param[in] *pPacketDesc Is the packet description to transfer through SPI
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SPILinuxDev_InterfaceTransfer(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketDesc);
+
+/*! @brief Linux spidev interface vectored transfer
+ *
+ * Set this function in the SPI_Interface.fnSPI_TransferV of the driver. The segments are transferred as with SPILinuxDev_InterfaceTransfer(), segments that end with a Terminate are 1 SPI_IOC_MESSAGE(n) ioctl
+ * @param[in] *pIntDev Is the SPI interface container structure used for the communication
+ * @param[in] *pPacketsDesc Is the array of the segment descriptions to transfer through SPI
+ * @param[in] count Is the count of segments in the array
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SPILinuxDev_InterfaceTransferV(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketsDesc, size_t count);
+
+/*! @brief Close the device files of a Linux spidev interface
+ *
+ * @param[in] *pDev Is the pointed structure of the Linux spidev interface
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SPILinuxDev_Close(SPI_LinuxDev *pDev);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* SPI_LINUXDEV_H_INC */
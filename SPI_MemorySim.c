@@ -0,0 +1,493 @@
+/*!*****************************************************************************
+ * @file    SPI_MemorySim.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Simulated SPI bus with SRAM and EERAM devices
+ * @details Host-side SPI interface that can be set in a struct SPI_Interface
+ * instead of a real SPI peripheral
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <string.h>
+#include "SPI_MemorySim.h"
+//-----------------------------------------------------------------------------
+#ifdef USE_ERROR_CONTEXT
+#  define UNIT_ERR_CONTEXT  ERRCONTEXT__SPI_MEMORYSIM // Error context of this unit
+#else
+#  define ERR_GENERATE(error)   error
+#  define ERR_ERROR_Get(error)  error
+#endif
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+#include <cstdint>
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define SPIMEMSIM_DEVICE_PINS(pDev)  ( (pDev)->CurrentIOmode == SPIMEMSIM_SQI ? 4u : ((pDev)->CurrentIOmode == SPIMEMSIM_SDI ? 2u : 1u) ) // Data pin count of the current I/O mode of a device
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Simulated SPI interface initialization
+//=============================================================================
+eERRORRESULT SPIMemSim_InterfaceInit(SPI_Interface *pIntDev, uint8_t chipSelect, eSPIInterface_Mode mode, const uint32_t sckFreq)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != SPIMEMSIM_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  SPI_MemorySim* pSim = (SPI_MemorySim*)pIntDev->InterfaceDevice;
+  if ((pSim == NULL) || (pSim->Devices == NULL)) return ERR_GENERATE(ERR__SPI_PARAMETER_ERROR);
+  if (sckFreq == 0) return ERR_GENERATE(ERR__SPI_FREQUENCY_ERROR);
+  uint8_t Pins = (uint8_t)SPI_PIN_COUNT_GET(mode);
+  if (Pins == 0) Pins = 1;                                                                          // 3-wire SPI uses 1 bit per clock
+  if ((Pins != 1) && (Pins != 2) && (Pins != 4)) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);
+
+  //--- Check and configure the devices of the chip select ---
+  bool Found = false;
+  for (size_t z = 0; z < pSim->DeviceCount; ++z)
+  {
+    SPIMemSim_Device* pDev = &pSim->Devices[z];
+    if (pDev->ChipSelect != chipSelect) continue;
+    if ((pDev->Memory == NULL) || (pDev->ArrayByteSize == 0)) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);
+    if ((pDev->AddressBytes == 0) || (pDev->AddressBytes > 4)) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);
+    const uint16_t PageSize = pDev->PageSize;
+    if ((PageSize == 0) || ((PageSize & (PageSize - 1)) != 0)) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);                     // The page size shall be a power of 2
+    if ((pDev->Type == SPIMEMSIM_EERAM48Lxxx) && (PageSize > SPIMEMSIM_PAGE_BUFFER_SIZE)) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR); // The secure page shall fit in the page buffer
+    if ((pDev->MaxSCKfrequency > 0) && (sckFreq > pDev->MaxSCKfrequency)) return ERR_GENERATE(ERR__SPI_FREQUENCY_ERROR);
+    pDev->InterfacePins = Pins;
+    pDev->SCKfrequency  = sckFreq;
+    Found = true;
+  }
+  if (Found == false) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR);                                   // No device on this chip select
+
+  //--- Reset the bus state ---
+  pSim->pCurrent         = NULL;
+  pSim->InTransaction    = false;
+  pSim->NonBlockingEndns = 0;
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Reset the statistics of a simulated SPI bus
+//=============================================================================
+void SPIMemSim_ResetStats(SPI_MemorySim *pSim)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pSim == NULL) return;
+#endif
+  memset(&pSim->Stats, 0, sizeof(pSim->Stats));
+  pSim->IOmodeMismatches = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Compute the CRC16-IBM3740 of the bitCount LSB of a value, MSB first
+//=============================================================================
+static uint16_t __SPIMemSim_CRC16Bits(uint16_t crc, uint32_t value, uint8_t bitCount)
+{
+  while (bitCount-- > 0)
+  {
+    const bool Bit = (((value >> bitCount) & 0x1u) > 0) ^ ((crc & 0x8000u) > 0);
+    crc = (uint16_t)(crc << 1);
+    if (Bit) crc ^= 0x1021u;
+  }
+  return crc;
+}
+
+
+//=============================================================================
+// [STATIC] Get the count of address bits of the array of a device
+//=============================================================================
+static uint8_t __SPIMemSim_AddressBits(const SPIMemSim_Device* pDev)
+{
+  uint8_t Bits = 0;
+  while ((Bits < 32) && ((1ull << Bits) < pDev->ArrayByteSize)) ++Bits;
+  return Bits;
+}
+
+
+//=============================================================================
+// [STATIC] Is the address protected by the block protection bits of an EERAM
+//=============================================================================
+static bool __SPIMemSim_IsProtected(const SPIMemSim_Device* pDev, uint32_t address)
+{
+  const uint8_t BP = (uint8_t)((pDev->StatusRegister & SPIMEMSIM_EERAM_BP_Mask) >> 2);
+  if (BP == 0) return false;                                                // No protection
+  const uint32_t ProtectedSize = (BP == 3 ? pDev->ArrayByteSize : (pDev->ArrayByteSize >> (3 - BP))); // BP=1: upper 1/4 ; BP=2: upper 1/2 ; BP=3: all
+  return (address >= (pDev->ArrayByteSize - ProtectedSize));
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// [STATIC] Start a transaction on a chip select
+//=============================================================================
+static SPIMemSim_Device* __SPIMemSim_StartTransaction(SPI_MemorySim *pSim, uint8_t chipSelect, uint64_t now)
+{
+  SPIMemSim_Device* pDev = NULL;
+  for (size_t z = 0; z < pSim->DeviceCount; ++z)
+    if (pSim->Devices[z].ChipSelect == chipSelect) { pDev = &pSim->Devices[z]; break; }
+  if (pDev == NULL) return NULL;
+
+  //--- Prepare the transaction ---
+  pSim->Phase         = SPIMEMSIM_PHASE_OPCODE;
+  pSim->Opcode        = 0x00;                                                 // 0x00 is not an instruction of the devices
+  pSim->AddrBytesLeft = 0;
+  pSim->Address       = 0;
+  pSim->DataCount     = 0;
+  pSim->ReceivedCRC   = 0;
+  pSim->DeviceBusy    = (now < pDev->BusyUntilns);
+  if (SPIMEMSIM_DEVICE_PINS(pDev) != pDev->InterfacePins)                     // The device does not understand the transaction
+  {
+    pSim->Phase = SPIMEMSIM_PHASE_IGNORE;
+    pSim->IOmodeMismatches++;
+  }
+  if (pDev->Hibernate)                                                        // The chip select assertion wakes up the device
+  {
+    pDev->Hibernate = false;
+    pSim->Phase = SPIMEMSIM_PHASE_IGNORE;
+  }
+  return pDev;
+}
+
+
+//=============================================================================
+// [STATIC] Exchange a byte with a SRAM 23LCxxx
+//=============================================================================
+static uint8_t __SPIMemSim_SRAMExchange(SPI_MemorySim *pSim, SPIMemSim_Device* pDev, uint8_t data)
+{
+  uint8_t Result = 0xFF;
+  switch (pSim->Phase)
+  {
+    case SPIMEMSIM_PHASE_OPCODE:
+      pSim->Opcode = data;
+      if ((data == SPIMEMSIM_SRAM_READ) || (data == SPIMEMSIM_SRAM_WRITE))
+      {
+        pSim->Phase = SPIMEMSIM_PHASE_ADDRESS;
+        pSim->AddrBytesLeft = pDev->AddressBytes;
+      }
+      else if ((data == SPIMEMSIM_SRAM_RDSR) || (data == SPIMEMSIM_SRAM_WRSR)) pSim->Phase = SPIMEMSIM_PHASE_DATA;
+      else pSim->Phase = SPIMEMSIM_PHASE_IGNORE;                              // EDIO, EQIO, and RSTIO are executed at the end of the transaction
+      break;
+
+    case SPIMEMSIM_PHASE_ADDRESS:
+      pSim->Address = (pSim->Address << 8) | data;
+      if (--pSim->AddrBytesLeft == 0)
+      {
+        pSim->Address %= pDev->ArrayByteSize;
+        const bool Dummy = ((pSim->Opcode == SPIMEMSIM_SRAM_READ) && (SPIMEMSIM_DEVICE_PINS(pDev) > 1)); // A read in SDI or SQI has a dummy byte
+        pSim->Phase = (Dummy ? SPIMEMSIM_PHASE_DUMMY : SPIMEMSIM_PHASE_DATA);
+      }
+      break;
+
+    case SPIMEMSIM_PHASE_DUMMY:
+      pSim->Phase = SPIMEMSIM_PHASE_DATA;
+      break;
+
+    case SPIMEMSIM_PHASE_DATA:
+      if (pSim->Opcode == SPIMEMSIM_SRAM_RDSR) { Result = pDev->StatusRegister; break; }
+      if (pSim->Opcode == SPIMEMSIM_SRAM_WRSR)
+      {
+        if (pSim->DataCount++ == 0) pDev->StatusRegister = (pDev->StatusRegister & ~SPIMEMSIM_SRAM_STATUS_WRITABLE) | (data & SPIMEMSIM_SRAM_STATUS_WRITABLE);
+        break;
+      }
+      if (pSim->Opcode == SPIMEMSIM_SRAM_READ) Result = pDev->Memory[pSim->Address];
+      else pDev->Memory[pSim->Address] = data;
+      //--- Next address of the operation mode ---
+      switch (pDev->StatusRegister & SPIMEMSIM_SRAM_MODE_Mask)
+      {
+        case SPIMEMSIM_SRAM_PAGE_MODE:                                        // Roll-over inside the page
+          pSim->Address = (pSim->Address & ~((uint32_t)pDev->PageSize - 1u)) | ((pSim->Address + 1u) & ((uint32_t)pDev->PageSize - 1u));
+          break;
+        case SPIMEMSIM_SRAM_SEQUENTIAL_MODE:                                  // Roll-over at the end of the array
+          pSim->Address = ((pSim->Address + 1u) % pDev->ArrayByteSize);
+          break;
+        default: break;                                                       // Byte mode: the address does not change
+      }
+      break;
+
+    default: break;
+  }
+  return Result;
+}
+
+
+//=============================================================================
+// [STATIC] Exchange a byte with an EERAM 48Lxxx
+//=============================================================================
+static uint8_t __SPIMemSim_EERAMExchange(SPI_MemorySim *pSim, SPIMemSim_Device* pDev, uint8_t data)
+{
+  uint8_t Result = 0xFF;
+  const bool WriteEnable = ((pDev->StatusRegister & SPIMEMSIM_EERAM_WEL) > 0);
+  switch (pSim->Phase)
+  {
+    case SPIMEMSIM_PHASE_OPCODE:
+      pSim->Opcode = data;
+      if (pSim->DeviceBusy && (data != SPIMEMSIM_EERAM_RDSR))                 // Only the status can be read during a STORE or RECALL
+      {
+        pSim->Opcode = 0x00;
+        pSim->Phase  = SPIMEMSIM_PHASE_IGNORE;
+        break;
+      }
+      switch (data)
+      {
+        case SPIMEMSIM_EERAM_READ:
+        case SPIMEMSIM_EERAM_WRITE:
+        case SPIMEMSIM_EERAM_SREAD:
+        case SPIMEMSIM_EERAM_SWRITE:
+          pSim->Phase = SPIMEMSIM_PHASE_ADDRESS;
+          pSim->AddrBytesLeft = pDev->AddressBytes;
+          break;
+        case SPIMEMSIM_EERAM_RDSR:
+        case SPIMEMSIM_EERAM_WRSR:
+        case SPIMEMSIM_EERAM_RDNUR:
+        case SPIMEMSIM_EERAM_WRNUR:
+          pSim->Phase = SPIMEMSIM_PHASE_DATA;
+          break;
+        default:
+          pSim->Phase = SPIMEMSIM_PHASE_IGNORE;                               // WREN, WRDI, STORE, RECALL, and HBRNT are executed at the end of the transaction
+          break;
+      }
+      return Result;
+
+    case SPIMEMSIM_PHASE_ADDRESS:
+      pSim->Address = (pSim->Address << 8) | data;
+      if (--pSim->AddrBytesLeft == 0)
+      {
+        pSim->Address %= pDev->ArrayByteSize;
+        pSim->CRC   = __SPIMemSim_CRC16Bits(0xFFFF, pSim->Address, __SPIMemSim_AddressBits(pDev)); // The CRC covers the significant address bits
+        pSim->Phase = SPIMEMSIM_PHASE_DATA;
+      }
+      return Result;
+
+    case SPIMEMSIM_PHASE_DATA:
+      break;
+
+    default: return Result;
+  }
+
+  //--- Data phase ---
+  const uint32_t Count = pSim->DataCount++;
+  switch (pSim->Opcode)
+  {
+    case SPIMEMSIM_EERAM_READ:
+      Result = pDev->Memory[pSim->Address];
+      pSim->Address = ((pSim->Address + 1u) % pDev->ArrayByteSize);           // Roll-over at the end of the array
+      break;
+    case SPIMEMSIM_EERAM_WRITE:
+      if (WriteEnable && (__SPIMemSim_IsProtected(pDev, pSim->Address) == false)) pDev->Memory[pSim->Address] = data;
+      pSim->Address = ((pSim->Address + 1u) % pDev->ArrayByteSize);           // Roll-over at the end of the array
+      break;
+    case SPIMEMSIM_EERAM_SREAD:
+      if (Count < pDev->PageSize)
+      {
+        Result = pDev->Memory[(pSim->Address + Count) % pDev->ArrayByteSize];
+        pSim->CRC = __SPIMemSim_CRC16Bits(pSim->CRC, Result, 8);
+      }
+      else if (Count == pDev->PageSize) Result = (uint8_t)(pSim->CRC >> 8);
+      else if (Count == (pDev->PageSize + 1u)) Result = (uint8_t)(pSim->CRC & 0xFF);
+      break;
+    case SPIMEMSIM_EERAM_SWRITE:
+      if (Count < pDev->PageSize)
+      {
+        pSim->Buffer[Count] = data;
+        pSim->CRC = __SPIMemSim_CRC16Bits(pSim->CRC, data, 8);
+      }
+      else if (Count < (pDev->PageSize + 2u)) pSim->ReceivedCRC = (uint16_t)((pSim->ReceivedCRC << 8) | data);
+      break;
+    case SPIMEMSIM_EERAM_RDSR:
+      Result = pDev->StatusRegister | (pSim->DeviceBusy ? SPIMEMSIM_EERAM_BUSY : 0u);
+      break;
+    case SPIMEMSIM_EERAM_WRSR:
+      if ((Count == 0) && WriteEnable) pDev->StatusRegister = (pDev->StatusRegister & ~SPIMEMSIM_EERAM_STATUS_WRITABLE) | (data & SPIMEMSIM_EERAM_STATUS_WRITABLE);
+      break;
+    case SPIMEMSIM_EERAM_RDNUR:
+      Result = pDev->NVUserSpace[Count % SPIMEMSIM_NVUS_SIZE];
+      break;
+    case SPIMEMSIM_EERAM_WRNUR:
+      if ((Count < SPIMEMSIM_NVUS_SIZE) && WriteEnable) pDev->NVUserSpace[Count] = data;
+      break;
+    default: break;
+  }
+  return Result;
+}
+
+
+//=============================================================================
+// [STATIC] End the current transaction
+//=============================================================================
+static void __SPIMemSim_EndTransaction(SPI_MemorySim *pSim, uint64_t endTimens)
+{
+  SPIMemSim_Device* pDev = pSim->pCurrent;
+  if (pDev != NULL)
+  {
+    if (pDev->Type == SPIMEMSIM_SRAM23LCxxx)
+    {
+      //--- I/O mode change of the SRAM ---
+      if ((pSim->Opcode == SPIMEMSIM_SRAM_EDIO) && ((pDev->IOmodes & SPIMEMSIM_SDI) > 0)) pDev->CurrentIOmode = SPIMEMSIM_SDI;
+      if ((pSim->Opcode == SPIMEMSIM_SRAM_EQIO) && ((pDev->IOmodes & SPIMEMSIM_SQI) > 0)) pDev->CurrentIOmode = SPIMEMSIM_SQI;
+      if  (pSim->Opcode == SPIMEMSIM_SRAM_RSTIO) pDev->CurrentIOmode = SPIMEMSIM_SPI;
+    }
+    else
+    {
+      const bool WriteEnable = ((pDev->StatusRegister & SPIMEMSIM_EERAM_WEL) > 0);
+      switch (pSim->Opcode)
+      {
+        case SPIMEMSIM_EERAM_WREN: pDev->StatusRegister |=  SPIMEMSIM_EERAM_WEL; break;
+        case SPIMEMSIM_EERAM_WRDI: pDev->StatusRegister &= ~SPIMEMSIM_EERAM_WEL; break;
+        case SPIMEMSIM_EERAM_SWRITE:
+          if (WriteEnable)                                                    // The page is written only with a full page, an aligned address, and a good CRC
+          {
+            const bool Valid = (pSim->DataCount == (pDev->PageSize + 2u)) && ((pSim->Address & ((uint32_t)pDev->PageSize - 1u)) == 0)
+                            && (pSim->CRC == pSim->ReceivedCRC) && (__SPIMemSim_IsProtected(pDev, pSim->Address) == false);
+            if (Valid) memcpy(&pDev->Memory[pSim->Address], &pSim->Buffer[0], pDev->PageSize);
+            if (Valid) pDev->StatusRegister &= ~SPIMEMSIM_EERAM_SWM; else pDev->StatusRegister |= SPIMEMSIM_EERAM_SWM;
+          }
+          pDev->StatusRegister &= ~SPIMEMSIM_EERAM_WEL;
+          break;
+        case SPIMEMSIM_EERAM_WRITE:
+        case SPIMEMSIM_EERAM_WRSR:
+        case SPIMEMSIM_EERAM_WRNUR:
+          pDev->StatusRegister &= ~SPIMEMSIM_EERAM_WEL;                       // The write enable latch is reset at the end of a write
+          break;
+        case SPIMEMSIM_EERAM_STORE:
+          if (pDev->Backup != NULL) memcpy(&pDev->Backup[0], &pDev->Memory[0], pDev->ArrayByteSize);
+          pDev->BusyUntilns = endTimens + (pDev->StoreTimeus > 0 ? pDev->StoreTimeus : SPIMEMSIM_EERAM_STORE_DEFAULT_US) * 1000ull;
+          pDev->StoreCycles++;
+          break;
+        case SPIMEMSIM_EERAM_RECALL:
+          if (pDev->Backup != NULL) memcpy(&pDev->Memory[0], &pDev->Backup[0], pDev->ArrayByteSize);
+          pDev->BusyUntilns = endTimens + (pDev->RecallTimeus > 0 ? pDev->RecallTimeus : SPIMEMSIM_EERAM_RECALL_DEFAULT_US) * 1000ull;
+          break;
+        case SPIMEMSIM_EERAM_HBRNT:
+          pDev->Hibernate = true;
+          break;
+        default: break;
+      }
+    }
+  }
+  pSim->pCurrent      = NULL;
+  pSim->InTransaction = false;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Simulated SPI interface transfer
+//=============================================================================
+eERRORRESULT SPIMemSim_InterfaceTransfer(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketDesc)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pIntDev == NULL) || (pPacketDesc == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != SPIMEMSIM_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  SPI_MemorySim* pSim = (SPI_MemorySim*)pIntDev->InterfaceDevice;
+  if (pSim == NULL) return ERR_GENERATE(ERR__SPI_PARAMETER_ERROR);
+  const bool NonBlocking = (pSim->SupportNonBlocking && (pPacketDesc->Config.Bits.IsNonBlocking > 0));
+  uint64_t Now = MemorySim_GetTimens();
+  pSim->Stats.TransferCalls++;
+  pSim->Stats.LastCallBusTimens = 0;
+
+  //--- Non-blocking transfers ---
+  const uint8_t TransactionNumber = (uint8_t)SPI_TRANSACTION_NUMBER_GET(pPacketDesc->Config.Value);
+  if (NonBlocking && (TransactionNumber != 0))                                                  // This is a check of the status of a non-blocking transfer
+  {
+    if ((TransactionNumber == pSim->TransactionNumber) && (Now < pSim->NonBlockingEndns)) return ERR_GENERATE(ERR__SPI_BUSY);
+    return ERR_NONE;
+  }
+  if (Now < pSim->NonBlockingEndns)                                                             // A non-blocking transfer is in progress
+  {
+    if (NonBlocking) return ERR_GENERATE(ERR__SPI_OTHER_BUSY);
+    MemorySim_AdvanceTime(pSim->NonBlockingEndns - Now);                                        // A blocking transfer waits the end of the non-blocking one
+    Now = pSim->NonBlockingEndns;
+  }
+
+  //--- Chip select ---
+  if (pSim->InTransaction == false)
+  {
+    pSim->pCurrent = __SPIMemSim_StartTransaction(pSim, pPacketDesc->ChipSelect, Now);
+    if ((pSim->pCurrent == NULL) || (pSim->pCurrent->SCKfrequency == 0)) return ERR_GENERATE(ERR__SPI_CONFIG_ERROR); // No device or interface not initialized on this chip select
+    pSim->InTransaction = true;
+  }
+  else if (pSim->pCurrent->ChipSelect != pPacketDesc->ChipSelect) return ERR_GENERATE(ERR__SPI_COMM_ERROR); // Another chip select is still asserted
+  SPIMemSim_Device* pDev = pSim->pCurrent;
+
+  //--- Data ---
+  const bool UseDummyByte = ((pPacketDesc->Config.Bits.UseDummyByte > 0) || (pPacketDesc->TxData == NULL));
+  for (size_t z = 0; z < pPacketDesc->DataSize; ++z)
+  {
+    const uint8_t TxByte = (UseDummyByte ? pPacketDesc->DummyByte : pPacketDesc->TxData[z]);
+    const uint8_t RxByte = (pDev->Type == SPIMEMSIM_SRAM23LCxxx ? __SPIMemSim_SRAMExchange(pSim, pDev, TxByte) : __SPIMemSim_EERAMExchange(pSim, pDev, TxByte));
+    if (pPacketDesc->RxData != NULL) pPacketDesc->RxData[z] = RxByte;
+  }
+  pSim->Stats.Bytes += pPacketDesc->DataSize;
+
+  //--- Bus time and chip select deassertion ---
+  const uint64_t Cycles = (uint64_t)pPacketDesc->DataSize * (8u / pDev->InterfacePins);        // 8, 4, or 2 SCK cycles per byte in SPI, SDI, or SQI
+  const uint64_t BusTimens = MemorySim_AddBusActivity(&pSim->Stats, Cycles, pDev->SCKfrequency);
+  if (pPacketDesc->Terminate)
+  {
+    pSim->Stats.Transactions++;
+    __SPIMemSim_EndTransaction(pSim, Now + BusTimens);                                          // The device executes the command at the chip select deassertion
+  }
+  if (NonBlocking && pPacketDesc->Terminate)                                                    // The transfer continues in background. The first part of a transaction is always blocking
+  {
+    pSim->NonBlockingEndns  = Now + BusTimens;
+    pSim->TransactionNumber = (uint8_t)((pSim->TransactionNumber % SPI_TRANSACTION_NUMBER_Mask) + 1u);
+    pPacketDesc->Config.Value &= ~(uint16_t)(SPI_TRANSACTION_NUMBER_Mask << SPI_TRANSACTION_NUMBER_Pos);
+    pPacketDesc->Config.Value |= SPI_TRANSACTION_NUMBER_SET(pSim->TransactionNumber);
+    return ERR_GENERATE(ERR__SPI_BUSY);
+  }
+  MemorySim_AdvanceTime(BusTimens);
+  return ERR_NONE;
+}
+
+
+
+//=============================================================================
+// Simulated SPI interface vectored transfer
+//=============================================================================
+eERRORRESULT SPIMemSim_InterfaceTransferV(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketsDesc, size_t count)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pIntDev == NULL) || (pPacketsDesc == NULL)) return ERR_GENERATE(ERR__PARAMETER_ERROR);
+#endif
+  if (pIntDev->UniqueID != SPIMEMSIM_UNIQUE_ID) return ERR_GENERATE(ERR__UNKNOWN_DEVICE);
+  SPI_MemorySim* pSim = (SPI_MemorySim*)pIntDev->InterfaceDevice;
+  if (pSim == NULL) return ERR_GENERATE(ERR__SPI_PARAMETER_ERROR);
+  const uint32_t TransferCalls = pSim->Stats.TransferCalls;
+  uint64_t BusTimens = 0;
+  eERRORRESULT Error = ERR_NONE;
+
+  for (size_t zPacket = 0; zPacket < count; ++zPacket)
+  {
+    Error = SPIMemSim_InterfaceTransfer(pIntDev, &pPacketsDesc[zPacket]);
+    BusTimens += pSim->Stats.LastCallBusTimens;
+    if (Error != ERR_NONE) break;                                                           // The transfer stops at the first segment in error (or the last segment in background)
+  }
+  pSim->Stats.TransferCalls     = TransferCalls + 1u;                                       // The whole vector is 1 call
+  pSim->Stats.LastCallBusTimens = BusTimens;
+  return Error;
+}
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
@@ -0,0 +1,238 @@
+/*!*****************************************************************************
+ * @file    SPI_MemorySim.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.1.0
+ * @date    16/10/2026
+ * @brief   Simulated SPI bus with SRAM and EERAM devices
+ * @details Host-side SPI interface that can be set in a struct SPI_Interface
+ * instead of a real SPI peripheral. Each simulated device is on its own chip
+ * select and models:
+ * - The SRAM 23LCxxx byte, page, and sequential modes, the EDIO/EQIO/RSTIO I/O mode changes and the dummy byte of reads in SDI and SQI
+ * - The EERAM 48L512/48LM01 WEL latch, block protection, secure read/write with CRC, non-volatile user space, STORE/RECALL with their busy time, and hibernation
+ * - The SCK-accurate bus time with the data pin count of the #eSPIInterface_Mode set by the interface initialization of each chip select
+ * A device in a different I/O mode than the interface ignores the transaction
+ * Only the generic struct SPI_Interface is supported (not the Arduino, nor the STM32 ones)
+ ******************************************************************************/
+ /* @page License
+ *
+ * Copyright (c) 2026 Fabien MAILLY
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+ * EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *****************************************************************************/
+
+/* Revision history:
+ * 1.1.0    Add SPIMemSim_InterfaceTransferV()
+ * 1.0.0    Release version
+ *****************************************************************************/
+#ifndef SPI_MEMORYSIM_H_INC
+#define SPI_MEMORYSIM_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "ErrorsDef.h"
+#include "SPI_Interface.h"
+#include "MemorySim.h"
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define SPIMEMSIM_UNIQUE_ID                ( 0x5350494Du ) //!< Unique ID of the simulated SPI interface, to set in the SPI_Interface.UniqueID
+#define SPIMEMSIM_PAGE_BUFFER_SIZE         ( 256u )        //!< Maximum secure page size of a simulated EERAM device
+#define SPIMEMSIM_NVUS_SIZE                ( 16u )         //!< Non-volatile user space size of a simulated EERAM device
+
+//--- I/O modes ---
+#define SPIMEMSIM_SPI                      ( 0x1u )        //!< Device supports SPI (1 data pin), same value as SRAM23LCxxx_SPI
+#define SPIMEMSIM_SDI                      ( 0x2u )        //!< Device supports SDI (2 data pins), same value as SRAM23LCxxx_SDI
+#define SPIMEMSIM_SQI                      ( 0x4u )        //!< Device supports SQI (4 data pins), same value as SRAM23LCxxx_SQI
+
+//--- SRAM 23LCxxx instructions and status register ---
+#define SPIMEMSIM_SRAM_READ                ( 0x03u )       //!< SRAM read data from memory array beginning at selected address
+#define SPIMEMSIM_SRAM_WRITE               ( 0x02u )       //!< SRAM write data to memory array beginning at selected address
+#define SPIMEMSIM_SRAM_EDIO                ( 0x3Bu )       //!< SRAM enter Dual I/O access
+#define SPIMEMSIM_SRAM_EQIO                ( 0x38u )       //!< SRAM enter Quad I/O access
+#define SPIMEMSIM_SRAM_RSTIO               ( 0xFFu )       //!< SRAM reset Dual and Quad I/O access
+#define SPIMEMSIM_SRAM_RDSR                ( 0x05u )       //!< SRAM read status register
+#define SPIMEMSIM_SRAM_WRSR                ( 0x01u )       //!< SRAM write status register
+#define SPIMEMSIM_SRAM_MODE_Mask           ( 0xC0u )       //!< SRAM status register operation mode bits
+#define SPIMEMSIM_SRAM_BYTE_MODE           ( 0x00u )       //!< SRAM byte operation mode
+#define SPIMEMSIM_SRAM_SEQUENTIAL_MODE     ( 0x40u )       //!< SRAM sequential operation mode
+#define SPIMEMSIM_SRAM_PAGE_MODE           ( 0x80u )       //!< SRAM page operation mode
+#define SPIMEMSIM_SRAM_STATUS_WRITABLE     ( 0xC1u )       //!< SRAM status register writable bits (MODE, HOLD)
+
+//--- EERAM 48L512/48LM01 opcodes and status register ---
+#define SPIMEMSIM_EERAM_WREN               ( 0x06u )       //!< EERAM set write enable latch
+#define SPIMEMSIM_EERAM_WRDI               ( 0x04u )       //!< EERAM reset write enable latch
+#define SPIMEMSIM_EERAM_WRITE              ( 0x02u )       //!< EERAM write to SRAM array
+#define SPIMEMSIM_EERAM_READ               ( 0x03u )       //!< EERAM read from SRAM array
+#define SPIMEMSIM_EERAM_SWRITE             ( 0x12u )       //!< EERAM secure write to SRAM array with CRC
+#define SPIMEMSIM_EERAM_SREAD              ( 0x13u )       //!< EERAM secure read from SRAM array with CRC
+#define SPIMEMSIM_EERAM_WRSR               ( 0x01u )       //!< EERAM write status register
+#define SPIMEMSIM_EERAM_RDSR               ( 0x05u )       //!< EERAM read status register
+#define SPIMEMSIM_EERAM_STORE              ( 0x08u )       //!< EERAM store SRAM data to EEPROM array
+#define SPIMEMSIM_EERAM_RECALL             ( 0x09u )       //!< EERAM copy EEPROM data to SRAM array
+#define SPIMEMSIM_EERAM_WRNUR              ( 0xC2u )       //!< EERAM write non-volatile user space
+#define SPIMEMSIM_EERAM_RDNUR              ( 0xC3u )       //!< EERAM read non-volatile user space
+#define SPIMEMSIM_EERAM_HBRNT              ( 0xB9u )       //!< EERAM enter hibernate mode
+#define SPIMEMSIM_EERAM_BUSY               ( 0x01u )       //!< EERAM status register RDY/BSY bit
+#define SPIMEMSIM_EERAM_WEL                ( 0x02u )       //!< EERAM status register WEL bit
+#define SPIMEMSIM_EERAM_BP_Mask            ( 0x0Cu )       //!< EERAM status register block protection bits
+#define SPIMEMSIM_EERAM_SWM                ( 0x10u )       //!< EERAM status register secure write monitoring bit
+#define SPIMEMSIM_EERAM_STATUS_WRITABLE    ( 0x4Cu )       //!< EERAM status register writable bits (BP, ASE)
+#define SPIMEMSIM_EERAM_STORE_DEFAULT_US   ( 10000u )      //!< EERAM default store time if the device StoreTimeus is 0
+#define SPIMEMSIM_EERAM_RECALL_DEFAULT_US  ( 50u )         //!< EERAM default recall time if the device RecallTimeus is 0
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Simulated device
+//********************************************************************************************************************
+
+//! Simulated SPI memory device type enumerator
+typedef enum
+{
+  SPIMEMSIM_SRAM23LCxxx = 0, //!< SPI SRAM device (23A640/23K640, 23A256/23K256, 23A512/23LC512, 23A1024/23LC1024, 23LCV512, 23LCV1024)
+  SPIMEMSIM_EERAM48Lxxx = 1, //!< SPI EERAM device (48L512, 48LM01)
+} eSPIMemSim_DeviceType;
+
+
+//! Simulated SPI memory device
+typedef struct SPIMemSim_Device
+{
+  eSPIMemSim_DeviceType Type;  //!< Type of the device
+  uint8_t ChipSelect;          //!< Chip select index of the device on the bus. Same value as the SPIchipSelect of the driver
+  uint8_t* Memory;             //!< SRAM array of the device of ArrayByteSize bytes, this parameter is mandatory
+  uint8_t* Backup;             //!< EEPROM array of ArrayByteSize bytes (EERAM only). Can be NULL, then STORE and RECALL only simulate their busy time
+  uint32_t ArrayByteSize;      //!< Size of the SRAM array in bytes
+  uint8_t AddressBytes;        //!< Count of address bytes of the READ and WRITE instructions (2 or 3)
+  uint16_t PageSize;           //!< Page size of the SRAM page mode, or secure page size (EERAM), shall be a power of 2
+  uint8_t IOmodes;             //!< Supported I/O modes: OR'ed values of #SPIMEMSIM_SPI, #SPIMEMSIM_SDI, #SPIMEMSIM_SQI. The EERAM only supports SPI
+  uint32_t MaxSCKfrequency;    //!< Maximum SCK frequency of the device in Hertz, checked at the interface initialization. Set 0 to not check
+  uint32_t StoreTimeus;        //!< Store time (EERAM only) in microseconds. Set 0 to use #SPIMEMSIM_EERAM_STORE_DEFAULT_US
+  uint32_t RecallTimeus;       //!< Recall time (EERAM only) in microseconds. Set 0 to use #SPIMEMSIM_EERAM_RECALL_DEFAULT_US
+
+  //--- Simulation state ---
+  uint8_t StatusRegister;      //!< Status register of the device. Set the power-up value at the declaration (SRAM: operation mode ; EERAM: ASE and BP)
+  uint8_t CurrentIOmode;       //!< Current I/O mode of the device: #SPIMEMSIM_SPI, #SPIMEMSIM_SDI, or #SPIMEMSIM_SQI. 0 is SPI
+  uint8_t NVUserSpace[SPIMEMSIM_NVUS_SIZE]; //!< Non-volatile user space (EERAM only)
+  uint8_t InterfacePins;       //!< Data pin count of the interface for this chip select (1, 2, or 4), set by the interface initialization
+  uint32_t SCKfrequency;       //!< SCK frequency in Hertz of the interface for this chip select, set by the interface initialization
+  uint64_t BusyUntilns;        //!< The device is in a STORE or RECALL operation until this simulated time (EERAM only)
+  bool Hibernate;              //!< The device is in hibernation, the next transaction wakes it up and is ignored (EERAM only)
+  uint32_t StoreCycles;        //!< Count of store operations since the device declaration (EERAM only)
+} SPIMemSim_Device;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// Simulated SPI bus
+//********************************************************************************************************************
+
+//! Simulated SPI bus transaction phase enumerator
+typedef enum
+{
+  SPIMEMSIM_PHASE_OPCODE  = 0, //!< Waiting the instruction or opcode
+  SPIMEMSIM_PHASE_ADDRESS = 1, //!< Receiving the address
+  SPIMEMSIM_PHASE_DUMMY   = 2, //!< Sending the dummy byte (SRAM in SDI and SQI)
+  SPIMEMSIM_PHASE_DATA    = 3, //!< Transferring data
+  SPIMEMSIM_PHASE_IGNORE  = 4, //!< The device ignores the rest of the transaction
+} eSPIMemSim_Phase;
+
+
+//! Simulated SPI bus object structure
+typedef struct SPI_MemorySim
+{
+  SPIMemSim_Device* Devices;          //!< Array of the devices on the bus, this parameter is mandatory
+  size_t DeviceCount;                 //!< Count of devices in the Devices array
+  bool SupportNonBlocking;            //!< 'true' = the last packet of a transaction with SPI_USE_NON_BLOCKING is simulated as a DMA transfer in background ; 'false' = all packets are blocking transfers
+  MemorySim_BusStats Stats;           //!< Bus statistics, use SPIMemSim_ResetStats() to clear
+  uint32_t IOmodeMismatches;          //!< Count of transactions ignored because the device and the interface are not in the same I/O mode
+
+  //--- Simulation state ---
+  SPIMemSim_Device* pCurrent;         //!< Device selected by the current transaction, NULL if no device
+  bool InTransaction;                 //!< The chip select is asserted
+  bool DeviceBusy;                    //!< The device was busy at the start of the current transaction
+  eSPIMemSim_Phase Phase;             //!< Phase of the current transaction
+  uint8_t Opcode;                     //!< Instruction or opcode of the current transaction
+  uint8_t AddrBytesLeft;              //!< Count of address bytes left to receive
+  uint32_t Address;                   //!< Current address of the transaction
+  uint32_t DataCount;                 //!< Count of data bytes transferred in the data phase
+  uint16_t CRC;                       //!< CRC of the secure read or write
+  uint16_t ReceivedCRC;               //!< CRC received with the secure write
+  uint8_t Buffer[SPIMEMSIM_PAGE_BUFFER_SIZE]; //!< Secure write page buffer, the page is written at the end of the transaction if the CRC matches
+  uint64_t NonBlockingEndns;          //!< Simulated time of the end of the current non-blocking transfer
+  uint8_t TransactionNumber;          //!< Transaction number of the last non-blocking transfer (1 to 63)
+} SPI_MemorySim;
+
+//-----------------------------------------------------------------------------
+
+
+/*! @brief Simulated SPI interface initialization
+ *
+ * Set this function in the SPI_Interface.fnSPI_Init of the driver with SPI_Interface.InterfaceDevice pointing to an #SPI_MemorySim and SPI_Interface.UniqueID set to #SPIMEMSIM_UNIQUE_ID
+ * It checks the device on the chip select and sets the data pin count and SCK frequency of this chip select. The memory of the device is not changed
+ * @param[in] *pIntDev Is the SPI interface container structure used for the interface initialization
+ * @param[in] chipSelect Is the Chip Select index to use for the SPI/Dual-SPI/Quad-SPI initialization
+ * @param[in] mode Is the mode of the SPI to configure
+ * @param[in] sckFreq Is the SCK frequency in Hz to set at the interface initialization
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SPIMemSim_InterfaceInit(SPI_Interface *pIntDev, uint8_t chipSelect, eSPIInterface_Mode mode, const uint32_t sckFreq);
+
+/*! @brief Simulated SPI interface transfer
+ *
+ * Set this function in the SPI_Interface.fnSPI_Transfer of the driver. The simulated time advances by the bus time of the packet for a blocking transfer
+ * The bus time of the call is available in SPI_MemorySim.Stats.LastCallBusTimens
+ * @param[in] *pIntDev Is the SPI interface container structure used for the communication
+ * @param[in] *pPacketDesc Is the packet description to transfer through SPI
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SPIMemSim_InterfaceTransfer(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketDesc);
+
+/*! @brief Simulated SPI interface vectored transfer
+ *
+ * Set this function in the SPI_Interface.fnSPI_TransferV of the driver. The segments are transferred as with SPIMemSim_InterfaceTransfer() but the vector counts as 1 call in SPI_MemorySim.Stats.TransferCalls
+ * @param[in] *pIntDev Is the SPI interface container structure used for the communication
+ * @param[in] *pPacketsDesc Is the array of the segment descriptions to transfer through SPI
+ * @param[in] count Is the count of segments in the array
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SPIMemSim_InterfaceTransferV(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketsDesc, size_t count);
+
+/*! @brief Reset the statistics of a simulated SPI bus
+ *
+ * @param[in] *pSim Is the pointed structure of the simulated bus
+ */
+void SPIMemSim_ResetStats(SPI_MemorySim *pSim);
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* SPI_MEMORYSIM_H_INC */
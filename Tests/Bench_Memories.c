@@ -0,0 +1,227 @@
+/*!*****************************************************************************
+ * @file    Bench_Memories.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Benchmark of the memory drivers on the simulated buses
+ * @details Runs the write functions of the drivers with MemoryBench over sizes
+ * and alignments, prints the reports (overall and per size), and checks each
+ * overall report against the budget file given in argument. Returns 1 if an
+ * operation fails or is out of its budget
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "EEPROM.h"
+#include "23LCxxx.h"
+#include "48LM01.h"
+#include "47x16.h"
+#include "I2C_MemorySim.h"
+#include "SPI_MemorySim.h"
+#include "MemoryBench.h"
+//-----------------------------------------------------------------------------
+
+#define BENCH_MAX_SIZES     ( 4u )
+#define BENCH_MAX_OFFSETS   ( 3u )
+#define BENCH_LATENCIES     ( BENCH_MAX_SIZES * BENCH_MAX_OFFSETS )
+
+//! Benchmark of 1 driver function
+typedef struct Bench_Operation
+{
+  const char* Name;                 //!< Name of the operation in the budget file
+  MemoryBench_Func fnOperation;     //!< Function to measure
+  void *pContext;                   //!< Context of the function
+  MemorySim_BusStats* pBusStats;    //!< Statistics of the bus of the device
+  uint32_t BaseAddress;             //!< Base address of the operations
+  size_t Sizes[BENCH_MAX_SIZES];    //!< Sizes to sweep
+  uint32_t Offsets[BENCH_MAX_OFFSETS]; //!< Address offsets to sweep
+} Bench_Operation;
+
+//-----------------------------------------------------------------------------
+
+static uint8_t MemEeprom[32768], MemEeram47[2048], MemSram[131072], MemEeram48[131072];
+static uint8_t Data[1024];
+
+static I2CMemSim_Device I2CDevices[] =
+{
+  { .Type = I2CMEMSIM_EEPROM,     .Conf = &_24LC256_Conf,    .AddrA2A1A0 = 0, .Memory = MemEeprom,  .WriteCycleTimeus = 5000 },
+  { .Type = I2CMEMSIM_EERAM47xxx, .Conf = &EERAM47L16_Conf,  .AddrA2A1A0 = EERAM47x16_ADDR(1, 0), .Memory = MemEeram47, .WriteCycleTimeus = 25000 },
+};
+static I2C_MemorySim SimI2C = { .Devices = I2CDevices, .DeviceCount = 2, .SupportNonBlocking = false };
+
+static SPIMemSim_Device SPIDevices[] =
+{
+  { .Type = SPIMEMSIM_SRAM23LCxxx,  .ChipSelect = 0, .Memory = MemSram,    .ArrayByteSize = 131072, .AddressBytes = 3, .PageSize = 32,  .IOmodes = SPIMEMSIM_SPI | SPIMEMSIM_SDI | SPIMEMSIM_SQI, .MaxSCKfrequency = 20000000 },
+  { .Type = SPIMEMSIM_EERAM48Lxxx,  .ChipSelect = 1, .Memory = MemEeram48, .ArrayByteSize = 131072, .AddressBytes = 3, .PageSize = 128, .IOmodes = SPIMEMSIM_SPI, .MaxSCKfrequency = 66000000 },
+};
+static SPI_MemorySim SimSPI = { .Devices = SPIDevices, .DeviceCount = 2, .SupportNonBlocking = false };
+
+static EEPROM Eeprom = { .Conf = &_24LC256_Conf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = I2CMemSim_InterfaceTransfer, },
+                         .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = 0, };
+static EERAM47x16 Eeram47 = { .Eeprom = { .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = I2CMemSim_InterfaceTransfer, },
+                              .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = EERAM47x16_ADDR(1, 0), }, }; // Not on the same chip address as the EEPROM
+static SRAM23LCxxx Sram = { .Conf = &SRAM23LC1024_Conf, .SPIchipSelect = 0, .SPI = { .InterfaceDevice = &SimSPI, .UniqueID = SPIMEMSIM_UNIQUE_ID, .fnSPI_Init = SPIMemSim_InterfaceInit, .fnSPI_Transfer = SPIMemSim_InterfaceTransfer, },
+                            .SPIclockSpeed = 20000000, };
+static EERAM48LM01 Eeram48 = { .SPIchipSelect = 1, .SPI = { .InterfaceDevice = &SimSPI, .UniqueID = SPIMEMSIM_UNIQUE_ID, .fnSPI_Init = SPIMemSim_InterfaceInit, .fnSPI_Transfer = SPIMemSim_InterfaceTransfer, },
+                               .SPIclockSpeed = 20000000, .fnGetCurrentms = MemorySim_GetCurrentms, };
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Host time in nanoseconds
+//=============================================================================
+static uint64_t Bench_GetHostns(void)
+{
+  struct timespec Now;
+  clock_gettime(CLOCK_MONOTONIC, &Now);
+  return ((uint64_t)Now.tv_sec * 1000000000ull) + (uint64_t)Now.tv_nsec;
+}
+
+
+//=============================================================================
+// Wrappers of the driver functions to measure
+//=============================================================================
+static eERRORRESULT Bench_EEPROMWrite(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  eERRORRESULT Error = EEPROM_WriteData((EEPROM*)pContext, address, data, size);
+  if (Error != ERR_NONE) return Error;
+  return EEPROM_WaitEndOfWrite((EEPROM*)pContext);                   // The latency includes the write cycle of the last page
+}
+
+static eERRORRESULT Bench_SRAMWrite(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  return SRAM23LCxxx_WriteSRAMData((SRAM23LCxxx*)pContext, address, data, size);
+}
+
+static eERRORRESULT Bench_EERAM48WriteSecure(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  eERRORRESULT Error = EERAM48LM01_SetWriteEnable((EERAM48LM01*)pContext);
+  if (Error != ERR_NONE) return Error;
+  return EERAM48LM01_WriteSecure((EERAM48LM01*)pContext, address, data, size);
+}
+
+static eERRORRESULT Bench_EERAM47Store(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  eERRORRESULT Error = EERAM47x16_WriteSRAMData((EERAM47x16*)pContext, (uint16_t)address, data, size); // Modify the SRAM, then store it
+  if (Error != ERR_NONE) return Error;
+  return EERAM47x16_StoreSRAMtoEEPROM((EERAM47x16*)pContext, false, true);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Find the budget of an operation in the budget file
+//=============================================================================
+static bool Bench_GetBudget(const char* path, const char* name, MemoryBench_Budget* pBudget)
+{
+  FILE* pFile = fopen(path, "r");
+  if (pFile == NULL) return false;
+  char Line[256], Name[64];
+  bool Found = false;
+  while ((Found == false) && (fgets(Line, sizeof(Line), pFile) != NULL))
+  {
+    if ((Line[0] == '#') || (Line[0] == '\n')) continue;             // Comment or empty line
+    unsigned long long MinBps, MinBusBps, MaxP50, MaxP99;
+    unsigned MaxCPU, MaxTPKB;
+    if (sscanf(Line, "%63s %llu %llu %u %u %llu %llu", Name, &MinBps, &MinBusBps, &MaxCPU, &MaxTPKB, &MaxP50, &MaxP99) != 7) continue;
+    if (strcmp(Name, name) != 0) continue;
+    *pBudget = (MemoryBench_Budget){ .MinBytesPerSecond = MinBps, .MinBusBytesPerSecond = MinBusBps, .MaxCPUnsPerByte = MaxCPU,
+                                     .MaxTransactionsPerKB = MaxTPKB, .MaxP50ns = MaxP50, .MaxP99ns = MaxP99, };
+    Found = true;
+  }
+  fclose(pFile);
+  return Found;
+}
+
+
+//=============================================================================
+// Print a report
+//=============================================================================
+static void Bench_PrintReport(const char* name, const char* what, const MemoryBench_Report* pReport)
+{
+  printf("%-28s %-9s %10llu %10llu %7u %7u %11llu %11llu\n", name, what, (unsigned long long)pReport->BytesPerSecond, (unsigned long long)pReport->BusBytesPerSecond,
+         pReport->CPUnsPerByte, pReport->TransactionsPerKB, (unsigned long long)pReport->P50ns, (unsigned long long)pReport->P99ns);
+}
+
+
+//=============================================================================
+// Run the benchmark of an operation and check its budget
+//=============================================================================
+static bool Bench_RunOperation(const Bench_Operation* pOp, const char* budgetPath)
+{
+  uint64_t Latencies[BENCH_LATENCIES];
+  MemoryBench Bench = { .fnOperation = pOp->fnOperation, .pContext = pOp->pContext, .pBusStats = pOp->pBusStats, .fnGetHostns = Bench_GetHostns,
+                        .Latencies = &Latencies[0], .LatencyCapacity = BENCH_LATENCIES, };
+  MemoryBench_Report Report, SizeReports[BENCH_MAX_SIZES];
+  MemoryBench_Budget Budget;
+  char What[16];
+
+  MemoryBench_Reset(&Bench);
+  eERRORRESULT Error = MemoryBench_Sweep(&Bench, pOp->BaseAddress, &Data[0], &pOp->Sizes[0], BENCH_MAX_SIZES, &pOp->Offsets[0], BENCH_MAX_OFFSETS, &SizeReports[0]);
+  if (Error == ERR_NONE) Error = MemoryBench_GetReport(&Bench, &Report);
+  if (Error != ERR_NONE) { printf("%-28s FAILED with error %d\n", pOp->Name, (int)Error); return false; }
+  for (size_t s = 0; s < BENCH_MAX_SIZES; ++s)
+  {
+    snprintf(What, sizeof(What), "%zu B", pOp->Sizes[s]);
+    Bench_PrintReport(pOp->Name, What, &SizeReports[s]);
+  }
+  Bench_PrintReport(pOp->Name, "all", &Report);
+
+  //--- Check the budget ---
+  if (Bench_GetBudget(budgetPath, pOp->Name, &Budget) == false) { printf("%-28s NO BUDGET in %s\n", pOp->Name, budgetPath); return false; }
+  if (MemoryBench_CheckBudget(&Report, &Budget) != ERR_NONE) { printf("%-28s OUT OF BUDGET\n", pOp->Name); return false; }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) { printf("Usage: %s <budget file>\n", argv[0]); return 1; }
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)(z * 7u + 1u);
+  MemorySim_ResetTime();
+  bool Success = true;
+
+  //--- I2C devices ---
+  if ((Init_EEPROM(&Eeprom) != ERR_NONE) || (Init_EERAM47x16(&Eeram47) != ERR_NONE)) { printf("I2C devices initialization failed\n"); return 1; }
+  const Bench_Operation I2COperations[] =
+  {
+    { "EEPROM_WriteData",             Bench_EEPROMWrite,  &Eeprom,  &SimI2C.Stats, 0x0000, { 1, 8, 64, 256 }, { 0, 1, 63 } },
+    { "EERAM47x16_StoreSRAMtoEEPROM", Bench_EERAM47Store, &Eeram47, &SimI2C.Stats, 0x0000, { 1, 8, 64, 256 }, { 0, 1, 63 } },
+  };
+
+  //--- SPI devices ---
+  if (Init_EERAM48LM01(&Eeram48) != ERR_NONE) { printf("SPI EERAM initialization failed\n"); return 1; }
+  const Bench_Operation SPIOperations[] =
+  {
+    { "SRAM23LCxxx_WriteSRAMData",    Bench_SRAMWrite,          &Sram,    &SimSPI.Stats, 0x1000, { 1, 8, 32, 256 }, { 0, 1, 31 } },
+    { "EERAM48LM01_WriteSecure",      Bench_EERAM48WriteSecure, &Eeram48, &SimSPI.Stats, 0x1000, { 128, 256, 512, 1024 }, { 0, 128, 256 } },
+  };
+
+  printf("%-28s %-9s %10s %10s %7s %7s %11s %11s\n", "Operation", "Size", "B/s", "Bus B/s", "CPUns/B", "Tr/KB", "p50 ns", "p99 ns");
+  for (size_t z = 0; z < (sizeof(I2COperations) / sizeof(I2COperations[0])); ++z) Success &= Bench_RunOperation(&I2COperations[z], argv[1]);
+  Success &= Bench_RunOperation(&SPIOperations[1], argv[1]);
+
+  //--- SRAM in its 3 operation modes ---
+  const eSRAM23LCxxx_Modes Modes[] = { SRAM23LCxxx_BYTE_MODE, SRAM23LCxxx_PAGE_MODE, SRAM23LCxxx_SEQUENTIAL_MODE, };
+  const char* ModeNames[] = { "SRAM23LCxxx_Write_Byte", "SRAM23LCxxx_Write_Page", "SRAM23LCxxx_Write_Seq", };
+  for (size_t m = 0; m < (sizeof(Modes) / sizeof(Modes[0])); ++m)
+  {
+    const SRAM23LCxxx_Config SramConf = { .RecoverSPIbus = true, .IOmode = SRAM23LCxxx_SPI, .OperationMode = Modes[m], .DisableHold = true, };
+    if (Init_SRAM23LCxxx(&Sram, &SramConf) != ERR_NONE) { printf("SPI SRAM initialization failed\n"); return 1; }
+    Bench_Operation Op = SPIOperations[0];
+    Op.Name = ModeNames[m];
+    Success &= Bench_RunOperation(&Op, argv[1]);
+  }
+  return (Success ? 0 : 1);
+}
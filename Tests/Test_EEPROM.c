@@ -0,0 +1,488 @@
+/*!*****************************************************************************
+ * @file    Test_EEPROM.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the generic EEPROM driver on the simulated I2C bus
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "EEPROM.h"
+#include "I2C_MemorySim.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+static uint8_t Memory[262144];
+static I2CMemSim_Device Device = { .Type = I2CMEMSIM_EEPROM, .Conf = &_24LC256_Conf, .AddrA2A1A0 = 0, .Memory = Memory, .WriteCycleTimeus = 5000 };
+static I2C_MemorySim SimI2C = { .Devices = &Device, .DeviceCount = 1, .SupportNonBlocking = false };
+static size_t MaxPacketSize = 0; // Biggest data packet transferred
+static bool NackReadData = false; // 'true' if the device does not acknowledge the data of the reads
+static size_t NoStartPackets = 0; // Count of packets transferred without START, that continue the previous packet
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Transfer on the simulated I2C bus and record the biggest packet
+//=============================================================================
+static eERRORRESULT Test_Transfer(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc)
+{
+  if (pPacketDesc->BufferSize > MaxPacketSize) MaxPacketSize = pPacketDesc->BufferSize;
+  if (NackReadData && ((pPacketDesc->ChipAddr & I2C_READ_ORMASK) > 0)) return ERR__I2C_NACK_DATA;
+  if (pPacketDesc->Start == false) ++NoStartPackets;
+  return I2CMemSim_InterfaceTransfer(pIntDev, pPacketDesc);
+}
+
+
+//=============================================================================
+// Transfer a packet chain on the simulated I2C bus
+//=============================================================================
+static eERRORRESULT Test_TransferChain(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketsDesc, size_t count)
+{
+  for (size_t z = 0; z < count; ++z)
+    if (NackReadData && ((pPacketsDesc[z].ChipAddr & I2C_READ_ORMASK) > 0)) return ERR__I2C_NACK_DATA;
+  return I2CMemSim_InterfaceTransferChain(pIntDev, pPacketsDesc, count);
+}
+
+
+//=============================================================================
+// Create an EEPROM object of the simulated 24LC256
+//=============================================================================
+static EEPROM Test_NewEEPROM(const EEPROM_Conf* pConf, uint8_t options)
+{
+  EEPROM Eeprom = { .Conf = pConf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = Test_Transfer, },
+                    .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = 0, .Options = options, };
+  return Eeprom;
+}
+
+
+//=============================================================================
+// Reset the simulated device: each byte of the page n is n
+//=============================================================================
+static void Test_ResetDevice(const EEPROM_Conf* pConf)
+{
+  Device.Conf = pConf;
+  for (size_t z = 0; z < sizeof(Memory); ++z) Memory[z] = (uint8_t)(z / pConf->PageSize);
+  MemorySim_ResetTime();
+  Device.BusyUntilns = 0;                                               // No write cycle left by the previous test
+  Device.ReadRollOverInBlock = false;
+  SimI2C.SupportNonBlocking = false;
+  SimI2C.NonBlockingNack    = false;
+  I2CMemSim_ResetStats(&SimI2C);
+  MaxPacketSize = 0;
+  NackReadData  = false;
+  NoStartPackets = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// The current address read counter is the device address shared by the views of the device
+//=============================================================================
+static bool Test_CurrentAddressSharedByViews(void)
+{
+  Test_ResetDevice(&_24LC256_Conf);
+  EEPROM_Conf ViewConf = _24LC256_Conf;
+  ViewConf.OffsetAddress = 10 * ViewConf.PageSize;                    // The view starts at page 10 of the device
+  ViewConf.TotalByteSize = 20 * ViewConf.PageSize;
+  EEPROM Base = Test_NewEEPROM(&_24LC256_Conf, EEPROM_CURRENT_ADDRESS_READ);
+  EEPROM View = Test_NewEEPROM(&ViewConf, EEPROM_CURRENT_ADDRESS_READ);
+  View.pSharedCurrentAddress = &Base.CurrentAddress;
+  TEST_CHECK(Init_EEPROM(&Base) == ERR_NONE);
+  TEST_CHECK(Init_EEPROM(&View) == ERR_NONE);
+  uint8_t Data[4];
+
+  //--- A read of the base at the view relative address does not make a current address read on the view ---
+  TEST_CHECK(EEPROM_ReadData(&Base, 60, &Data[0], 4) == ERR_NONE);   // The device counter is at 64
+  TEST_CHECK(EEPROM_ReadData(&View, 64, &Data[0], 4) == ERR_NONE);
+  TEST_CHECK((Data[0] == 11) && (Data[3] == 11));                     // Page 11 of the device, not page 1
+
+  //--- A read of the base moves the counter of the view ---
+  TEST_CHECK(EEPROM_ReadData(&View, 0, &Data[0], 4) == ERR_NONE);    // The device counter is at 644
+  TEST_CHECK(EEPROM_ReadData(&Base, 128, &Data[0], 4) == ERR_NONE);  // The device counter is at 132
+  TEST_CHECK(EEPROM_ReadData(&View, 4, &Data[0], 4) == ERR_NONE);
+  TEST_CHECK((Data[0] == 10) && (Data[3] == 10));
+
+  //--- A read that continues on the other object is a current address read ---
+  const uint32_t Transactions = SimI2C.Stats.Transactions;
+  TEST_CHECK(EEPROM_ReadData(&Base, 648, &Data[0], 4) == ERR_NONE);
+  TEST_CHECK((Data[0] == 10) && (Data[3] == 10));
+  TEST_CHECK((SimI2C.Stats.Transactions - Transactions) == 1);         // No address phase
+  return true;
+}
+
+
+//=============================================================================
+// A read that ends at a block of the Ax bits does not give a current address read in the next block
+//=============================================================================
+static bool Test_CurrentAddressAcrossBlock(void)
+{
+  uint8_t Data[32];
+  Test_ResetDevice(&AT24C16A_Conf);
+  Device.ReadRollOverInBlock = true;                                   // The address counter of the device rolls over inside the block of 256 bytes
+  EEPROM Eeprom = Test_NewEEPROM(&AT24C16A_Conf, EEPROM_CURRENT_ADDRESS_READ);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+
+  //--- Read up to the end of the block 0, then the start of the block 1 ---
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 240, &Data[0], 16) == ERR_NONE);
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 256, &Data[16], 16) == ERR_NONE);
+  TEST_CHECK(memcmp(&Data[0], &Memory[240], sizeof(Data)) == 0);
+  TEST_CHECK((Data[15] == 15) && (Data[16] == 16));                    // Page 16 is the first page of the block 1
+
+  //--- A read split at the block boundary ---
+  memset(&Data[0], 0, sizeof(Data));
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 496, &Data[0], 32) == ERR_NONE);
+  TEST_CHECK(memcmp(&Data[0], &Memory[496], sizeof(Data)) == 0);
+
+  //--- Inside a block, the next read is still a current address read ---
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 600, &Data[0], 8) == ERR_NONE);
+  const uint32_t Transactions = SimI2C.Stats.Transactions;
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 608, &Data[0], 8) == ERR_NONE);
+  TEST_CHECK(memcmp(&Data[0], &Memory[608], 8) == 0);
+  TEST_CHECK((SimI2C.Stats.Transactions - Transactions) == 1);         // No address phase
+  return true;
+}
+
+
+
+//=============================================================================
+// A whole memory read is split at the Ax block boundaries and at EEPROM_MAX_READ_SIZE
+//=============================================================================
+static bool Test_ReadSplit(const EEPROM_Conf* pConf, uint32_t expectedTransactions)
+{
+  static uint8_t Data[262144];
+  Test_ResetDevice(pConf);
+  EEPROM Eeprom = Test_NewEEPROM(pConf, EEPROM_NO_OPTION);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  I2CMemSim_ResetStats(&SimI2C);
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 0, &Data[0], pConf->TotalByteSize) == ERR_NONE);
+  TEST_CHECK(memcmp(&Data[0], &Memory[0], pConf->TotalByteSize) == 0);
+  TEST_CHECK(SimI2C.Stats.Transactions == expectedTransactions);
+  TEST_CHECK(MaxPacketSize <= EEPROM_MAX_READ_SIZE);
+  return true;
+}
+
+
+//=============================================================================
+// EEPROM_ReadV() reads the close entries together and the big ones directly
+//=============================================================================
+static bool Test_ReadV(void)
+{
+  uint8_t A[4], B[6], C[8], F[4], G[2], Big[100];
+  Test_ResetDevice(&_24LC256_Conf);
+  for (size_t z = 0; z < sizeof(Memory); ++z) Memory[z] = (uint8_t)(z * 13 + (z >> 8));
+  EEPROM_ReadEntry Entries[7] =                                         // Not sorted
+  {
+    { .Address = 1000, .Data = &A[0],   .Size = sizeof(A)   },
+    { .Address = 2000, .Data = &Big[0], .Size = sizeof(Big) },          // Bigger than EEPROM_READV_BUFFER_SIZE, read directly
+    { .Address = 1036, .Data = &G[0],   .Size = sizeof(G)   },          // 2 bytes after F
+    { .Address =  990, .Data = &B[0],   .Size = sizeof(B)   },          // 4 bytes before A
+    { .Address =  500, .Data = NULL,    .Size = 0           },          // Ignored
+    { .Address = 1002, .Data = &C[0],   .Size = sizeof(C)   },          // Overlaps A
+    { .Address = 1030, .Data = &F[0],   .Size = sizeof(F)   },          // 20 bytes after C, in another read
+  };
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_NO_OPTION);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  I2CMemSim_ResetStats(&SimI2C);
+  TEST_CHECK(EEPROM_ReadV(&Eeprom, &Entries[0], 7) == ERR_NONE);
+  TEST_CHECK(SimI2C.Stats.Transactions == 3);                          // [990, 1010[, [1030, 1038[, and the big entry, instead of 6
+  TEST_CHECK(memcmp(&A[0],   &Memory[1000], sizeof(A))   == 0);
+  TEST_CHECK(memcmp(&B[0],   &Memory[990],  sizeof(B))   == 0);
+  TEST_CHECK(memcmp(&C[0],   &Memory[1002], sizeof(C))   == 0);
+  TEST_CHECK(memcmp(&F[0],   &Memory[1030], sizeof(F))   == 0);
+  TEST_CHECK(memcmp(&G[0],   &Memory[1036], sizeof(G))   == 0);
+  TEST_CHECK(memcmp(&Big[0], &Memory[2000], sizeof(Big)) == 0);
+  for (size_t z = 1; z < 7; ++z) TEST_CHECK(Entries[z - 1].Address <= Entries[z].Address); // The entries are sorted by address
+  return true;
+}
+
+
+//=============================================================================
+// The CRC16-IBM3740 gives the check value of the algorithm and can be continued
+//=============================================================================
+static bool Test_CRC16IBM3740(void)
+{
+  const uint8_t Check[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+  uint16_t CRC = 0xFFFF;
+  EEPROM_ComputeCRC16IBM3740(&CRC, &Check[0], sizeof(Check));
+  TEST_CHECK(CRC == 0x29B1);
+  CRC = 0xFFFF;
+  EEPROM_ComputeCRC16IBM3740(&CRC, &Check[0], 4);
+  EEPROM_ComputeCRC16IBM3740(&CRC, &Check[4], 5);
+  TEST_CHECK(CRC == 0x29B1);
+  return true;
+}
+
+
+//=============================================================================
+// The CRC32 of an area gives the check value of the algorithm whatever the chunks
+//=============================================================================
+static bool Test_ComputeCRC32(void)
+{
+  const uint8_t Check[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+  uint8_t Buffer[48];
+  TEST_CHECK(EEPROM_UpdateCRC32(0, &Check[0], sizeof(Check)) == 0xCBF43926);
+  Test_ResetDevice(&_24LC256_Conf);
+  memcpy(&Memory[60], &Check[0], sizeof(Check));                       // Across the pages 0 and 1
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_NO_OPTION);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  uint32_t CRC = 0;
+  TEST_CHECK(EEPROM_ComputeCRC32(&Eeprom, 60, sizeof(Check), &Buffer[0], 4, &CRC) == ERR_NONE); // Chunks of 4, 4, and 1 bytes
+  TEST_CHECK(CRC == 0xCBF43926);
+
+  //--- An area that is not a multiple of the buffer, in 2 calls ---
+  for (size_t z = 0; z < sizeof(Memory); ++z) Memory[z] = (uint8_t)(z * 13 + (z >> 8));
+  CRC = 0;
+  TEST_CHECK(EEPROM_ComputeCRC32(&Eeprom, 101, 500, &Buffer[0], sizeof(Buffer), &CRC) == ERR_NONE);
+  TEST_CHECK(EEPROM_ComputeCRC32(&Eeprom, 601, 499, &Buffer[0], sizeof(Buffer), &CRC) == ERR_NONE);
+  TEST_CHECK(CRC == EEPROM_UpdateCRC32(0, &Memory[101], 999));
+  return true;
+}
+
+
+//! Context of the verification test
+typedef struct Test_VerifyContext
+{
+  const uint8_t* Expected;  //!< Expected data of the area
+  size_t Calls;             //!< Count of chunks checked
+} Test_VerifyContext;
+
+//=============================================================================
+// Check a chunk of the verification test
+//=============================================================================
+static bool Test_VerifyChunk(void* pContext, size_t offset, const uint8_t* data, size_t size)
+{
+  Test_VerifyContext* const pVerify = (Test_VerifyContext*)pContext;
+  pVerify->Calls++;
+  return (memcmp(&pVerify->Expected[offset], data, size) == 0);
+}
+
+
+//=============================================================================
+// EEPROM_VerifyAgainst() stops at the first chunk that does not hold the expected data
+//=============================================================================
+static bool Test_VerifyAgainst(void)
+{
+  static uint8_t Expected[300];
+  uint8_t Buffer[100];
+  Test_ResetDevice(&_24LC256_Conf);
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_NO_OPTION);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  memcpy(&Expected[0], &Memory[1000], sizeof(Expected));
+  Test_VerifyContext Verify = { .Expected = &Expected[0], .Calls = 0, };
+  TEST_CHECK(EEPROM_VerifyAgainst(&Eeprom, 1000, sizeof(Expected), &Buffer[0], sizeof(Buffer), Test_VerifyChunk, &Verify) == ERR_NONE);
+  TEST_CHECK(Verify.Calls == 3);
+
+  //--- A mismatch in the middle chunk ---
+  Expected[150] ^= 0x01;
+  Verify.Calls = 0;
+  TEST_CHECK(EEPROM_VerifyAgainst(&Eeprom, 1000, sizeof(Expected), &Buffer[0], sizeof(Buffer), Test_VerifyChunk, &Verify) == ERR__BAD_DATA);
+  TEST_CHECK(Verify.Calls == 2);                                        // The last chunk is not read
+  return true;
+}
+
+
+//=============================================================================
+// A NAK of the data is an invalid address with or without packet chain
+//=============================================================================
+static bool Test_NackData(bool withChain)
+{
+  uint8_t Data[4];
+  Test_ResetDevice(&_24LC256_Conf);
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_NO_OPTION);
+  if (withChain) Eeprom.I2C.fnI2C_TransferChain = Test_TransferChain;
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  NackReadData = true;
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 0x100, &Data[0], sizeof(Data)) == ERR__I2C_INVALID_ADDRESS);
+  NackReadData = false;
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 0x100, &Data[0], sizeof(Data)) == ERR_NONE);
+  return true;
+}
+
+
+//=============================================================================
+// Without packet chain, a page of EEPROM_Fill() is 1 packet with the address
+//=============================================================================
+static bool Test_FillWithoutChain(void)
+{
+  const uint8_t Pattern[3] = { 0x12, 0x34, 0x56 };
+  Test_ResetDevice(&_24LC256_Conf);
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_NO_OPTION);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  MaxPacketSize = 0;
+  TEST_CHECK(EEPROM_Fill(&Eeprom, 100, 300, &Pattern[0], sizeof(Pattern)) == ERR_NONE);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(NoStartPackets == 0);
+  TEST_CHECK(MaxPacketSize == (size_t)(2 + _24LC256_Conf.PageSize));   // A whole page and its address
+  for (size_t z = 0; z < 300; ++z) TEST_CHECK(Memory[100 + z] == Pattern[z % sizeof(Pattern)]);
+  TEST_CHECK((Memory[99] == 1) && (Memory[400] == 6));                  // Around the area
+  return true;
+}
+
+
+//=============================================================================
+// With EEPROM_SINGLE_PACKET_WRITE, each page write is 1 packet with the address in front of the data
+//=============================================================================
+static bool Test_SinglePacketWrite(void)
+{
+  uint8_t PacketBuffer[EEPROM_PACKET_BUFFER_SIZE(64)], Data[3 * 64];
+  EEPROM_AsyncTransfer Async = { .State = EEPROM_ASYNC_IDLE, };
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)(z * 5 + 2);
+  Test_ResetDevice(&_24LC256_Conf);
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_SINGLE_PACKET_WRITE);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR__CONFIGURATION);               // The option needs the PacketBuffer
+  Eeprom.PacketBuffer = &PacketBuffer[0];
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+
+  //--- Blocking write of 3 pages ---
+  I2CMemSim_ResetStats(&SimI2C);
+  MaxPacketSize = 0;
+  TEST_CHECK(EEPROM_WriteData(&Eeprom, 64, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK((SimI2C.Stats.TransferCalls - SimI2C.Stats.Nacks) == 3);  // 1 call per page, the other calls are the page writes NACKed during the write cycles
+  TEST_CHECK(MaxPacketSize == (size_t)(2 + _24LC256_Conf.PageSize));   // A whole page and its address
+  TEST_CHECK((PacketBuffer[0] == 0x00) && (PacketBuffer[1] == 192));   // Address of the last page in front of its data
+  TEST_CHECK(memcmp(&PacketBuffer[2], &Data[128], 64) == 0);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(memcmp(&Memory[64], &Data[0], sizeof(Data)) == 0);
+
+  //--- Asynchronous write ---
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] ^= 0xFF;
+  eERRORRESULT Error = EEPROM_StartWriteData(&Eeprom, &Async, 100, &Data[0], sizeof(Data));
+  while (Error == ERR__BUSY)
+  {
+    MemorySim_GetCurrentus();                                           // Each poll of the main loop takes the polling cost of the simulator
+    Error = EEPROM_PollTransfer(&Async);
+  }
+  TEST_CHECK(Error == ERR_NONE);
+  TEST_CHECK(memcmp(&Memory[100], &Data[0], sizeof(Data)) == 0);
+  return true;
+}
+
+
+//=============================================================================
+// With EEPROM_READ_COMPARE_WRITE, an unchanged page of EEPROM_WriteBatch() is not written and its write cycle is saved
+//=============================================================================
+static bool Test_WriteBatchUnchanged(void)
+{
+  uint8_t PageBuffer[64];
+  const uint8_t Same2[4] = { 2, 2, 2, 2 }, Same3[2] = { 3, 3 }, New5[3] = { 0xA1, 0xA2, 0xA3 };
+  const EEPROM_WriteUpdate Updates[3] = { { .Address = (2 * 64) + 10, .Data = &Same2[0], .Size = sizeof(Same2) }, // Pages 2 and 3 already hold the data
+                                          { .Address = (3 * 64) + 20, .Data = &Same3[0], .Size = sizeof(Same3) },
+                                          { .Address = (5 * 64) + 30, .Data = &New5[0],  .Size = sizeof(New5)  }, };
+  size_t SavedCycles = 0;
+  Test_ResetDevice(&_24LC256_Conf);
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_READ_COMPARE_WRITE);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(EEPROM_WriteBatch(&Eeprom, &Updates[0], 3, &PageBuffer[0], &SavedCycles) == ERR_NONE);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(SavedCycles == 2);                                        // Only the page 5 is written
+  TEST_CHECK(memcmp(&Memory[(5 * 64) + 30], &New5[0], sizeof(New5)) == 0);
+  TEST_CHECK((Memory[(5 * 64) + 29] == 5) && (Memory[(5 * 64) + 33] == 5)); // Around the update
+  return true;
+}
+
+
+
+//=============================================================================
+// With EEPROM_ADAPTIVE_POLLING, the page writes of EEPROM_StartWriteData() are measured as the blocking ones
+//=============================================================================
+static bool Test_AsyncAdaptivePolling(void)
+{
+  uint8_t Data[4 * 64];
+  EEPROM_AsyncTransfer Async = { .State = EEPROM_ASYNC_IDLE, };
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)(z ^ 0x5A);
+  Test_ResetDevice(&_24LC256_Conf);
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_ADAPTIVE_POLLING);
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  eERRORRESULT Error = EEPROM_StartWriteData(&Eeprom, &Async, 64, &Data[0], sizeof(Data));
+  while (Error == ERR__BUSY)
+  {
+    MemorySim_GetCurrentus();                                           // Each poll of the main loop takes the polling cost of the simulator
+    Error = EEPROM_PollTransfer(&Async);
+  }
+  TEST_CHECK(Error == ERR_NONE);
+  TEST_CHECK(Eeprom.Polling.MeasuredCycles == 4);                       // 1 write cycle per page
+  TEST_CHECK((Eeprom.Polling.LearnedWriteTimeus >= 5000) && (Eeprom.Polling.LearnedWriteTimeus <= 6000));
+  TEST_CHECK(Eeprom.Polling.InWriteCycle == false);
+  TEST_CHECK(memcmp(&Memory[64], &Data[0], sizeof(Data)) == 0);
+  return true;
+}
+
+
+
+//=============================================================================
+// With a DMA, a device in its write cycle NACKs the page seen at the status check, and the page is issued again
+//=============================================================================
+static bool Test_AsyncNackInBackground(void)
+{
+  uint8_t PacketBuffer[EEPROM_PACKET_BUFFER_SIZE(64)], Data[3 * 64];
+  EEPROM_AsyncTransfer Async = { .State = EEPROM_ASYNC_IDLE, };
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)(z * 3 + 1);
+  Test_ResetDevice(&_24LC256_Conf);
+  SimI2C.SupportNonBlocking = true;
+  SimI2C.NonBlockingNack    = true;                                    // The NACK of the chip address is seen by the DMA
+  EEPROM Eeprom = Test_NewEEPROM(&_24LC256_Conf, EEPROM_SINGLE_PACKET_WRITE);
+  Eeprom.PacketBuffer = &PacketBuffer[0];
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+
+  //--- Start the write while the device is in its write cycle ---
+  TEST_CHECK(EEPROM_WriteData(&Eeprom, 0, &Data[0], 4) == ERR_NONE);
+  const uint32_t Nacks = SimI2C.Stats.Nacks;
+  eERRORRESULT Error = EEPROM_StartWriteData(&Eeprom, &Async, 64, &Data[0], sizeof(Data));
+  while (Error == ERR__BUSY)
+  {
+    MemorySim_GetCurrentus();                                           // Each poll of the main loop takes the polling cost of the simulator
+    Error = EEPROM_PollTransfer(&Async);
+  }
+  TEST_CHECK(Error == ERR_NONE);
+  TEST_CHECK(SimI2C.Stats.Nacks > Nacks);                               // The pages have been NACKed in background
+  TEST_CHECK(memcmp(&Memory[64], &Data[0], sizeof(Data)) == 0);
+
+  //--- A device that never answers gives a timeout ---
+  Device.BusyUntilns = UINT64_MAX;
+  Error = EEPROM_StartWriteData(&Eeprom, &Async, 0, &Data[0], 4);
+  while (Error == ERR__BUSY)
+  {
+    MemorySim_GetCurrentus();
+    Error = EEPROM_PollTransfer(&Async);
+  }
+  TEST_CHECK(Error == ERR__DEVICE_TIMEOUT);
+  TEST_CHECK(Async.State == EEPROM_ASYNC_IDLE);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_CurrentAddressSharedByViews();
+  Success &= Test_CurrentAddressAcrossBlock();
+  Success &= Test_ReadSplit(&AT24C02_Conf, 1);                        // 256 bytes
+  Success &= Test_ReadSplit(&AT24C16A_Conf, 8);                       // 8 blocks of 256 bytes
+  Success &= Test_ReadSplit(&_24LC256_Conf, 32768 / EEPROM_MAX_READ_SIZE);
+  Success &= Test_ReadSplit(&AT24CM02_Conf, 262144 / EEPROM_MAX_READ_SIZE); // 4 blocks of 64KiB
+  Success &= Test_ReadV();
+  Success &= Test_CRC16IBM3740();
+  Success &= Test_ComputeCRC32();
+  Success &= Test_VerifyAgainst();
+  Success &= Test_NackData(false);
+  Success &= Test_NackData(true);
+  Success &= Test_FillWithoutChain();
+  Success &= Test_SinglePacketWrite();
+  Success &= Test_WriteBatchUnchanged();
+  Success &= Test_AsyncAdaptivePolling();
+  Success &= Test_AsyncNackInBackground();
+  printf("%s\n", (Success ? "All EEPROM tests passed" : "EEPROM tests FAILED"));
+  return (Success ? 0 : 1);
+}
@@ -0,0 +1,100 @@
+/*!*****************************************************************************
+ * @file    Test_EEPROMArray.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the interleaved EEPROM array on the simulated I2C bus
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "EEPROMArray.h"
+#include "I2C_MemorySim.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+#define TEST_MAX_DEVICES  ( 4 )
+#define TEST_DATA_SIZE    ( 8000 )
+
+static uint8_t Memories[TEST_MAX_DEVICES][32768];
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Write 8000 bytes on an array of 24LC256 and get the throughput in bytes per second
+//=============================================================================
+static bool Test_WriteArray(size_t deviceCount, uint64_t* pBytesPerSecond)
+{
+  static uint8_t Data[TEST_DATA_SIZE], Read[TEST_DATA_SIZE];
+  I2CMemSim_Device SimDevices[TEST_MAX_DEVICES];
+  EEPROM Devices[TEST_MAX_DEVICES];
+  EEPROM_AsyncTransfer Transfers[TEST_MAX_DEVICES];
+  I2C_MemorySim SimI2C = { .Devices = &SimDevices[0], .DeviceCount = deviceCount, .SupportNonBlocking = false, };
+  for (size_t z = 0; z < deviceCount; ++z)
+  {
+    const uint8_t ChipAddress = EEPROM_ADDR(0, (z >> 1) & 1, z & 1);
+    SimDevices[z] = (I2CMemSim_Device){ .Type = I2CMEMSIM_EEPROM, .Conf = &_24LC256_Conf, .AddrA2A1A0 = ChipAddress, .Memory = &Memories[z][0], .WriteCycleTimeus = 5000, };
+    Devices[z]    = (EEPROM){ .Conf = &_24LC256_Conf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = I2CMemSim_InterfaceTransfer, },
+                              .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = ChipAddress, };
+    memset(&Memories[z][0], 0xFF, sizeof(Memories[z]));
+  }
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)(z * 7 + 3);
+  MemorySim_ResetTime();
+  MemorySim_SetPollingCost(20000);                                     // Each poll of the write cycle costs 20us
+  EEPROMArray Array = { .Devices = &Devices[0], .Transfers = &Transfers[0], .DeviceCount = deviceCount, };
+  TEST_CHECK(Init_EEPROMArray(&Array) == ERR_NONE);
+
+  //--- Write with the wait of the last write cycles ---
+  const uint64_t StartTimens = MemorySim_GetTimens();
+  TEST_CHECK(EEPROMArray_WriteData(&Array, 10, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(EEPROMArray_WaitEndOfWrite(&Array) == ERR_NONE);
+  *pBytesPerSecond = (sizeof(Data) * 1000000000ull) / (MemorySim_GetTimens() - StartTimens);
+
+  //--- Check the data and the stripes ---
+  memset(&Read[0], 0, sizeof(Read));
+  TEST_CHECK(EEPROMArray_ReadData(&Array, 10, &Read[0], sizeof(Read)) == ERR_NONE);
+  TEST_CHECK(memcmp(&Read[0], &Data[0], sizeof(Data)) == 0);
+  TEST_CHECK(memcmp(&Memories[0][10], &Data[0], _24LC256_Conf.PageSize - 10) == 0); // Page 0 of the array is page 0 of the device 0
+  if (deviceCount > 1)
+    TEST_CHECK(memcmp(&Memories[1][0], &Data[_24LC256_Conf.PageSize - 10], _24LC256_Conf.PageSize) == 0); // Page 1 of the array is page 0 of the device 1
+  MemorySim_SetPollingCost(0);
+  return true;
+}
+
+
+//=============================================================================
+// The write cycles of the devices overlap: 4 devices write 4 times faster than 1
+//=============================================================================
+static bool Test_Throughput(void)
+{
+  uint64_t BytesPerSecond[TEST_MAX_DEVICES + 1] = { 0 };
+  for (size_t zCount = 1; zCount <= TEST_MAX_DEVICES; ++zCount)
+  {
+    TEST_CHECK(Test_WriteArray(zCount, &BytesPerSecond[zCount]));
+    const unsigned HundredsPerSecond = (unsigned)((BytesPerSecond[zCount] + 50) / 100); // Rounded to 0.1 kB/s
+    printf("%u x 24LC256, %u bytes: %u.%u kB/s\n", (unsigned)zCount, (unsigned)TEST_DATA_SIZE, HundredsPerSecond / 10, HundredsPerSecond % 10);
+  }
+  TEST_CHECK((BytesPerSecond[1] >=  9600) && (BytesPerSecond[1] <=  9800)); // 9.7 kB/s with 1 device
+  TEST_CHECK((BytesPerSecond[4] >= 37800) && (BytesPerSecond[4] <= 38000)); // 37.9 kB/s with 4 devices
+  for (size_t zCount = 2; zCount <= TEST_MAX_DEVICES; ++zCount)
+    TEST_CHECK(BytesPerSecond[zCount] > BytesPerSecond[zCount - 1]);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_Throughput();
+  printf("%s\n", (Success ? "All EEPROMArray tests passed" : "EEPROMArray tests FAILED"));
+  return (Success ? 0 : 1);
+}
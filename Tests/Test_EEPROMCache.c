@@ -0,0 +1,210 @@
+/*!*****************************************************************************
+ * @file    Test_EEPROMCache.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the EEPROM page cache on the simulated I2C bus
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "EEPROMCache.h"
+#include "I2C_MemorySim.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+#define TEST_PAGE_SIZE   ( 64 )
+#define TEST_LINE_COUNT  ( 2 )
+
+static uint8_t Memory[32768];
+static I2CMemSim_Device Device = { .Type = I2CMEMSIM_EEPROM, .Conf = &_24LC256_Conf, .AddrA2A1A0 = 0, .Memory = Memory, .WriteCycleTimeus = 5000 };
+static I2C_MemorySim SimI2C = { .Devices = &Device, .DeviceCount = 1, .SupportNonBlocking = false };
+
+static EEPROM Eeprom;
+static EEPROMCache_Line Lines[TEST_LINE_COUNT];
+static uint8_t CacheBuffer[EEPROMCACHE_BUFFER_SIZE(TEST_LINE_COUNT, TEST_PAGE_SIZE)];
+static EEPROMCache Cache;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Reset the simulated 24LC256 and initialize a cache of 2 lines: each byte of the page n is n
+//=============================================================================
+static eERRORRESULT Test_NewCache(uint32_t flushDelay, bool writeThrough)
+{
+  for (size_t z = 0; z < sizeof(Memory); ++z) Memory[z] = (uint8_t)(z / TEST_PAGE_SIZE);
+  MemorySim_ResetTime();
+  Device.BusyUntilns = 0;
+  Device.WriteCycles = 0;
+  I2CMemSim_ResetStats(&SimI2C);
+  Eeprom = (EEPROM){ .Conf = &_24LC256_Conf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = I2CMemSim_InterfaceTransfer, },
+                     .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = 0, };
+  Cache  = (EEPROMCache){ .pEeprom = &Eeprom, .Lines = &Lines[0], .Buffer = &CacheBuffer[0], .LineCount = TEST_LINE_COUNT, .FlushDelay = flushDelay, .WriteThrough = writeThrough, };
+  eERRORRESULT Error = Init_EEPROM(&Eeprom);
+  if (Error != ERR_NONE) return Error;
+  return Init_EEPROMCache(&Cache);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Small writes to 1 page are coalesced in 1 page write
+//=============================================================================
+static bool Test_Coalescing(void)
+{
+  uint8_t Data[4], Read[4];
+  TEST_CHECK(Test_NewCache(0, false) == ERR_NONE);
+  for (size_t z = 0; z < 16; ++z)
+  {
+    memset(&Data[0], (int)(0xA0 + z), sizeof(Data));
+    TEST_CHECK(EEPROMCache_WriteData(&Cache, (3 * TEST_PAGE_SIZE) + (z * 4), &Data[0], sizeof(Data)) == ERR_NONE);
+  }
+  TEST_CHECK(Device.WriteCycles == 0);                                 // Nothing written yet
+  TEST_CHECK(EEPROMCache_ReadData(&Cache, (3 * TEST_PAGE_SIZE) + 8, &Read[0], sizeof(Read)) == ERR_NONE);
+  TEST_CHECK(Read[0] == 0xA2);                                         // The read gets the data of the cache
+  TEST_CHECK(EEPROMCache_Sync(&Cache) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 1);                                 // 1 page write instead of 16
+  TEST_CHECK(Cache.PageWrites == 1);
+  for (size_t z = 0; z < TEST_PAGE_SIZE; ++z) TEST_CHECK(Memory[(3 * TEST_PAGE_SIZE) + z] == (uint8_t)(0xA0 + (z / 4)));
+  TEST_CHECK(EEPROMCache_Sync(&Cache) == ERR_NONE);                    // No dirty line left
+  TEST_CHECK(Device.WriteCycles == 1);
+  return true;
+}
+
+
+//=============================================================================
+// A partial page write to a page not in the cache reads the page first, not a whole page write
+//=============================================================================
+static bool Test_PageFill(void)
+{
+  uint8_t Data[TEST_PAGE_SIZE], Read[TEST_PAGE_SIZE];
+  TEST_CHECK(Test_NewCache(0, false) == ERR_NONE);
+  memset(&Data[0], 0x55, sizeof(Data));
+
+  //--- Partial page write ---
+  uint32_t Transactions = SimI2C.Stats.Transactions;
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, (5 * TEST_PAGE_SIZE) + 10, &Data[0], 4) == ERR_NONE);
+  TEST_CHECK((SimI2C.Stats.Transactions - Transactions) == 1);         // The read of the page
+  TEST_CHECK(EEPROMCache_ReadData(&Cache, 5 * TEST_PAGE_SIZE, &Read[0], sizeof(Read)) == ERR_NONE);
+  TEST_CHECK((Read[9] == 5) && (Read[10] == 0x55) && (Read[13] == 0x55) && (Read[14] == 5)); // The rest of the line is the page content
+
+  //--- Whole page write ---
+  Transactions = SimI2C.Stats.Transactions;
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, 7 * TEST_PAGE_SIZE, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(SimI2C.Stats.Transactions == Transactions);               // No read
+  TEST_CHECK(EEPROMCache_Sync(&Cache) == ERR_NONE);
+  TEST_CHECK((Memory[(5 * TEST_PAGE_SIZE) + 9] == 5) && (Memory[(5 * TEST_PAGE_SIZE) + 10] == 0x55));
+  TEST_CHECK(memcmp(&Memory[7 * TEST_PAGE_SIZE], &Data[0], sizeof(Data)) == 0);
+  return true;
+}
+
+
+//=============================================================================
+// The least recently used line is evicted and its dirty data flushed
+//=============================================================================
+static bool Test_Eviction(void)
+{
+  const uint8_t Data[2] = { 0xC1, 0xC2 };
+  uint8_t Read[1];
+  TEST_CHECK(Test_NewCache(0, false) == ERR_NONE);
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, (1 * TEST_PAGE_SIZE), &Data[0], 1) == ERR_NONE);
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, (2 * TEST_PAGE_SIZE), &Data[1], 1) == ERR_NONE);
+  TEST_CHECK(EEPROMCache_ReadData(&Cache, (1 * TEST_PAGE_SIZE), &Read[0], 1) == ERR_NONE); // The page 1 is now more recent than the page 2
+  TEST_CHECK(Device.WriteCycles == 0);
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, (4 * TEST_PAGE_SIZE), &Data[0], 1) == ERR_NONE); // Evict the page 2
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 1);
+  TEST_CHECK(Memory[2 * TEST_PAGE_SIZE] == 0xC2);                      // Flushed at the eviction
+  TEST_CHECK(Memory[1 * TEST_PAGE_SIZE] == 1);                         // Still in the cache
+  TEST_CHECK(EEPROMCache_Sync(&Cache) == ERR_NONE);
+  TEST_CHECK((Memory[1 * TEST_PAGE_SIZE] == 0xC1) && (Memory[4 * TEST_PAGE_SIZE] == 0xC1));
+  TEST_CHECK(Cache.PageWrites == 3);
+  return true;
+}
+
+
+//=============================================================================
+// With WriteThrough, each write is written to the EEPROM and the line stays for the reads
+//=============================================================================
+static bool Test_WriteThrough(void)
+{
+  const uint8_t Data[3] = { 0xD1, 0xD2, 0xD3 };
+  uint8_t Read[3];
+  TEST_CHECK(Test_NewCache(0, true) == ERR_NONE);
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, (6 * TEST_PAGE_SIZE) + 1, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, (6 * TEST_PAGE_SIZE) + 8, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(Cache.PageWrites == 2);                                   // 1 page write per write
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(memcmp(&Memory[(6 * TEST_PAGE_SIZE) + 8], &Data[0], sizeof(Data)) == 0);
+  const uint32_t Transactions = SimI2C.Stats.Transactions;
+  TEST_CHECK(EEPROMCache_ReadData(&Cache, (6 * TEST_PAGE_SIZE) + 1, &Read[0], sizeof(Read)) == ERR_NONE);
+  TEST_CHECK(SimI2C.Stats.Transactions == Transactions);               // Read from the line
+  TEST_CHECK(memcmp(&Read[0], &Data[0], sizeof(Data)) == 0);
+  TEST_CHECK(EEPROMCache_Sync(&Cache) == ERR_NONE);
+  TEST_CHECK(Cache.PageWrites == 2);                                   // Nothing dirty
+  return true;
+}
+
+
+//=============================================================================
+// EEPROMCache_Task() flushes the lines dirty for more than FlushDelay
+//=============================================================================
+static bool Test_FlushDelay(void)
+{
+  const uint8_t Data[1] = { 0xE7 };
+  TEST_CHECK(Test_NewCache(10, false) == ERR_NONE);
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, 9 * TEST_PAGE_SIZE, &Data[0], 1) == ERR_NONE);
+  MemorySim_AdvanceTime(5000000);                                      // 5ms
+  TEST_CHECK(EEPROMCache_Task(&Cache) == ERR_NONE);
+  TEST_CHECK(Cache.PageWrites == 0);                                   // Not dirty for long enough
+  MemorySim_AdvanceTime(6000000);                                      // 11ms
+  TEST_CHECK(EEPROMCache_Task(&Cache) == ERR_NONE);
+  TEST_CHECK(Cache.PageWrites == 1);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Memory[9 * TEST_PAGE_SIZE] == 0xE7);
+  return true;
+}
+
+
+//=============================================================================
+// A failed flush leaves the line dirty, the next sync writes it
+//=============================================================================
+static bool Test_FailedFlush(void)
+{
+  const uint8_t Data[2] = { 0xF1, 0xF2 };
+  TEST_CHECK(Test_NewCache(0, false) == ERR_NONE);
+  TEST_CHECK(EEPROMCache_WriteData(&Cache, (11 * TEST_PAGE_SIZE) + 3, &Data[0], sizeof(Data)) == ERR_NONE);
+  Device.BusyUntilns = UINT64_MAX;                                     // The device does not answer anymore
+  TEST_CHECK(EEPROMCache_Sync(&Cache) == ERR__DEVICE_TIMEOUT);
+  TEST_CHECK(Cache.PageWrites == 0);
+  Device.BusyUntilns = 0;
+  TEST_CHECK(EEPROMCache_Sync(&Cache) == ERR_NONE);
+  TEST_CHECK(Cache.PageWrites == 1);
+  TEST_CHECK((Memory[(11 * TEST_PAGE_SIZE) + 3] == 0xF1) && (Memory[(11 * TEST_PAGE_SIZE) + 4] == 0xF2));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_Coalescing();
+  Success &= Test_PageFill();
+  Success &= Test_Eviction();
+  Success &= Test_WriteThrough();
+  Success &= Test_FlushDelay();
+  Success &= Test_FailedFlush();
+  printf("%s\n", (Success ? "All EEPROMCache tests passed" : "EEPROMCache tests FAILED"));
+  return (Success ? 0 : 1);
+}
@@ -0,0 +1,246 @@
+/*!*****************************************************************************
+ * @file    Test_EEPROMJournal.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the EEPROM journal on the simulated I2C bus
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "EEPROMJournal.h"
+#include "I2C_MemorySim.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+#define TEST_JOURNAL_SIZE  ( 512u ) // The journal is the first 512 bytes of the device, the data are after
+
+static uint8_t Memory[32768];
+static I2CMemSim_Device Device;
+static I2C_MemorySim SimI2C;
+static EEPROM_Conf DataConf, JournalConf;
+static EEPROM DataEeprom, JournalEeprom;
+static uint8_t JournalBuffer[64];
+static uint32_t JournalPages[8];
+static EEPROMJournal Journal;
+static bool FailDataAccesses = false; // 'true' to fail the transfers at an address of the data area
+static int32_t TransferBudget = -1;   // Count of transfers before a power loss, -1 for no power loss
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Transfer on the simulated I2C bus with fault injection
+//=============================================================================
+static eERRORRESULT Test_Transfer(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc)
+{
+  if (TransferBudget == 0) return ERR__I2C_NACK;                     // The device is not powered anymore
+  if (TransferBudget > 0) --TransferBudget;
+  if (FailDataAccesses && pPacketDesc->Start && (pPacketDesc->BufferSize == 2) && ((pPacketDesc->ChipAddr & I2C_READ_ORMASK) == 0))
+  {
+    const uint32_t Address = ((uint32_t)pPacketDesc->pBuffer[0] << 8) | pPacketDesc->pBuffer[1];
+    if (Address >= TEST_JOURNAL_SIZE) return ERR__I2C_NACK_DATA;     // The address phase of a transfer in the data area fails
+  }
+  return I2CMemSim_InterfaceTransfer(pIntDev, pPacketDesc);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Power up the simulated 24LC256 and mount the journal
+//=============================================================================
+static eERRORRESULT Test_Mount(uint8_t options)
+{
+  Device = (I2CMemSim_Device){ .Type = I2CMEMSIM_EEPROM, .Conf = &_24LC256_Conf, .AddrA2A1A0 = 0, .Memory = Memory, .WriteCycleTimeus = 5000 };
+  SimI2C = (I2C_MemorySim){ .Devices = &Device, .DeviceCount = 1, .SupportNonBlocking = false };
+  DataConf    = _24LC256_Conf;
+  DataConf.OffsetAddress    = TEST_JOURNAL_SIZE;
+  DataConf.TotalByteSize   -= TEST_JOURNAL_SIZE;
+  JournalConf = _24LC256_Conf;
+  JournalConf.TotalByteSize = TEST_JOURNAL_SIZE;
+  DataEeprom = (EEPROM){ .Conf = &DataConf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = Test_Transfer, },
+                         .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = 0, .Options = options, };
+  JournalEeprom = DataEeprom;
+  JournalEeprom.Conf = &JournalConf;
+  eERRORRESULT Error = Init_EEPROM(&DataEeprom);
+  if (Error == ERR_NONE) Error = Init_EEPROM(&JournalEeprom);
+  if (Error != ERR_NONE) return Error;
+  Journal = (EEPROMJournal){ .pEeprom = &DataEeprom, .pJournal = &JournalEeprom, .Buffer = &JournalBuffer[0], .Pages = &JournalPages[0], .PagesSize = 8, };
+  return Init_EEPROMJournal(&Journal);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// A partial page write reads the data page at the right address with the current address reads
+//=============================================================================
+static bool Test_CurrentAddressRead(void)
+{
+  memset(&Memory[0], 0x55, sizeof(Memory));
+  MemorySim_ResetTime();
+  TEST_CHECK(Test_Mount(EEPROM_CURRENT_ADDRESS_READ) == ERR_NONE);
+  uint8_t Data[54];
+  memset(&Data[0], 0xAA, sizeof(Data));
+  TEST_CHECK(EEPROMJournal_Begin(&Journal) == ERR_NONE);
+  TEST_CHECK(EEPROMJournal_Write(&Journal, 10, &Data[0], 54) == ERR_NONE);  // Reads the data page 0, then writes its shadow page
+  MemorySim_AdvanceTime(20000000);                                          // 20ms, the write cycle is over
+  TEST_CHECK(EEPROMJournal_Write(&Journal, 64, &Data[0], 16) == ERR_NONE);  // Reads the data page 1 just after the data page 0
+  TEST_CHECK(EEPROMJournal_Commit(&Journal) == ERR_NONE);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&DataEeprom) == ERR_NONE);
+  const uint8_t* const pData = &Memory[TEST_JOURNAL_SIZE];
+  for (size_t z =  0; z <  10; ++z) TEST_CHECK(pData[z] == 0x55);
+  for (size_t z = 10; z <  80; ++z) TEST_CHECK(pData[z] == 0xAA);
+  for (size_t z = 80; z < 128; ++z) TEST_CHECK(pData[z] == 0x55);
+  return true;
+}
+
+
+
+//=============================================================================
+// A committed transaction not copied to the data is copied before the next transaction
+//=============================================================================
+static bool Test_PendingCommit(void)
+{
+  memset(&Memory[0], 0x55, sizeof(Memory));
+  MemorySim_ResetTime();
+  TEST_CHECK(Test_Mount(EEPROM_NO_OPTION) == ERR_NONE);
+  uint8_t Data[128];
+  memset(&Data[0], 0xAA, sizeof(Data));
+  TEST_CHECK(EEPROMJournal_Begin(&Journal) == ERR_NONE);
+  TEST_CHECK(EEPROMJournal_Write(&Journal, 0, &Data[0], 128) == ERR_NONE);
+  FailDataAccesses = true;
+  TEST_CHECK(EEPROMJournal_Commit(&Journal) != ERR_NONE);                   // Committed, but not copied to the data
+  FailDataAccesses = false;
+  TEST_CHECK(Journal.Pending);
+  EEPROMJournal_Abort(&Journal);
+  TEST_CHECK(Journal.Pending);
+
+  //--- The next transaction copies the committed one first ---
+  memset(&Data[0], 0x33, sizeof(Data));
+  TEST_CHECK(EEPROMJournal_Begin(&Journal) == ERR_NONE);
+  TEST_CHECK(Journal.Pending == false);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&JournalEeprom) == ERR_NONE);
+  for (size_t z = 0; z < 128; ++z) TEST_CHECK(Memory[TEST_JOURNAL_SIZE + z] == 0xAA);
+  TEST_CHECK(EEPROMJournal_Write(&Journal, 64, &Data[0], 64) == ERR_NONE); // Overwrites a shadow page of the previous transaction
+  TEST_CHECK(EEPROMJournal_Commit(&Journal) == ERR_NONE);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&DataEeprom) == ERR_NONE);
+  for (size_t z =  0; z <  64; ++z) TEST_CHECK(Memory[TEST_JOURNAL_SIZE + z] == 0xAA);
+  for (size_t z = 64; z < 128; ++z) TEST_CHECK(Memory[TEST_JOURNAL_SIZE + z] == 0x33);
+  return true;
+}
+
+
+//=============================================================================
+// The mount checks the CRC of the commit page with its state
+//=============================================================================
+static bool Test_CommitRecord(void)
+{
+  memset(&Memory[0], 0x55, sizeof(Memory));
+  MemorySim_ResetTime();
+  TEST_CHECK(Test_Mount(EEPROM_NO_OPTION) == ERR_NONE);
+  uint8_t Data[192];
+  memset(&Data[0], 0xAA, sizeof(Data));
+  TEST_CHECK(EEPROMJournal_Begin(&Journal) == ERR_NONE);
+  TEST_CHECK(EEPROMJournal_Write(&Journal, 0, &Data[0], 192) == ERR_NONE); // 3 pages
+  FailDataAccesses = true;
+  TEST_CHECK(EEPROMJournal_Commit(&Journal) != ERR_NONE);                   // Power loss after the commit page write
+  FailDataAccesses = false;
+  MemorySim_AdvanceTime(20000000);                                          // 20ms, the write cycle is over
+
+  //--- A configuration too small for the committed transaction ---
+  Journal = (EEPROMJournal){ .pEeprom = &DataEeprom, .pJournal = &JournalEeprom, .Buffer = &JournalBuffer[0], .Pages = &JournalPages[0], .PagesSize = 2, };
+  TEST_CHECK(Init_EEPROMJournal(&Journal) == ERR__OUT_OF_MEMORY);
+  TEST_CHECK(Memory[TEST_JOURNAL_SIZE] == 0x55);
+
+  //--- The committed transaction is copied at the next mount ---
+  TEST_CHECK(Test_Mount(EEPROM_NO_OPTION) == ERR_NONE);
+  TEST_CHECK(Journal.Recovered);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&JournalEeprom) == ERR_NONE);
+  for (size_t z = 0; z < 192; ++z) TEST_CHECK(Memory[TEST_JOURNAL_SIZE + z] == 0xAA);
+  TEST_CHECK(Memory[2] == 0x3C);                                            // Applied state
+
+  //--- A state changed to committed without its CRC is not a committed transaction ---
+  Memory[TEST_JOURNAL_SIZE] = 0x00;
+  Memory[2] = 0xC3;                                                         // Committed state
+  TEST_CHECK(Test_Mount(EEPROM_NO_OPTION) == ERR_NONE);
+  TEST_CHECK(Journal.Recovered == false);
+  TEST_CHECK(Memory[TEST_JOURNAL_SIZE] == 0x00);
+  return true;
+}
+
+
+
+//=============================================================================
+// Run the transaction of the power loss test, its pages 1 to 6 get the value
+//=============================================================================
+static eERRORRESULT Test_RunTransaction(uint8_t value)
+{
+  uint8_t Data[300];
+  memset(&Data[0], value, sizeof(Data));
+  eERRORRESULT Error = EEPROMJournal_Begin(&Journal);
+  if (Error == ERR_NONE) Error = EEPROMJournal_Write(&Journal, 100, &Data[0], 300);
+  if (Error == ERR_NONE) Error = EEPROMJournal_Write(&Journal, 150, &Data[0], 10);
+  if (Error == ERR_NONE) Error = EEPROMJournal_Commit(&Journal);
+  if (Error == ERR_NONE) Error = EEPROM_WaitEndOfWrite(&DataEeprom);
+  return Error;
+}
+
+
+//=============================================================================
+// A power loss at each transfer of a transaction leaves all the old data or all the new data
+//=============================================================================
+static bool Test_PowerLoss(void)
+{
+  memset(&Memory[0], 0x00, sizeof(Memory));
+  MemorySim_ResetTime();
+  TEST_CHECK(Test_Mount(EEPROM_NO_OPTION) == ERR_NONE);
+  TransferBudget = INT32_MAX;
+  TEST_CHECK(Test_RunTransaction(0) == ERR_NONE);
+  const int32_t TransferCount = INT32_MAX - TransferBudget;         // Count of transfers of a whole transaction
+  uint8_t Generation = 0, Read[300];
+  uint32_t NewCount = 0, OldCount = 0, RecoveredCount = 0;
+
+  for (int32_t Cut = 0; Cut <= (TransferCount + 2); ++Cut)
+  {
+    TransferBudget = -1;
+    TEST_CHECK(Test_Mount(EEPROM_NO_OPTION) == ERR_NONE);
+    TransferBudget = Cut;
+    (void)Test_RunTransaction(Generation + 1);                       // Power loss after Cut transfers
+    TransferBudget = -1;
+    TEST_CHECK(Test_Mount(EEPROM_NO_OPTION) == ERR_NONE);           // Power up
+    TEST_CHECK(EEPROM_WaitEndOfWrite(&DataEeprom) == ERR_NONE);
+    TEST_CHECK(EEPROM_ReadData(&DataEeprom, 100, &Read[0], 300) == ERR_NONE);
+    for (size_t z = 1; z < 300; ++z) TEST_CHECK(Read[z] == Read[0]); // Not torn
+    TEST_CHECK((Memory[TEST_JOURNAL_SIZE + 99] == 0) && (Memory[TEST_JOURNAL_SIZE + 400] == 0));
+    if (Read[0] == (uint8_t)(Generation + 1)) { ++Generation; ++NewCount; RecoveredCount += (Journal.Recovered ? 1 : 0); }
+    else { TEST_CHECK(Read[0] == Generation); ++OldCount; }
+  }
+  printf("Power loss at each of the %d transfers of a 6 pages transaction: %u new data (%u recovered at mount), %u old data\n", (int)TransferCount, (unsigned)NewCount, (unsigned)RecoveredCount, (unsigned)OldCount);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_CurrentAddressRead();
+  Success &= Test_PendingCommit();
+  Success &= Test_CommitRecord();
+  Success &= Test_PowerLoss();
+  printf("%s\n", (Success ? "All EEPROMJournal tests passed" : "EEPROMJournal tests FAILED"));
+  return (Success ? 0 : 1);
+}
@@ -0,0 +1,361 @@
+/*!*****************************************************************************
+ * @file    Test_EEPROMKVStore.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the EEPROM key-value store on the simulated I2C bus
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "EEPROMKVStore.h"
+#include "I2C_MemorySim.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+#define TEST_REGION_PAGES  ( 8 )
+#define TEST_INDEX_SIZE    ( 16 )
+#define TEST_BIG_KEY       ( 0x0100u ) // Key of the value of 2 pages
+#define TEST_BIG_SIZE      ( 80 )
+
+static uint8_t Memory[32768];
+static I2CMemSim_Device Device = { .Type = I2CMEMSIM_EEPROM, .Conf = &_24LC256_Conf, .AddrA2A1A0 = 0, .Memory = Memory, .WriteCycleTimeus = 5000 };
+static I2C_MemorySim SimI2C = { .Devices = &Device, .DeviceCount = 1, .SupportNonBlocking = false };
+
+static EEPROM Eeprom;
+static EEPROMKVStore_IndexEntry Index[TEST_INDEX_SIZE];
+static uint8_t PageBuffer[64];
+static EEPROMKVStore KVStore;
+static int32_t TransferBudget = -1; // Count of transfers before a power loss, -1 for no power loss
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Transfer on the simulated I2C bus with power loss injection
+//=============================================================================
+static eERRORRESULT Test_Transfer(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc)
+{
+  if (TransferBudget == 0) return ERR__I2C_NACK; // The device is not powered anymore
+  if (TransferBudget > 0) --TransferBudget;
+  return I2CMemSim_InterfaceTransfer(pIntDev, pPacketDesc);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Blank the simulated 24LC256
+//=============================================================================
+static void Test_ResetDevice(void)
+{
+  memset(&Memory[0], 0xFF, sizeof(Memory));
+  MemorySim_ResetTime();
+  Device.BusyUntilns = 0;
+  Eeprom = (EEPROM){ .Conf = &_24LC256_Conf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = Test_Transfer, },
+                     .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = 0, };
+}
+
+
+//=============================================================================
+// Mount the store as after a reset of the CPU
+//=============================================================================
+static eERRORRESULT Test_Mount(uint16_t compactThreshold)
+{
+  eERRORRESULT Error = EEPROM_WaitEndOfWrite(&Eeprom);                 // The last write cycle is complete before the reset
+  if (Error != ERR_NONE) return Error;
+  memset(&Index[0], 0, sizeof(Index));
+  KVStore = (EEPROMKVStore){ .pEeprom = &Eeprom, .Index = &Index[0], .IndexSize = TEST_INDEX_SIZE, .Buffer = &PageBuffer[0],
+                             .StartAddress = 0, .RegionPages = TEST_REGION_PAGES, .CompactThreshold = compactThreshold, };
+  return Init_EEPROMKVStore(&KVStore);
+}
+
+
+//=============================================================================
+// Set a key to a value of size bytes filled with a value
+//=============================================================================
+static eERRORRESULT Test_Set(uint16_t key, uint8_t value, size_t size)
+{
+  uint8_t Data[TEST_BIG_SIZE];
+  memset(&Data[0], value, sizeof(Data));
+  return EEPROMKVStore_Set(&KVStore, key, &Data[0], size);
+}
+
+
+//=============================================================================
+// Check that a key has a value of size bytes filled with a value
+//=============================================================================
+static bool Test_Check(uint16_t key, uint8_t value, size_t size)
+{
+  uint8_t Data[TEST_BIG_SIZE];
+  size_t Size = 0;
+  TEST_CHECK(EEPROMKVStore_Get(&KVStore, key, &Data[0], sizeof(Data), &Size) == ERR_NONE);
+  TEST_CHECK(Size == size);
+  for (size_t z = 0; z < size; ++z) TEST_CHECK(Data[z] == value);
+  return true;
+}
+
+
+//=============================================================================
+// Fill the region 0: keys 1, 2, and TEST_BIG_KEY are live, key 4 is deleted, key 1 was overwritten
+//=============================================================================
+static eERRORRESULT Test_Fill(void)
+{
+  eERRORRESULT Error = Test_Set(1, 0x10, 20);
+  if (Error == ERR_NONE) Error = Test_Set(2, 0x20, 8);
+  if (Error == ERR_NONE) Error = Test_Set(4, 0x40, 0);
+  if (Error == ERR_NONE) Error = Test_Set(TEST_BIG_KEY, 0xB0, TEST_BIG_SIZE);
+  if (Error == ERR_NONE) Error = Test_Set(1, 0x11, 30);
+  if (Error == ERR_NONE) Error = EEPROMKVStore_Delete(&KVStore, 4);
+  return Error;                                                        // The pages 1 to 7 of the region 0 are used
+}
+
+
+//=============================================================================
+// Check the keys of the filled store
+//=============================================================================
+static bool Test_CheckFill(void)
+{
+  TEST_CHECK(Test_Check(1, 0x11, 30));
+  TEST_CHECK(Test_Check(2, 0x20, 8));
+  TEST_CHECK(Test_Check(TEST_BIG_KEY, 0xB0, TEST_BIG_SIZE));
+  TEST_CHECK(EEPROMKVStore_Get(&KVStore, 4, &PageBuffer[0], 0, NULL) == ERR__NO_DATA_AVAILABLE);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Set, get, and delete keys
+//=============================================================================
+static bool Test_SetGetDelete(void)
+{
+  uint8_t Data[8] = { 0 };
+  size_t Size = 0;
+  Test_ResetDevice();
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_Mount(0) == ERR_NONE);                               // Formats the blank store
+  TEST_CHECK((KVStore.ActiveRegion == 0) && (KVStore.NextPage == 1));
+  TEST_CHECK(EEPROMKVStore_Get(&KVStore, 1, &Data[0], sizeof(Data), NULL) == ERR__NO_DATA_AVAILABLE);
+  TEST_CHECK(EEPROMKVStore_Delete(&KVStore, 1) == ERR__NO_DATA_AVAILABLE);
+
+  TEST_CHECK(Test_Set(1, 0x10, 20) == ERR_NONE);
+  TEST_CHECK(Test_Check(1, 0x10, 20));
+  TEST_CHECK(Test_Set(1, 0x11, 12) == ERR_NONE);                       // The newest value hides the previous one
+  TEST_CHECK(Test_Check(1, 0x11, 12));
+  TEST_CHECK(EEPROMKVStore_Get(&KVStore, 1, &Data[0], 4, &Size) == ERR_NONE); // Only maxSize bytes are read
+  TEST_CHECK((Size == 12) && (Data[3] == 0x11) && (Data[4] == 0x00));
+  TEST_CHECK(Test_Set(TEST_BIG_KEY, 0xB0, TEST_BIG_SIZE) == ERR_NONE);
+  TEST_CHECK(Test_Check(TEST_BIG_KEY, 0xB0, TEST_BIG_SIZE));
+  TEST_CHECK(KVStore.NextPage == (1 + 1 + 1 + 2));
+
+  TEST_CHECK(EEPROMKVStore_Delete(&KVStore, 1) == ERR_NONE);
+  TEST_CHECK(EEPROMKVStore_Get(&KVStore, 1, &Data[0], sizeof(Data), NULL) == ERR__NO_DATA_AVAILABLE);
+  TEST_CHECK(EEPROMKVStore_Delete(&KVStore, 1) == ERR__NO_DATA_AVAILABLE);
+  TEST_CHECK(Test_Check(TEST_BIG_KEY, 0xB0, TEST_BIG_SIZE));
+
+  TEST_CHECK(Test_Set(EEPROMKVSTORE_NO_KEY, 0x00, 4) == ERR__PARAMETER_ERROR);
+  TEST_CHECK(EEPROMKVStore_Set(&KVStore, 2, &PageBuffer[0], (TEST_REGION_PAGES - 1) * 64) == ERR__OUT_OF_MEMORY); // Never fits in a region
+  return true;
+}
+
+
+//=============================================================================
+// The mount rebuilds the index from the log
+//=============================================================================
+static bool Test_MountRebuild(void)
+{
+  Test_ResetDevice();
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_Mount(0) == ERR_NONE);
+  TEST_CHECK(Test_Fill() == ERR_NONE);
+  TEST_CHECK(Test_CheckFill());
+  TEST_CHECK(KVStore.NextPage == TEST_REGION_PAGES);                  // The region 0 is full
+
+  TEST_CHECK(Test_Mount(0) == ERR_NONE);
+  TEST_CHECK(KVStore.NextPage == TEST_REGION_PAGES);
+  TEST_CHECK((KVStore.ActiveRegion == 0) && (KVStore.Compacting == false));
+  TEST_CHECK(Test_CheckFill());
+
+  //--- A torn record is the end of the log ---
+  Memory[(TEST_REGION_PAGES - 1) * 64 + EEPROMKVSTORE_RECORD_HEADER_SIZE - 1] ^= 0x01; // CRC of the delete record of the key 4
+  TEST_CHECK(Test_Mount(0) == ERR_NONE);
+  TEST_CHECK(KVStore.NextPage == (TEST_REGION_PAGES - 1));
+  TEST_CHECK(Test_Check(4, 0x40, 0));                                  // The delete is not in the log
+  TEST_CHECK(Test_Check(1, 0x11, 30));
+  return true;
+}
+
+
+//=============================================================================
+// EEPROMKVStore_Task() compacts the store in the background, with sets and deletes during the compaction
+//=============================================================================
+static bool Test_TaskCompaction(void)
+{
+  Test_ResetDevice();
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_Mount(2) == ERR_NONE);
+  TEST_CHECK(EEPROMKVStore_Task(&KVStore) == ERR_NONE);
+  TEST_CHECK(KVStore.Compacting == false);                             // 7 free pages, no compaction
+  TEST_CHECK(Test_Fill() == ERR_NONE);
+
+  //--- The task starts the compaction in the other region ---
+  TEST_CHECK(EEPROMKVStore_Task(&KVStore) == ERR_NONE);
+  TEST_CHECK(KVStore.Compacting && (KVStore.ActiveRegion == 1) && (KVStore.NextPage == 1));
+  TEST_CHECK(EEPROMKVStore_Task(&KVStore) == ERR_NONE);                // Copies the record of the key 2, the first of the index
+  TEST_CHECK(KVStore.Compacting && (KVStore.NextPage == 2));
+  TEST_CHECK(Test_CheckFill());
+
+  //--- Sets and deletes during the compaction ---
+  TEST_CHECK(Test_Set(2, 0x21, 8) == ERR_NONE);
+  TEST_CHECK(EEPROMKVStore_Delete(&KVStore, 1) == ERR_NONE);           // The key 1 is not copied yet
+  for (size_t z = 0; (z < 10) && KVStore.Compacting; ++z) TEST_CHECK(EEPROMKVStore_Task(&KVStore) == ERR_NONE);
+  TEST_CHECK((KVStore.Compacting == false) && (KVStore.Compactions == 1));
+  TEST_CHECK(KVStore.NextPage == (1 + 1 + 1 + 1 + 2 + 1));            // Copy of the key 2, key 2, delete of the key 1, copy of TEST_BIG_KEY, and the commit
+  for (size_t zMount = 0; zMount < 2; ++zMount)
+  {
+    TEST_CHECK(Test_Check(2, 0x21, 8));
+    TEST_CHECK(Test_Check(TEST_BIG_KEY, 0xB0, TEST_BIG_SIZE));
+    TEST_CHECK(EEPROMKVStore_Get(&KVStore, 1, &PageBuffer[0], 0, NULL) == ERR__NO_DATA_AVAILABLE);
+    TEST_CHECK(EEPROMKVStore_Get(&KVStore, 4, &PageBuffer[0], 0, NULL) == ERR__NO_DATA_AVAILABLE);
+    TEST_CHECK(Test_Mount(2) == ERR_NONE);                             // The old region is dropped
+    TEST_CHECK((KVStore.ActiveRegion == 1) && (KVStore.Compacting == false));
+  }
+  return true;
+}
+
+
+//=============================================================================
+// The mount resumes an uncommitted compaction
+//=============================================================================
+static bool Test_ResumeCompaction(void)
+{
+  Test_ResetDevice();
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_Mount(2) == ERR_NONE);
+  TEST_CHECK(Test_Fill() == ERR_NONE);
+  TEST_CHECK(EEPROMKVStore_Task(&KVStore) == ERR_NONE);                // Starts the compaction
+
+  //--- Reset after the header of the new region ---
+  TEST_CHECK(Test_Mount(2) == ERR_NONE);
+  TEST_CHECK(KVStore.Compacting && (KVStore.ActiveRegion == 1) && (KVStore.NextPage == 1));
+  TEST_CHECK(Test_CheckFill());
+
+  //--- Reset after the copy of a record ---
+  TEST_CHECK(EEPROMKVStore_Task(&KVStore) == ERR_NONE);
+  TEST_CHECK(Test_Mount(2) == ERR_NONE);
+  TEST_CHECK(KVStore.Compacting && (KVStore.ActiveRegion == 1) && (KVStore.NextPage == 2));
+  TEST_CHECK(Test_CheckFill());
+
+  //--- The resumed compaction copies only the records left ---
+  for (size_t z = 0; (z < 10) && KVStore.Compacting; ++z) TEST_CHECK(EEPROMKVStore_Task(&KVStore) == ERR_NONE);
+  TEST_CHECK((KVStore.Compacting == false) && (KVStore.Compactions == 1));
+  TEST_CHECK(KVStore.NextPage == (1 + 1 + 1 + 2 + 1));                // Keys 1, 2, TEST_BIG_KEY, and the commit
+  TEST_CHECK(Test_Mount(2) == ERR_NONE);
+  TEST_CHECK((KVStore.Compacting == false) && (KVStore.NextPage == (1 + 1 + 1 + 2 + 1)));
+  TEST_CHECK(Test_CheckFill());
+  return true;
+}
+
+
+
+//=============================================================================
+// Run the compaction of the power loss test, the key 2 is deleted during the compaction
+//=============================================================================
+static eERRORRESULT Test_RunCompaction(bool* pDeleted)
+{
+  eERRORRESULT Error = EEPROMKVStore_Task(&KVStore);                   // Starts the compaction
+  if (Error == ERR_NONE) Error = EEPROMKVStore_Task(&KVStore);         // Copies the record of the key 2
+  if (Error == ERR_NONE) Error = EEPROMKVStore_Delete(&KVStore, 2);
+  if (Error == ERR_NONE) *pDeleted = true;
+  for (size_t z = 0; (z < 10) && (Error == ERR_NONE) && KVStore.Compacting; ++z) Error = EEPROMKVStore_Task(&KVStore);
+  if (Error == ERR_NONE) Error = EEPROM_WaitEndOfWrite(&Eeprom);
+  return Error;
+}
+
+
+//=============================================================================
+// Check the keys after the power loss test, the key 2 is deleted or has its value before the compaction
+//=============================================================================
+static bool Test_CheckCompaction(bool deleted)
+{
+  TEST_CHECK(Test_Check(1, 0x11, 30));
+  TEST_CHECK(Test_Check(TEST_BIG_KEY, 0xB0, TEST_BIG_SIZE));
+  TEST_CHECK(EEPROMKVStore_Get(&KVStore, 4, &PageBuffer[0], 0, NULL) == ERR__NO_DATA_AVAILABLE); // Not resurrected by the compaction
+  if (deleted) TEST_CHECK(EEPROMKVStore_Get(&KVStore, 2, &PageBuffer[0], 0, NULL) == ERR__NO_DATA_AVAILABLE);
+  else if (EEPROMKVStore_Get(&KVStore, 2, &PageBuffer[0], 0, NULL) != ERR__NO_DATA_AVAILABLE) TEST_CHECK(Test_Check(2, 0x20, 8));
+  return true;
+}
+
+
+//=============================================================================
+// A power loss at each transfer of a compaction loses no committed key and resurrects no deleted key
+//=============================================================================
+static bool Test_PowerLoss(void)
+{
+  static uint8_t Filled[EEPROMKVSTORE_AREA_SIZE(TEST_REGION_PAGES, 64)];
+  Test_ResetDevice();
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_Mount(2) == ERR_NONE);
+  TEST_CHECK(Test_Fill() == ERR_NONE);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  memcpy(&Filled[0], &Memory[0], sizeof(Filled));
+  bool Deleted = false;
+  TransferBudget = INT32_MAX;
+  TEST_CHECK(Test_RunCompaction(&Deleted) == ERR_NONE);
+  const int32_t TransferCount = INT32_MAX - TransferBudget;           // Count of transfers of a whole compaction
+  uint32_t CommittedCount = 0, ResumedCount = 0, OldCount = 0;
+
+  for (int32_t Cut = 0; Cut <= (TransferCount + 2); ++Cut)
+  {
+    TransferBudget = -1;
+    TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+    memcpy(&Memory[0], &Filled[0], sizeof(Filled));
+    TEST_CHECK(Test_Mount(2) == ERR_NONE);
+    Deleted = false;
+    TransferBudget = Cut;
+    (void)Test_RunCompaction(&Deleted);                                // Power loss after Cut transfers
+    TransferBudget = -1;
+    TEST_CHECK(Test_Mount(2) == ERR_NONE);                             // Power up
+    TEST_CHECK(Test_CheckCompaction(Deleted));
+    const bool Deleted2 = (EEPROMKVStore_Get(&KVStore, 2, &PageBuffer[0], 0, NULL) == ERR__NO_DATA_AVAILABLE);
+    if (KVStore.Compacting) ++ResumedCount;
+    else if (KVStore.ActiveRegion == 1) ++CommittedCount;
+    else ++OldCount;
+
+    //--- The store ends the compaction after the power up ---
+    for (size_t z = 0; (z < 10) && KVStore.Compacting; ++z) TEST_CHECK(EEPROMKVStore_Task(&KVStore) == ERR_NONE);
+    TEST_CHECK(KVStore.Compacting == false);
+    TEST_CHECK(Test_CheckCompaction(Deleted2));
+    TEST_CHECK(Test_Mount(2) == ERR_NONE);
+    TEST_CHECK(Test_CheckCompaction(Deleted2));
+  }
+  printf("Power loss at each of the %d transfers of a compaction: %u committed, %u resumed at mount, %u not started\n", (int)TransferCount, (unsigned)CommittedCount, (unsigned)ResumedCount, (unsigned)OldCount);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_SetGetDelete();
+  Success &= Test_MountRebuild();
+  Success &= Test_TaskCompaction();
+  Success &= Test_ResumeCompaction();
+  Success &= Test_PowerLoss();
+  printf("%s\n", (Success ? "All EEPROMKVStore tests passed" : "EEPROMKVStore tests FAILED"));
+  return (Success ? 0 : 1);
+}
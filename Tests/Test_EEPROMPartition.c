@@ -0,0 +1,295 @@
+/*!*****************************************************************************
+ * @file    Test_EEPROMPartition.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the EEPROM partition manager on the simulated I2C bus
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "EEPROMPartition.h"
+#include "I2C_MemorySim.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+static uint8_t Memory[32768];
+static I2CMemSim_Device Device = { .Type = I2CMEMSIM_EEPROM, .Conf = &_24LC256_Conf, .AddrA2A1A0 = 0, .Memory = Memory, .WriteCycleTimeus = 5000 };
+static I2C_MemorySim SimI2C = { .Devices = &Device, .DeviceCount = 1, .SupportNonBlocking = false };
+
+#define TEST_PAGE_SIZE   ( 64 )
+#define TEST_LINE_COUNT  ( 2 )
+#define TEST_PART_COUNT  ( 3 )
+#define TEST_PART_PAGES  ( 4 )
+
+static EEPROM Eeprom;
+static uint8_t TableBuffer[TEST_PAGE_SIZE];
+static EEPROMCache_Line Lines[TEST_PART_COUNT][TEST_LINE_COUNT];
+static uint8_t CacheBuffers[TEST_PART_COUNT][EEPROMCACHE_BUFFER_SIZE(TEST_LINE_COUNT, TEST_PAGE_SIZE)];
+static EEPROMPartition Parts[TEST_PART_COUNT];
+static EEPROMPartitionTable Table;
+
+//! Adjacent partitions of the tests: write-back in the pages 10 to 13, write-through in the pages 14 to 17, and compare in the pages 18 to 21
+static const EEPROMPartition_Entry Entries[TEST_PART_COUNT] =
+{
+  { .Id = 1, .Cache = EEPROMPARTITION_CACHE_WRITE_BACK   , .Wear = EEPROMPARTITION_WEAR_NONE   , .FirstPage = 10, .PageCount = TEST_PART_PAGES, },
+  { .Id = 2, .Cache = EEPROMPARTITION_CACHE_WRITE_THROUGH, .Wear = EEPROMPARTITION_WEAR_NONE   , .FirstPage = 14, .PageCount = TEST_PART_PAGES, },
+  { .Id = 3, .Cache = EEPROMPARTITION_CACHE_NONE         , .Wear = EEPROMPARTITION_WEAR_COMPARE, .FirstPage = 18, .PageCount = TEST_PART_PAGES, },
+};
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// A partition read after the table read does not use the counter of the device with the view address
+//=============================================================================
+static bool Test_ViewWithCurrentAddressRead(void)
+{
+  for (size_t z = 0; z < sizeof(Memory); ++z) Memory[z] = (uint8_t)(z / _24LC256_Conf.PageSize); // Each byte of the page n is n
+  MemorySim_ResetTime();
+  Eeprom = (EEPROM){ .Conf = &_24LC256_Conf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = I2CMemSim_InterfaceTransfer, },
+                     .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = 0, .Options = EEPROM_CURRENT_ADDRESS_READ, };
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  Parts[0] = (EEPROMPartition){ .Id = 1, };
+  Table = (EEPROMPartitionTable){ .pEeprom = &Eeprom, .Parts = &Parts[0], .PartCount = 1, .Buffer = &TableBuffer[0], };
+  const EEPROMPartition_Entry Entry = { .Id = 1, .FirstPage = 10, .PageCount = 20, };
+  TEST_CHECK(EEPROMPartition_Format(&Table, &Entry, 1) == ERR_NONE);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+
+  //--- Mount the table: the device counter is after the table page ---
+  EEPROMPartition Mounted[1] = { { .Id = 1, }, };
+  Table.Parts = &Mounted[0];
+  TEST_CHECK(Init_EEPROMPartition(&Table) == ERR_NONE);
+  TEST_CHECK(Mounted[0].Mounted);
+  uint8_t Data[4];
+  TEST_CHECK(EEPROMPartition_ReadData(&Mounted[0], 64, &Data[0], 4) == ERR_NONE);
+  TEST_CHECK((Data[0] == 11) && (Data[3] == 11));                     // Page 11 of the device, not page 1
+
+  //--- A read of the device between 2 reads of the partition moves the counter of the view ---
+  TEST_CHECK(EEPROMPartition_ReadData(&Mounted[0], 0, &Data[0], 4) == ERR_NONE);
+  TEST_CHECK(EEPROM_ReadData(&Eeprom, 128, &Data[0], 4) == ERR_NONE);
+  TEST_CHECK(EEPROMPartition_ReadData(&Mounted[0], 4, &Data[0], 4) == ERR_NONE);
+  TEST_CHECK((Data[0] == 10) && (Data[3] == 10));                     // Page 10 of the device, not page 2
+  return true;
+}
+
+
+//=============================================================================
+// Reset the simulated 24LC256 and format the partitions of the tests: each byte of the page n is n
+//=============================================================================
+static eERRORRESULT Test_Format(void)
+{
+  for (size_t z = 0; z < sizeof(Memory); ++z) Memory[z] = (uint8_t)(z / TEST_PAGE_SIZE);
+  MemorySim_ResetTime();
+  Device.BusyUntilns = 0;
+  Device.WriteCycles = 0;
+  Eeprom = (EEPROM){ .Conf = &_24LC256_Conf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = I2CMemSim_InterfaceTransfer, },
+                     .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = 0, };
+  for (size_t z = 0; z < TEST_PART_COUNT; ++z)
+    Parts[z] = (EEPROMPartition){ .Id = Entries[z].Id, .Cache = { .Lines = &Lines[z][0], .Buffer = &CacheBuffers[z][0], .LineCount = TEST_LINE_COUNT, .FlushDelay = 10, }, };
+  Table = (EEPROMPartitionTable){ .pEeprom = &Eeprom, .Parts = &Parts[0], .PartCount = TEST_PART_COUNT, .Buffer = &TableBuffer[0], };
+  eERRORRESULT Error = Init_EEPROM(&Eeprom);
+  if (Error != ERR_NONE) return Error;
+  Error = EEPROMPartition_Format(&Table, &Entries[0], TEST_PART_COUNT);
+  Device.WriteCycles = 0;                                              // Only count the writes of the partitions
+  return Error;
+}
+
+
+//=============================================================================
+// Check that the bytes of the device are the page number, except [first, end[ that are value
+//=============================================================================
+static bool Test_CheckMemory(uint32_t first, uint32_t end, uint8_t value)
+{
+  for (uint32_t z = 0; z < sizeof(Memory); ++z)
+  {
+    if (z < TEST_PAGE_SIZE) continue;                                 // The table page
+    if ((z >= first) && (z < end)) TEST_CHECK(Memory[z] == value);
+    else TEST_CHECK(Memory[z] == (uint8_t)(z / TEST_PAGE_SIZE));
+  }
+  return true;
+}
+
+
+
+//=============================================================================
+// The writes of a write-back partition are merged in its cache and written at the flush delay or at the sync
+//=============================================================================
+static bool Test_WriteBack(void)
+{
+  uint8_t Data[4], Read[4];
+  TEST_CHECK(Test_Format() == ERR_NONE);
+  EEPROMPartition* const pPart = &Parts[0];
+  TEST_CHECK(pPart->Mounted && (pPart->Cache.WriteThrough == false));
+  memset(&Data[0], 0xA5, sizeof(Data));
+  for (uint32_t z = 0; z < 8; ++z) TEST_CHECK(EEPROMPartition_WriteData(pPart, TEST_PAGE_SIZE + (z * 4), &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 0);                                 // Only in the cache
+  TEST_CHECK(EEPROMPartition_ReadData(pPart, TEST_PAGE_SIZE + 4, &Read[0], sizeof(Read)) == ERR_NONE);
+  TEST_CHECK(memcmp(&Read[0], &Data[0], sizeof(Data)) == 0);
+  TEST_CHECK(Test_CheckMemory(0, 0, 0));                               // The device is unchanged
+
+  //--- The task flushes the line after the flush delay ---
+  TEST_CHECK(EEPROMPartition_Task(&Table) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 0);
+  MemorySim_AdvanceTime(20000000);                                     // 20ms, more than the flush delay
+  TEST_CHECK(EEPROMPartition_Task(&Table) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 1);                                 // The 8 writes in 1 page write
+  TEST_CHECK(EEPROMPartition_Sync(&Table) == ERR_NONE);
+  TEST_CHECK(Test_CheckMemory(11 * TEST_PAGE_SIZE, (11 * TEST_PAGE_SIZE) + 32, 0xA5));
+
+  //--- The sync flushes the dirty lines ---
+  TEST_CHECK(EEPROMPartition_WriteData(pPart, 0, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 1);
+  TEST_CHECK(EEPROMPartition_Sync(&Table) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 2);
+  TEST_CHECK(Memory[10 * TEST_PAGE_SIZE] == 0xA5);
+  return true;
+}
+
+
+//=============================================================================
+// The writes of a write-through partition are written at once and the page stays in the cache for the reads
+//=============================================================================
+static bool Test_WriteThrough(void)
+{
+  uint8_t Data[4], Read[4];
+  TEST_CHECK(Test_Format() == ERR_NONE);
+  EEPROMPartition* const pPart = &Parts[1];
+  TEST_CHECK(pPart->Mounted && pPart->Cache.WriteThrough);
+  memset(&Data[0], 0x5A, sizeof(Data));
+  TEST_CHECK(EEPROMPartition_WriteData(pPart, 8, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 1);                                 // Written at once
+  TEST_CHECK(EEPROMPartition_WriteData(pPart, 12, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 2);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_CheckMemory((14 * TEST_PAGE_SIZE) + 8, (14 * TEST_PAGE_SIZE) + 16, 0x5A));
+
+  //--- The reads of the page written are served by the cache ---
+  TEST_CHECK(EEPROMPartition_ReadData(pPart, 8, &Read[0], sizeof(Read)) == ERR_NONE);
+  I2CMemSim_ResetStats(&SimI2C);
+  TEST_CHECK(EEPROMPartition_ReadData(pPart, 12, &Read[0], sizeof(Read)) == ERR_NONE);
+  TEST_CHECK(memcmp(&Read[0], &Data[0], sizeof(Data)) == 0);
+  TEST_CHECK(SimI2C.Stats.TransferCalls == 0);
+
+  //--- Nothing is left to flush ---
+  MemorySim_AdvanceTime(20000000);                                     // 20ms, more than the flush delay
+  TEST_CHECK(EEPROMPartition_Task(&Table) == ERR_NONE);
+  TEST_CHECK(EEPROMPartition_Sync(&Table) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 2);
+  return true;
+}
+
+
+//=============================================================================
+// A compare partition does not write the unchanged pages
+//=============================================================================
+static bool Test_WearCompare(void)
+{
+  uint8_t Data[TEST_PAGE_SIZE + 8];
+  TEST_CHECK(Test_Format() == ERR_NONE);
+  EEPROMPartition* const pPart = &Parts[2];
+  TEST_CHECK(pPart->Mounted && ((pPart->View.Options & EEPROM_READ_COMPARE_WRITE) > 0));
+  TEST_CHECK((Parts[0].View.Options & EEPROM_READ_COMPARE_WRITE) == 0);
+  memset(&Data[0], 18, sizeof(Data));                                  // The bytes of the first page of the partition
+  TEST_CHECK(EEPROMPartition_WriteData(pPart, 0, &Data[0], TEST_PAGE_SIZE) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 0);                                 // Unchanged page, not written
+
+  //--- Only the changed page is written ---
+  memset(&Data[TEST_PAGE_SIZE], 0x77, 8);
+  TEST_CHECK(EEPROMPartition_WriteData(pPart, 0, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 1);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_CheckMemory(19 * TEST_PAGE_SIZE, (19 * TEST_PAGE_SIZE) + 8, 0x77));
+  return true;
+}
+
+
+//=============================================================================
+// A wear-leveling partition cannot have a cache
+//=============================================================================
+static bool Test_WearLevelingWithCache(void)
+{
+  EEPROMPartition_Entry Entry = { .Id = 4, .Cache = EEPROMPARTITION_CACHE_WRITE_BACK, .Wear = EEPROMPARTITION_WEAR_LEVELING, .FirstPage = 30, .PageCount = 8, };
+  TEST_CHECK(Test_Format() == ERR_NONE);
+  TEST_CHECK(EEPROMPartition_Format(&Table, &Entry, 1) == ERR__CONFIGURATION);
+  Entry.Cache = EEPROMPARTITION_CACHE_WRITE_THROUGH;
+  TEST_CHECK(EEPROMPartition_Format(&Table, &Entry, 1) == ERR__CONFIGURATION);
+  TEST_CHECK(Parts[0].Mounted);                                        // The current table is still mounted
+  Entry.Cache = EEPROMPARTITION_CACHE_NONE;
+  TEST_CHECK(EEPROMPartition_Format(&Table, &Entry, 1) == ERR_NONE);
+
+  //--- A table written with a cache on a wear-leveling partition is not mounted ---
+  TableBuffer[EEPROMPARTITION_HEADER_SIZE + 1] |= EEPROMPARTITION_CACHE_WRITE_BACK;
+  uint16_t CRC = 0xFFFF;
+  EEPROM_ComputeCRC16IBM3740(&CRC, &TableBuffer[0], EEPROMPARTITION_HEADER_SIZE + EEPROMPARTITION_ENTRY_SIZE);
+  TableBuffer[EEPROMPARTITION_HEADER_SIZE + EEPROMPARTITION_ENTRY_SIZE + 0] = (uint8_t)CRC;
+  TableBuffer[EEPROMPARTITION_HEADER_SIZE + EEPROMPARTITION_ENTRY_SIZE + 1] = (uint8_t)(CRC >> 8);
+  TEST_CHECK(EEPROM_WriteData(&Eeprom, 0, &TableBuffer[0], EEPROMPARTITION_HEADER_SIZE + EEPROMPARTITION_ENTRY_SIZE + 2) == ERR_NONE);
+  TEST_CHECK(EEPROM_WaitEndOfWrite(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Init_EEPROMPartition(&Table) == ERR__CONFIGURATION);
+  return true;
+}
+
+
+//=============================================================================
+// The partitions are isolated: no access goes out of a partition and the caches are per partition
+//=============================================================================
+static bool Test_Isolation(void)
+{
+  uint8_t Data[8], Read[8];
+  TEST_CHECK(Test_Format() == ERR_NONE);
+  memset(&Data[0], 0xC3, sizeof(Data));
+  for (size_t z = 0; z < TEST_PART_COUNT; ++z)
+  {
+    TEST_CHECK(Parts[z].Conf.TotalByteSize == (TEST_PART_PAGES * TEST_PAGE_SIZE));
+    TEST_CHECK(EEPROMPartition_WriteData(&Parts[z], (TEST_PART_PAGES * TEST_PAGE_SIZE) - 4, &Data[0], sizeof(Data)) == ERR__OUT_OF_MEMORY); // Would overflow in the next partition
+    TEST_CHECK(EEPROMPartition_ReadData(&Parts[z], (TEST_PART_PAGES * TEST_PAGE_SIZE) - 4, &Read[0], sizeof(Read)) == ERR__OUT_OF_MEMORY);
+  }
+  TEST_CHECK(EEPROMPartition_Sync(&Table) == ERR_NONE);
+  TEST_CHECK(Device.WriteCycles == 0);
+
+  //--- The same address in each partition is a different page of the device ---
+  for (size_t z = 0; z < TEST_PART_COUNT; ++z)
+  {
+    memset(&Data[0], (int)(0xE0 + z), sizeof(Data));
+    TEST_CHECK(EEPROMPartition_WriteData(&Parts[z], (TEST_PART_PAGES * TEST_PAGE_SIZE) - sizeof(Data), &Data[0], sizeof(Data)) == ERR_NONE); // The last bytes of each partition
+  }
+  for (size_t z = 0; z < TEST_PART_COUNT; ++z)
+  {
+    TEST_CHECK(EEPROMPartition_ReadData(&Parts[z], (TEST_PART_PAGES * TEST_PAGE_SIZE) - sizeof(Read), &Read[0], sizeof(Read)) == ERR_NONE);
+    for (size_t zByte = 0; zByte < sizeof(Read); ++zByte) TEST_CHECK(Read[zByte] == (uint8_t)(0xE0 + z));
+    TEST_CHECK(EEPROMPartition_ReadData(&Parts[z], 0, &Read[0], sizeof(Read)) == ERR_NONE); // The first bytes, after the last bytes of the previous partition
+    for (size_t zByte = 0; zByte < sizeof(Read); ++zByte) TEST_CHECK(Read[zByte] == (uint8_t)Entries[z].FirstPage);
+  }
+  TEST_CHECK(Memory[(14 * TEST_PAGE_SIZE) - 1] == 13);                // The write-back partition is only in its cache
+  TEST_CHECK(EEPROMPartition_Sync(&Table) == ERR_NONE);
+  for (size_t z = 0; z < TEST_PART_COUNT; ++z)
+  {
+    const uint32_t End = (uint32_t)(Entries[z].FirstPage + TEST_PART_PAGES) * TEST_PAGE_SIZE;
+    for (uint32_t zByte = End - sizeof(Data); zByte < End; ++zByte) TEST_CHECK(Memory[zByte] == (uint8_t)(0xE0 + z));
+    TEST_CHECK((Memory[End - sizeof(Data) - 1] == (uint8_t)((End / TEST_PAGE_SIZE) - 1)) && (Memory[End] == (uint8_t)(End / TEST_PAGE_SIZE)));
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_ViewWithCurrentAddressRead();
+  Success &= Test_WriteBack();
+  Success &= Test_WriteThrough();
+  Success &= Test_WearCompare();
+  Success &= Test_WearLevelingWithCache();
+  Success &= Test_Isolation();
+  printf("%s\n", (Success ? "All EEPROMPartition tests passed" : "EEPROMPartition tests FAILED"));
+  return (Success ? 0 : 1);
+}
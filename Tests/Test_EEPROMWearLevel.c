@@ -0,0 +1,199 @@
+/*!*****************************************************************************
+ * @file    Test_EEPROMWearLevel.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the EEPROM wear-leveling on the simulated I2C bus
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "EEPROMWearLevel.h"
+#include "I2C_MemorySim.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+#define TEST_PAGE_SIZE       ( 64 )
+#define TEST_RECORD_COUNT    ( 2 )
+#define TEST_PAGES           ( 8 )   // Pages per record
+#define TEST_RECORD_SIZE     ( 16 )
+#define TEST_START_ADDRESS   ( 4 * TEST_PAGE_SIZE )
+#define TEST_PAGE_ADDRESS(record,page)  ( TEST_START_ADDRESS + (((record) * TEST_PAGES) + (page)) * TEST_PAGE_SIZE )
+
+static uint8_t Memory[32768];
+static I2CMemSim_Device Device = { .Type = I2CMEMSIM_EEPROM, .Conf = &_24LC256_Conf, .AddrA2A1A0 = 0, .Memory = Memory, .WriteCycleTimeus = 5000 };
+static I2C_MemorySim SimI2C = { .Devices = &Device, .DeviceCount = 1, .SupportNonBlocking = false };
+
+static EEPROM Eeprom;
+static EEPROMWearLevel_Record Records[TEST_RECORD_COUNT];
+static uint8_t PageBuffer[EEPROMWEARLEVEL_BUFFER_SIZE(TEST_RECORD_SIZE)];
+static EEPROMWearLevel WearLevel;
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Blank the simulated 24LC256
+//=============================================================================
+static void Test_ResetDevice(void)
+{
+  memset(&Memory[0], 0xFF, sizeof(Memory));
+  MemorySim_ResetTime();
+  Device.BusyUntilns = 0;
+  Eeprom = (EEPROM){ .Conf = &_24LC256_Conf, .I2C = { .InterfaceDevice = &SimI2C, .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = I2CMemSim_InterfaceTransfer, },
+                     .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, .AddrA2A1A0 = 0, };
+}
+
+
+//=============================================================================
+// Mount the wear-leveling as after a reset of the CPU
+//=============================================================================
+static eERRORRESULT Test_Mount(void)
+{
+  eERRORRESULT Error = EEPROM_WaitEndOfWrite(&Eeprom);                 // The last write cycle is complete before the reset
+  if (Error != ERR_NONE) return Error;
+  memset(&Records[0], 0, sizeof(Records));
+  WearLevel = (EEPROMWearLevel){ .pEeprom = &Eeprom, .Records = &Records[0], .Buffer = &PageBuffer[0], .RecordCount = TEST_RECORD_COUNT,
+                                 .StartAddress = TEST_START_ADDRESS, .PagesPerRecord = TEST_PAGES, .RecordSize = TEST_RECORD_SIZE, };
+  return Init_EEPROMWearLevel(&WearLevel);
+}
+
+
+//=============================================================================
+// Write a record filled with a value
+//=============================================================================
+static eERRORRESULT Test_Write(size_t record, uint8_t value)
+{
+  uint8_t Data[TEST_RECORD_SIZE];
+  memset(&Data[0], value, sizeof(Data));
+  return EEPROMWearLevel_WriteRecord(&WearLevel, record, &Data[0]);
+}
+
+
+//=============================================================================
+// Check that a record is filled with a value
+//=============================================================================
+static bool Test_Check(size_t record, uint8_t value)
+{
+  uint8_t Data[TEST_RECORD_SIZE];
+  TEST_CHECK(EEPROMWearLevel_ReadRecord(&WearLevel, record, &Data[0]) == ERR_NONE);
+  for (size_t z = 0; z < sizeof(Data); ++z) TEST_CHECK(Data[z] == value);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// The ring wraps and the mount finds the newest copy with a binary search
+//=============================================================================
+static bool Test_RingWrap(void)
+{
+  uint32_t EraseCount;
+  Test_ResetDevice();
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(EEPROMWearLevel_ReadRecord(&WearLevel, 0, &PageBuffer[0]) == ERR__NO_DATA_AVAILABLE);
+  for (uint8_t z = 0; z < 20; ++z) TEST_CHECK(Test_Write(0, z) == ERR_NONE); // 2.5 turns of the ring, the newest copy is in the page 3
+  for (uint8_t z = 0; z < 3; ++z) TEST_CHECK(Test_Write(1, 0x80 + z) == ERR_NONE);
+
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(Records[0].Head == 3);
+  TEST_CHECK(Records[1].Head == 2);
+  TEST_CHECK(Test_Check(0, 19));
+  TEST_CHECK(Test_Check(1, 0x82));
+  TEST_CHECK(WearLevel.MountReads == (TEST_RECORD_COUNT * (3 + 1)));   // log2(8) + 1 reads per record
+  TEST_CHECK(EEPROMWearLevel_GetEraseCount(&WearLevel, 0, 3, &EraseCount) == ERR_NONE);
+  TEST_CHECK(EraseCount == 3);                                         // Writes 3, 11, and 19
+  TEST_CHECK(EEPROMWearLevel_GetEraseCount(&WearLevel, 0, 4, &EraseCount) == ERR_NONE);
+  TEST_CHECK(EraseCount == 2);                                         // Writes 4 and 12
+
+  //--- The writes continue after the newest copy ---
+  TEST_CHECK(Test_Write(0, 20) == ERR_NONE);
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(Records[0].Head == 4);
+  TEST_CHECK(Test_Check(0, 20));
+  return true;
+}
+
+
+//=============================================================================
+// A torn write of the head page gives back the previous copy
+//=============================================================================
+static bool Test_TornHead(void)
+{
+  Test_ResetDevice();
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  for (uint8_t z = 0; z < 13; ++z) TEST_CHECK(Test_Write(0, z) == ERR_NONE); // The newest copy is in the page 4, the pages 5 to 7 have the previous turn
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(Test_Check(0, 12));
+
+  //--- Torn head page ---
+  Memory[TEST_PAGE_ADDRESS(0, 4) + EEPROMWEARLEVEL_HEADER_SIZE + 5] ^= 0x5A; // The write stopped in the middle of the record
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(Records[0].Head == 3);
+  TEST_CHECK(Test_Check(0, 11));
+
+  //--- The next write replaces the torn page ---
+  TEST_CHECK(Test_Write(0, 0x42) == ERR_NONE);
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(Records[0].Head == 4);
+  TEST_CHECK(Test_Check(0, 0x42));
+  return true;
+}
+
+
+//=============================================================================
+// A torn write of the page 0 after a wrap gives back the copy in the last page
+//=============================================================================
+static bool Test_TornFirstPage(void)
+{
+  Test_ResetDevice();
+  TEST_CHECK(Init_EEPROM(&Eeprom) == ERR_NONE);
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+
+  //--- Torn first write ---
+  TEST_CHECK(Test_Write(0, 0x10) == ERR_NONE);
+  Memory[TEST_PAGE_ADDRESS(0, 0)] ^= 0xFF;                              // The header is not written
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(Records[0].Valid == false);
+  TEST_CHECK(EEPROMWearLevel_ReadRecord(&WearLevel, 0, &PageBuffer[0]) == ERR__NO_DATA_AVAILABLE);
+
+  //--- Torn page 0 after a wrap ---
+  for (uint8_t z = 0; z < (TEST_PAGES + 1); ++z) TEST_CHECK(Test_Write(0, z) == ERR_NONE); // The newest copy is in the page 0
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK((Records[0].Head == 0) && Test_Check(0, TEST_PAGES));
+  Memory[TEST_PAGE_ADDRESS(0, 0) + EEPROMWEARLEVEL_HEADER_SIZE] ^= 0x01;
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(Records[0].Head == (TEST_PAGES - 1));
+  TEST_CHECK(Test_Check(0, TEST_PAGES - 1));
+  TEST_CHECK(WearLevel.MountReads == (2 + 2));                         // The page 0 and the last page of each record, the record 1 is blank
+
+  //--- The next write replaces the torn page 0 ---
+  TEST_CHECK(Test_Write(0, 0x77) == ERR_NONE);
+  TEST_CHECK(Test_Mount() == ERR_NONE);
+  TEST_CHECK(Records[0].Head == 0);
+  TEST_CHECK(Test_Check(0, 0x77));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_RingWrap();
+  Success &= Test_TornHead();
+  Success &= Test_TornFirstPage();
+  printf("%s\n", (Success ? "All EEPROMWearLevel tests passed" : "EEPROMWearLevel tests FAILED"));
+  return (Success ? 0 : 1);
+}
@@ -0,0 +1,237 @@
+/*!*****************************************************************************
+ * @file    Test_I2C_LinuxDev.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the Linux i2c-dev I2C interface with a fake ioctl()
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <linux/i2c-dev.h>
+#include "I2C_LinuxDev.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+#define TEST_FILE      ( 42 )
+#define TEST_CHIPADDR  ( 0xA0 )
+
+static unsigned long FakeFunctionality = I2C_FUNC_I2C; // Functionality returned by the fake adapter
+static int FakeErrno = 0;                               // errno of the next I2C_RDWR, 0 for a success
+static bool FakeProbeAck = false;                       // 'true' if the chip acknowledges a zero length write
+static uint32_t RdwrCount = 0;                          // Count of I2C_RDWR of the test
+static struct i2c_msg LastMessages[I2CLINUXDEV_MAX_MESSAGES]; // Messages of the last I2C_RDWR with data
+static uint32_t LastMessageCount = 0;
+static uint8_t LastData[1024];                          // Data of the messages of the last I2C_RDWR with data
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Fake system functions
+//=============================================================================
+static int Test_Open(const char* pathname, int flags)
+{
+  (void)pathname; (void)flags;
+  return TEST_FILE;
+}
+
+static int Test_Close(int fd)
+{
+  return (fd == TEST_FILE ? 0 : -1);
+}
+
+static int Test_Ioctl(int fd, unsigned long request, void* arg)
+{
+  if (fd != TEST_FILE) { errno = EBADF; return -1; }
+  if (request == I2C_FUNCS) { *(unsigned long*)arg = FakeFunctionality; return 0; }
+  if (request != I2C_RDWR) { errno = EINVAL; return -1; }
+  struct i2c_rdwr_ioctl_data* pTransfer = (struct i2c_rdwr_ioctl_data*)arg;
+  ++RdwrCount;
+  if ((pTransfer->nmsgs == 1) && (pTransfer->msgs[0].len == 0))        // Probe of the chip address
+  {
+    if (FakeProbeAck) return 1;
+    errno = EREMOTEIO;
+    return -1;
+  }
+  LastMessageCount = pTransfer->nmsgs;
+  size_t DataSize = 0;
+  for (size_t z = 0; z < pTransfer->nmsgs; ++z)
+  {
+    LastMessages[z] = pTransfer->msgs[z];
+    const struct i2c_msg* const pMsg = &pTransfer->msgs[z];
+    if ((pMsg->flags & I2C_M_RD) > 0) memset(pMsg->buf, 0x5A, pMsg->len);
+    else if ((DataSize + pMsg->len) <= sizeof(LastData)) { memcpy(&LastData[DataSize], pMsg->buf, pMsg->len); DataSize += pMsg->len; }
+  }
+  if (FakeErrno != 0) { errno = FakeErrno; return -1; }
+  return (int)pTransfer->nmsgs;
+}
+
+//-----------------------------------------------------------------------------
+
+static I2C_LinuxDev LinuxDev;
+static I2C_Interface Interface;
+
+//=============================================================================
+// Open the fake adapter
+//=============================================================================
+static eERRORRESULT Test_OpenAdapter(unsigned long functionality)
+{
+  LinuxDev  = (I2C_LinuxDev){ .DevicePath = NULL, .fnOpen = Test_Open, .fnIoctl = Test_Ioctl, .fnClose = Test_Close, };
+  Interface = (I2C_Interface){ .InterfaceDevice = &LinuxDev, .UniqueID = I2CLINUXDEV_UNIQUE_ID, .fnI2C_Init = I2CLinuxDev_InterfaceInit, .fnI2C_Transfer = I2CLinuxDev_InterfaceTransfer,
+                               .fnI2C_TransferChain = I2CLinuxDev_InterfaceTransferChain, .Channel = 1, };
+  FakeFunctionality = functionality;
+  FakeErrno         = 0;
+  FakeProbeAck      = false;
+  RdwrCount         = 0;
+  LastMessageCount  = 0;
+  return I2CLinuxDev_InterfaceInit(&Interface, 400000);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// A memory read (address then data) is 1 I2C_RDWR of 2 messages
+//=============================================================================
+static bool Test_WriteThenRead(void)
+{
+  TEST_CHECK(Test_OpenAdapter(I2C_FUNC_I2C) == ERR_NONE);
+  uint8_t Address[2] = { 0x01, 0x23 }, Data[16];
+  I2CInterface_Packet Chain[2] =
+  {
+    I2C_INTERFACE8_TX_DATA_DESC(TEST_CHIPADDR, true, &Address[0], 2, false, I2C_WRITE_THEN_READ_FIRST_PART),
+    I2C_INTERFACE8_RX_DATA_DESC(TEST_CHIPADDR | I2C_READ_ORMASK, true, &Data[0], sizeof(Data), true, I2C_WRITE_THEN_READ_SECOND_PART),
+  };
+  TEST_CHECK(I2CLinuxDev_InterfaceTransferChain(&Interface, &Chain[0], 2) == ERR_NONE);
+  TEST_CHECK((RdwrCount == 1) && (LastMessageCount == 2));
+  TEST_CHECK((LastMessages[0].addr == 0x50) && (LastMessages[0].flags == 0) && (LastMessages[0].len == 2));
+  TEST_CHECK((LastMessages[1].addr == 0x50) && (LastMessages[1].flags == I2C_M_RD) && (LastMessages[1].len == sizeof(Data)));
+  TEST_CHECK((LastData[0] == 0x01) && (LastData[1] == 0x23) && (Data[0] == 0x5A) && (Data[15] == 0x5A));
+  return true;
+}
+
+
+//=============================================================================
+// A memory write (address then data without START) is merged in 1 message, or sent with I2C_M_NOSTART
+//=============================================================================
+static bool Test_WriteMerge(unsigned long functionality)
+{
+  TEST_CHECK(Test_OpenAdapter(functionality) == ERR_NONE);
+  uint8_t Address[2] = { 0x00, 0x40 }, Data[64];
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)z;
+  I2CInterface_Packet Address_Packet = I2C_INTERFACE8_TX_DATA_DESC(TEST_CHIPADDR, true, &Address[0], 2, false, I2C_WRITE_THEN_WRITE_FIRST_PART);
+  I2CInterface_Packet Data_Packet    = I2C_INTERFACE8_TX_DATA_DESC(TEST_CHIPADDR, false, &Data[0], sizeof(Data), true, I2C_WRITE_THEN_WRITE_SECOND_PART);
+  TEST_CHECK(I2CLinuxDev_InterfaceTransfer(&Interface, &Address_Packet) == ERR_NONE);
+  TEST_CHECK(RdwrCount == 0);                                          // Kept until the Stop
+  TEST_CHECK(I2CLinuxDev_InterfaceTransfer(&Interface, &Data_Packet) == ERR_NONE);
+  TEST_CHECK(RdwrCount == 1);
+  if ((functionality & I2C_FUNC_NOSTART) > 0)
+  {
+    TEST_CHECK(LastMessageCount == 2);                                 // The data are sent from the buffer of the packet
+    TEST_CHECK((LastMessages[1].flags & I2C_M_NOSTART) > 0);
+    TEST_CHECK(LastMessages[1].buf == &Data[0]);
+  }
+  else
+  {
+    TEST_CHECK(LastMessageCount == 1);                                 // The address and the data are merged
+    TEST_CHECK(LastMessages[0].len == (2 + sizeof(Data)));
+  }
+  TEST_CHECK((LastData[0] == 0x00) && (LastData[1] == 0x40) && (memcmp(&LastData[2], &Data[0], sizeof(Data)) == 0));
+  return true;
+}
+
+
+//=============================================================================
+// A message of more than 8192 bytes is refused without I2C_RDWR
+//=============================================================================
+static bool Test_MessageLength(void)
+{
+  static uint8_t Data[8193];
+  TEST_CHECK(Test_OpenAdapter(I2C_FUNC_I2C) == ERR_NONE);
+  I2CInterface_Packet Read_Packet = I2C_INTERFACE8_RX_DATA_DESC(TEST_CHIPADDR | I2C_READ_ORMASK, true, &Data[0], 8192, true, I2C_SIMPLE_TRANSFER);
+  TEST_CHECK(I2CLinuxDev_InterfaceTransfer(&Interface, &Read_Packet) == ERR_NONE);
+  TEST_CHECK((RdwrCount == 1) && (LastMessages[0].len == 8192));
+  Read_Packet.BufferSize = 8193;
+  TEST_CHECK(I2CLinuxDev_InterfaceTransfer(&Interface, &Read_Packet) == ERR__I2C_OVERFLOW_ERROR);
+  TEST_CHECK(RdwrCount == 1);
+  TEST_CHECK(LinuxDev.MessageCount == 0);                              // The transfer is dropped
+  return true;
+}
+
+
+//=============================================================================
+// Send a read transfer of 1 or 2 messages with an errno from the adapter
+//=============================================================================
+static eERRORRESULT Test_TransferWithErrno(int errorNumber, bool twoMessages, bool probeAck)
+{
+  uint8_t Address[2] = { 0x00, 0x00 }, Data[4];
+  I2CInterface_Packet Chain[2] =
+  {
+    I2C_INTERFACE8_TX_DATA_DESC(TEST_CHIPADDR, true, &Address[0], 2, false, I2C_WRITE_THEN_READ_FIRST_PART),
+    I2C_INTERFACE8_RX_DATA_DESC(TEST_CHIPADDR | I2C_READ_ORMASK, true, &Data[0], sizeof(Data), true, I2C_WRITE_THEN_READ_SECOND_PART),
+  };
+  FakeErrno    = errorNumber;
+  FakeProbeAck = probeAck;
+  if (twoMessages) return I2CLinuxDev_InterfaceTransferChain(&Interface, &Chain[0], 2);
+  return I2CLinuxDev_InterfaceTransfer(&Interface, &Chain[1]);
+}
+
+
+//=============================================================================
+// The errno of the adapter is converted to an error
+//=============================================================================
+static bool Test_ErrnoMapping(void)
+{
+  TEST_CHECK(Test_OpenAdapter(I2C_FUNC_I2C) == ERR_NONE);
+  TEST_CHECK(Test_TransferWithErrno(ENXIO    , true , true ) == ERR__I2C_NACK);       // NACK of the chip address
+  TEST_CHECK(Test_TransferWithErrno(EREMOTEIO, false, true ) == ERR__I2C_NACK);       // 1 message, the NACK is on the chip address or the data
+  RdwrCount = 0;
+  TEST_CHECK(Test_TransferWithErrno(EREMOTEIO, true , false) == ERR__I2C_NACK);       // The chip does not acknowledge the probe, it is busy or absent
+  TEST_CHECK(RdwrCount == 2);                                                         // The transfer and the probe
+  TEST_CHECK(Test_TransferWithErrno(EREMOTEIO, true , true ) == ERR__I2C_NACK_DATA);  // The chip acknowledges the probe, the NACK was after the first message
+  TEST_CHECK(Test_TransferWithErrno(ETIMEDOUT, true , true ) == ERR__I2C_TIMEOUT);
+  TEST_CHECK(Test_TransferWithErrno(EAGAIN   , true , true ) == ERR__I2C_OTHER_BUSY); // Arbitration lost
+  TEST_CHECK(Test_TransferWithErrno(EBUSY    , true , true ) == ERR__I2C_OTHER_BUSY);
+  TEST_CHECK(Test_TransferWithErrno(EINVAL   , true , true ) == ERR__I2C_PARAMETER_ERROR);
+  TEST_CHECK(Test_TransferWithErrno(EIO      , true , true ) == ERR__I2C_COMM_ERROR);
+  TEST_CHECK(Test_TransferWithErrno(0        , true , true ) == ERR_NONE);
+  TEST_CHECK(I2CLinuxDev_Close(&LinuxDev) == ERR_NONE);
+  TEST_CHECK(Test_TransferWithErrno(0, true, true) == ERR__I2C_CONFIG_ERROR);         // Closed
+  return true;
+}
+
+
+//=============================================================================
+// The adapter shall support the plain I2C transfers
+//=============================================================================
+static bool Test_Functionality(void)
+{
+  TEST_CHECK(Test_OpenAdapter(I2C_FUNC_SMBUS_BYTE) == ERR__I2C_CONFIG_ERROR);
+  TEST_CHECK(LinuxDev.IsOpen == false);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_WriteThenRead();
+  Success &= Test_WriteMerge(I2C_FUNC_I2C);
+  Success &= Test_WriteMerge(I2C_FUNC_I2C | I2C_FUNC_NOSTART);
+  Success &= Test_MessageLength();
+  Success &= Test_ErrnoMapping();
+  Success &= Test_Functionality();
+  printf("%s\n", (Success ? "All I2C_LinuxDev tests passed" : "I2C_LinuxDev tests FAILED"));
+  return (Success ? 0 : 1);
+}
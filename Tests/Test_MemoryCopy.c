@@ -0,0 +1,222 @@
+/*!*****************************************************************************
+ * @file    Test_MemoryCopy.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the pipelined copy engine on the simulated buses
+ * @details Each copy is timed as a read of the whole area followed by a write
+ * of the whole area, then as a pipelined copy with 256-byte chunks
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "MemoryCopy.h"
+#include "EEPROM.h"
+#include "48LM01.h"
+#include "23LCxxx.h"
+#include "I2C_MemorySim.h"
+#include "SPI_MemorySim.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+#define TEST_CHUNK_SIZE  ( 256 )
+
+static uint8_t MemoryAT24CM02[262144], Memory24LC256[32768], Memory48LM01[131072], Memory23LC1024[131072];
+static uint8_t Whole[131072];                           // Area of the read then write copy
+static uint8_t ChunkBuffer[2 * TEST_CHUNK_SIZE];
+
+static I2CMemSim_Device SimAT24CM02 = { .Type = I2CMEMSIM_EEPROM, .Conf = &AT24CM02_Conf, .Memory = MemoryAT24CM02, .WriteCycleTimeus = 5000, };
+static I2CMemSim_Device Sim24LC256  = { .Type = I2CMEMSIM_EEPROM, .Conf = &_24LC256_Conf, .Memory = Memory24LC256 , .WriteCycleTimeus = 5000, };
+static I2C_MemorySim SimI2C1 = { .Devices = &SimAT24CM02, .DeviceCount = 1, .SupportNonBlocking = true, };
+static I2C_MemorySim SimI2C2 = { .Devices = &Sim24LC256 , .DeviceCount = 1, .SupportNonBlocking = true, };
+static SPIMemSim_Device SimSPIDevices[2] =
+{
+  { .Type = SPIMEMSIM_EERAM48Lxxx, .ChipSelect = 1, .Memory = Memory48LM01  , .ArrayByteSize = sizeof(Memory48LM01)  , .AddressBytes = 3, .PageSize = 128, .IOmodes = SPIMEMSIM_SPI, .MaxSCKfrequency = 66000000, },
+  { .Type = SPIMEMSIM_SRAM23LCxxx, .ChipSelect = 0, .Memory = Memory23LC1024, .ArrayByteSize = sizeof(Memory23LC1024), .AddressBytes = 3, .PageSize = 32 , .IOmodes = SPIMEMSIM_SPI, .MaxSCKfrequency = 20000000,
+    .StatusRegister = SPIMEMSIM_SRAM_SEQUENTIAL_MODE, },
+};
+static SPI_MemorySim SimSPI = { .Devices = &SimSPIDevices[0], .DeviceCount = 2, .SupportNonBlocking = true, };
+
+#define TEST_EEPROM(sim, conf)  { .Conf = &(conf), .I2C = { .InterfaceDevice = &(sim), .UniqueID = I2CMEMSIM_UNIQUE_ID, .fnI2C_Init = I2CMemSim_InterfaceInit, .fnI2C_Transfer = I2CMemSim_InterfaceTransfer, \
+                                  .fnI2C_TransferChain = I2CMemSim_InterfaceTransferChain, }, .I2CclockSpeed = 400000, .fnGetCurrentms = MemorySim_GetCurrentms, }
+#define TEST_SPI                { .InterfaceDevice = &SimSPI, .UniqueID = SPIMEMSIM_UNIQUE_ID, .fnSPI_Init = SPIMemSim_InterfaceInit, .fnSPI_Transfer = SPIMemSim_InterfaceTransfer, \
+                                  .fnSPI_TransferV = SPIMemSim_InterfaceTransferV, }
+static EEPROM EepromAT24CM02 = TEST_EEPROM(SimI2C1, AT24CM02_Conf);
+static EEPROM Eeprom24LC256  = TEST_EEPROM(SimI2C2, _24LC256_Conf);
+static EERAM48LM01 Eeram48LM01 = { .SPIchipSelect = 1, .SPI = TEST_SPI, .SPIclockSpeed = 20000000, .fnGetCurrentms = MemorySim_GetCurrentms, };
+static SRAM23LCxxx Sram23LC1024 = { .Conf = &SRAM23LC1024_Conf, .SPIchipSelect = 0, .SPI = TEST_SPI, .SPIclockSpeed = 20000000, };
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Transfer functions of the devices
+//=============================================================================
+typedef struct Test_EepromContext
+{
+  EEPROM* pEeprom;
+  EEPROM_AsyncTransfer Async;
+} Test_EepromContext;
+
+static Test_EepromContext ContextAT24CM02 = { .pEeprom = &EepromAT24CM02, };
+static Test_EepromContext Context24LC256  = { .pEeprom = &Eeprom24LC256 , };
+
+static eERRORRESULT Test_EepromRead(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  Test_EepromContext* pEeprom = (Test_EepromContext*)pContext;
+  MemorySim_GetCurrentus();                                            // Each poll of the main loop takes the polling cost of the simulator
+  if (pEeprom->Async.State == EEPROM_ASYNC_IDLE) return EEPROM_StartReadData(pEeprom->pEeprom, &pEeprom->Async, address, data, size);
+  return EEPROM_PollTransfer(&pEeprom->Async);
+}
+
+static eERRORRESULT Test_EepromWrite(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  Test_EepromContext* pEeprom = (Test_EepromContext*)pContext;
+  MemorySim_GetCurrentus();                                            // Each poll of the main loop takes the polling cost of the simulator
+  if (pEeprom->Async.State == EEPROM_ASYNC_IDLE) return EEPROM_StartWriteData(pEeprom->pEeprom, &pEeprom->Async, address, data, size);
+  return EEPROM_PollTransfer(&pEeprom->Async);
+}
+
+static eERRORRESULT Test_EeramRead(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  MemorySim_GetCurrentus();                                            // Each poll of the main loop takes the polling cost of the simulator
+  return EERAM48LM01_ReadSRAMDataWithDMA((EERAM48LM01*)pContext, address, data, size);
+}
+
+static eERRORRESULT Test_EeramWrite(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  EERAM48LM01* pEeram = (EERAM48LM01*)pContext;
+  MemorySim_GetCurrentus();                                            // Each poll of the main loop takes the polling cost of the simulator
+  if (EERAM48LM01_IS_DMA_TRANSFER_IN_PROGRESS(pEeram->InternalConfig) == false) // Each write needs the write enable latch
+  {
+    eERRORRESULT Error = EERAM48LM01_SetWriteEnable(pEeram);
+    if (Error != ERR_NONE) return Error;
+  }
+  return EERAM48LM01_WriteSRAMDataWithDMA(pEeram, address, data, size);
+}
+
+static eERRORRESULT Test_SramRead(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  return SRAM23LCxxx_ReadSRAMData((SRAM23LCxxx*)pContext, address, data, size);
+}
+
+static eERRORRESULT Test_SramWrite(void *pContext, uint32_t address, uint8_t* data, size_t size)
+{
+  return SRAM23LCxxx_WriteSRAMData((SRAM23LCxxx*)pContext, address, data, size);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Transfer a whole area chunk by chunk, each chunk waits the end of the previous one
+//=============================================================================
+static eERRORRESULT Test_TransferWhole(const MemoryCopy_Device* pDevice, uint32_t address, size_t size)
+{
+  eERRORRESULT Error;
+  for (size_t Offset = 0; Offset < size; Offset += TEST_CHUNK_SIZE)
+  {
+    const size_t ChunkSize = ((size - Offset) < TEST_CHUNK_SIZE ? (size - Offset) : TEST_CHUNK_SIZE);
+    do
+    {
+      Error = pDevice->fnTransfer(pDevice->pContext, address + Offset, &Whole[Offset], ChunkSize);
+    } while ((Error == ERR__BUSY) || (Error == ERR__I2C_BUSY) || (Error == ERR__SPI_BUSY) || (Error == ERR__I2C_OTHER_BUSY) || (Error == ERR__SPI_OTHER_BUSY));
+    if (Error != ERR_NONE) return Error;
+  }
+  return ERR_NONE;
+}
+
+
+//=============================================================================
+// Time a read then write copy and a pipelined copy, the times are in 0.1 ms
+//=============================================================================
+static bool Test_Copy(const char* name, MemoryCopy* pCopy, uint8_t* pSource, uint32_t sourceAddress, uint8_t* pDestination, uint32_t destinationAddress, size_t size,
+                      uint32_t expectedRead, uint32_t expectedWrite, uint32_t expectedPipelined)
+{
+  for (size_t z = 0; z < size; ++z) pSource[sourceAddress + z] = (uint8_t)(z * 13 + 7);
+
+  //--- Read all, then write all ---
+  memset(&pDestination[destinationAddress], 0, size);
+  const uint64_t ReadStartns = MemorySim_GetTimens();
+  TEST_CHECK(Test_TransferWhole(&pCopy->Source, sourceAddress, size) == ERR_NONE);
+  const uint64_t WriteStartns = MemorySim_GetTimens();
+  TEST_CHECK(Test_TransferWhole(&pCopy->Destination, destinationAddress, size) == ERR_NONE);
+  const uint64_t WriteEndns = MemorySim_GetTimens();
+  TEST_CHECK(memcmp(&pDestination[destinationAddress], &pSource[sourceAddress], size) == 0);
+
+  //--- Pipelined copy ---
+  memset(&pDestination[destinationAddress], 0, size);
+  TEST_CHECK(Init_MemoryCopy(pCopy) == ERR_NONE);
+  const uint64_t CopyStartns = MemorySim_GetTimens();
+  TEST_CHECK(MemoryCopy_Copy(pCopy, sourceAddress, destinationAddress, size) == ERR_NONE);
+  const uint64_t CopyEndns = MemorySim_GetTimens();
+  TEST_CHECK(memcmp(&pDestination[destinationAddress], &pSource[sourceAddress], size) == 0);
+
+  //--- Check the times ---
+  const uint32_t Read      = (uint32_t)((WriteStartns - ReadStartns + 50000) / 100000); // Rounded to 0.1 ms
+  const uint32_t Write     = (uint32_t)((WriteEndns - WriteStartns + 50000) / 100000);
+  const uint32_t Pipelined = (uint32_t)((CopyEndns - CopyStartns + 50000) / 100000);
+  printf("%-26s %6u bytes: read %5u.%u ms + write %5u.%u ms = %5u.%u ms, pipelined %5u.%u ms\n", name, (unsigned)size, Read / 10, Read % 10, Write / 10, Write % 10,
+         (Read + Write) / 10, (Read + Write) % 10, Pipelined / 10, Pipelined % 10);
+  TEST_CHECK((Read      >= (expectedRead      - 2)) && (Read      <= (expectedRead      + 2)));
+  TEST_CHECK((Write     >= (expectedWrite     - 2)) && (Write     <= (expectedWrite     + 2)));
+  TEST_CHECK((Pipelined >= (expectedPipelined - 2)) && (Pipelined <= (expectedPipelined + 2)));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// The pipelined copy takes about the time of the slowest side
+//=============================================================================
+static bool Test_CopyTimes(void)
+{
+  static const SRAM23LCxxx_Config SramConfig = { .RecoverSPIbus = true, .IOmode = SRAM23LCxxx_SPI, .OperationMode = SRAM23LCxxx_SEQUENTIAL_MODE, .DisableHold = true, };
+  MemorySim_ResetTime();
+  TEST_CHECK(Init_EEPROM(&EepromAT24CM02) == ERR_NONE);
+  TEST_CHECK(Init_EEPROM(&Eeprom24LC256) == ERR_NONE);
+  TEST_CHECK(Init_EERAM48LM01(&Eeram48LM01) == ERR_NONE);
+  TEST_CHECK(Init_SRAM23LCxxx(&Sram23LC1024, &SramConfig) == ERR_NONE);
+  MemoryCopy Copy = { .Buffer = &ChunkBuffer[0], .ChunkSize = TEST_CHUNK_SIZE, };
+
+  //--- AT24CM02 to 23LC1024: the copy is as long as the read ---
+  Copy.Source      = (MemoryCopy_Device){ .fnTransfer = Test_EepromRead, .pContext = &ContextAT24CM02, };
+  Copy.Destination = (MemoryCopy_Device){ .fnTransfer = Test_SramWrite , .pContext = &Sram23LC1024   , };
+  TEST_CHECK(Test_Copy("AT24CM02 to 23LC1024", &Copy, MemoryAT24CM02, 3, Memory23LC1024, 100, 32768, 7629, 133, 7630));
+
+  //--- 48LM01 with DMA to AT24CM02: the copy is as long as the write ---
+  Copy.Source      = (MemoryCopy_Device){ .fnTransfer = Test_EeramRead  , .pContext = &Eeram48LM01    , };
+  Copy.Destination = (MemoryCopy_Device){ .fnTransfer = Test_EepromWrite, .pContext = &ContextAT24CM02, };
+  TEST_CHECK(Test_Copy("48LM01 (DMA) to AT24CM02", &Copy, Memory48LM01, 5, MemoryAT24CM02, 256, 32768, 135, 13909, 13913));
+
+  //--- AT24CM02 to 24LC256 on a second I2C bus ---
+  Copy.Source      = (MemoryCopy_Device){ .fnTransfer = Test_EepromRead , .pContext = &ContextAT24CM02, };
+  Copy.Destination = (MemoryCopy_Device){ .fnTransfer = Test_EepromWrite, .pContext = &Context24LC256 , };
+  TEST_CHECK(Test_Copy("AT24CM02 to 24LC256", &Copy, MemoryAT24CM02, 0, Memory24LC256, 0, 32768, 7502, 33405, 33576));
+
+  //--- 23LC1024 to 48LM01 on the same SPI bus: no overlap ---
+  Copy.Source      = (MemoryCopy_Device){ .fnTransfer = Test_SramRead  , .pContext = &Sram23LC1024, };
+  Copy.Destination = (MemoryCopy_Device){ .fnTransfer = Test_EeramWrite, .pContext = &Eeram48LM01 , };
+  TEST_CHECK(Test_Copy("23LC1024 to 48LM01", &Copy, Memory23LC1024, 0, Memory48LM01, 1000, 65536, 266, 271, 538));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_CopyTimes();
+  printf("%s\n", (Success ? "All MemoryCopy tests passed" : "MemoryCopy tests FAILED"));
+  return (Success ? 0 : 1);
+}
@@ -0,0 +1,202 @@
+/*!*****************************************************************************
+ * @file    Test_SPI_LinuxDev.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Tests of the Linux spidev SPI interface with a fake spidev
+ * @details The fake ioctl() checks the bufsiz limit of the spidev module and
+ * sends the spi_ioc_transfer to a simulated 23LC1024
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <linux/spi/spidev.h>
+#undef SPI_LSB_FIRST                                    // Also defined by the SPI interface
+#include "SPI_LinuxDev.h"
+#include "SPI_MemorySim.h"
+#include "23LCxxx.h"
+//-----------------------------------------------------------------------------
+
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); return false; } } while (0)
+
+#define TEST_FILE      ( 42 )
+#define TEST_BUFSIZ    ( 4096u )
+
+static uint8_t SramMemory[131072];
+static SPIMemSim_Device SimDevice = { .Type = SPIMEMSIM_SRAM23LCxxx, .ChipSelect = 0, .Memory = SramMemory, .ArrayByteSize = sizeof(SramMemory), .AddressBytes = 3, .PageSize = 32,
+                                      .IOmodes = SPIMEMSIM_SPI, .MaxSCKfrequency = 20000000, .StatusRegister = SPIMEMSIM_SRAM_SEQUENTIAL_MODE, };
+static SPI_MemorySim Sim = { .Devices = &SimDevice, .DeviceCount = 1, .SupportNonBlocking = false, };
+static SPI_Interface SimInterface = { .InterfaceDevice = &Sim, .UniqueID = SPIMEMSIM_UNIQUE_ID, };
+
+static uint32_t FakeBufsiz = TEST_BUFSIZ;               // bufsiz parameter of the fake spidev module
+static int FakeErrno = 0;                               // errno of the next SPI_IOC_MESSAGE, 0 for a success
+static uint32_t MessageCount = 0;                       // Count of SPI_IOC_MESSAGE of the test
+static uint32_t MaxMessageBytes = 0;                    // Biggest SPI_IOC_MESSAGE of the test
+static bool ChipSelectAsserted = false;                 // 'true' if the last SPI_IOC_MESSAGE kept the chip select asserted
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//=============================================================================
+// Fake system functions
+//=============================================================================
+static int Test_Open(const char* pathname, int flags)
+{
+  (void)pathname; (void)flags;
+  return TEST_FILE;
+}
+
+static int Test_Close(int fd)
+{
+  return (fd == TEST_FILE ? 0 : -1);
+}
+
+static int Test_Ioctl(int fd, unsigned long request, void* arg)
+{
+  if (fd != TEST_FILE) { errno = EBADF; return -1; }
+  if ((request == SPI_IOC_WR_MODE32) || (request == SPI_IOC_WR_BITS_PER_WORD)) return 0;
+  if (request == SPI_IOC_WR_MAX_SPEED_HZ) return (SPIMemSim_InterfaceInit(&SimInterface, 0, STD_SPI_MODE0, *(uint32_t*)arg) == ERR_NONE ? 0 : (errno = EINVAL, -1));
+  if ((_IOC_TYPE(request) != SPI_IOC_MAGIC) || (_IOC_NR(request) != 0)) { errno = EINVAL; return -1; }
+  const struct spi_ioc_transfer* pTransfers = (const struct spi_ioc_transfer*)arg;
+  const size_t TransferCount = _IOC_SIZE(request) / sizeof(struct spi_ioc_transfer);
+  ++MessageCount;
+  uint32_t Total = 0;
+  for (size_t z = 0; z < TransferCount; ++z) Total += pTransfers[z].len;
+  if (Total > MaxMessageBytes) MaxMessageBytes = Total;
+  if (Total > FakeBufsiz) { errno = EMSGSIZE; return -1; }             // As spidev does
+  if (FakeErrno != 0) { errno = FakeErrno; return -1; }
+  for (size_t z = 0; z < TransferCount; ++z)
+  {
+    const bool Last = (z == (TransferCount - 1));
+    ChipSelectAsserted = (Last && (pTransfers[z].cs_change > 0));      // cs_change on the last transfer keeps the chip select asserted
+    SPIInterface_Packet Packet = { .Config.Value = (pTransfers[z].tx_buf != 0 ? 0 : SPI_USE_DUMMYBYTE_FOR_RECEIVE), .ChipSelect = 0, .DummyByte = 0x00,
+                                   .TxData = (uint8_t*)(uintptr_t)pTransfers[z].tx_buf, .RxData = (uint8_t*)(uintptr_t)pTransfers[z].rx_buf,
+                                   .DataSize = pTransfers[z].len, .Terminate = (Last && (ChipSelectAsserted == false)), };
+    if (SPIMemSim_InterfaceTransfer(&SimInterface, &Packet) != ERR_NONE) { errno = EIO; return -1; }
+  }
+  return (int)Total;
+}
+
+//-----------------------------------------------------------------------------
+
+static SPI_LinuxDev LinuxDev;
+static SRAM23LCxxx Sram;
+
+//=============================================================================
+// Open the fake spidev and initialize the 23LC1024
+//=============================================================================
+static eERRORRESULT Test_OpenSram(uint32_t maxMessageSize)
+{
+  static const SRAM23LCxxx_Config SramConfig = { .RecoverSPIbus = true, .IOmode = SRAM23LCxxx_SPI, .OperationMode = SRAM23LCxxx_SEQUENTIAL_MODE, .DisableHold = true, };
+  LinuxDev = (SPI_LinuxDev){ .fnOpen = Test_Open, .fnIoctl = Test_Ioctl, .fnClose = Test_Close, .MaxMessageSize = maxMessageSize, };
+  Sram     = (SRAM23LCxxx){ .Conf = &SRAM23LC1024_Conf, .SPIchipSelect = 0, .SPIclockSpeed = 20000000,
+                            .SPI = { .InterfaceDevice = &LinuxDev, .UniqueID = SPILINUXDEV_UNIQUE_ID, .fnSPI_Init = SPILinuxDev_InterfaceInit,
+                                     .fnSPI_Transfer = SPILinuxDev_InterfaceTransfer, .Channel = 0, }, };
+  FakeBufsiz = TEST_BUFSIZ;
+  FakeErrno  = 0;
+  return Init_SRAM23LCxxx(&Sram, &SramConfig);
+}
+
+
+//=============================================================================
+// Start the counting of the SPI_IOC_MESSAGE
+//=============================================================================
+static void Test_ResetStats(void)
+{
+  MessageCount       = 0;
+  MaxMessageBytes    = 0;
+  ChipSelectAsserted = false;
+  SPIMemSim_ResetStats(&Sim);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// A transfer bigger than bufsiz is split in several SPI_IOC_MESSAGE of 1 chip select
+//=============================================================================
+static bool Test_LargeTransfer(void)
+{
+  static uint8_t Data[20000], Read[20000];
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)(z * 7 + (z >> 8));
+  TEST_CHECK(Test_OpenSram(0) == ERR_NONE);
+  Test_ResetStats();
+  TEST_CHECK(SRAM23LCxxx_WriteSRAMData(&Sram, 0x01003, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(MessageCount == 5);                                       // 4 + 20000 bytes
+  TEST_CHECK(MaxMessageBytes == TEST_BUFSIZ);
+  TEST_CHECK(ChipSelectAsserted == false);                             // Released at the end of the transfer
+  TEST_CHECK(Sim.Stats.Transactions == 1);
+  TEST_CHECK(memcmp(&SramMemory[0x01003], &Data[0], sizeof(Data)) == 0);
+  Test_ResetStats();
+  memset(&Read[0], 0, sizeof(Read));
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0x01003, &Read[0], sizeof(Read)) == ERR_NONE);
+  TEST_CHECK((MessageCount == 5) && (MaxMessageBytes == TEST_BUFSIZ));
+  TEST_CHECK(Sim.Stats.Transactions == 1);
+  TEST_CHECK(memcmp(&Read[0], &Data[0], sizeof(Data)) == 0);
+  return true;
+}
+
+
+//=============================================================================
+// The size of a SPI_IOC_MESSAGE follows SPI_LinuxDev.MaxMessageSize
+//=============================================================================
+static bool Test_MaxMessageSize(void)
+{
+  uint8_t Data[300], Read[300];
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)(z ^ 0xA5);
+  TEST_CHECK(Test_OpenSram(64) == ERR_NONE);
+  FakeBufsiz = 64;
+  Test_ResetStats();
+  TEST_CHECK(SRAM23LCxxx_WriteSRAMData(&Sram, 0x10000, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(MessageCount == 5);                                       // 4 + 300 bytes
+  TEST_CHECK(MaxMessageBytes == 64);
+  memset(&Read[0], 0, sizeof(Read));
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0x10000, &Read[0], sizeof(Read)) == ERR_NONE);
+  TEST_CHECK(memcmp(&Read[0], &Data[0], sizeof(Data)) == 0);
+  FakeBufsiz = 32;                                                     // The spidev module has a smaller bufsiz than configured
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0x00000, &Read[0], sizeof(Read)) == ERR__SPI_OVERFLOW_ERROR);
+  return true;
+}
+
+
+//=============================================================================
+// The errno of spidev is converted to an error
+//=============================================================================
+static bool Test_ErrnoMapping(void)
+{
+  uint8_t Data[16];
+  TEST_CHECK(Test_OpenSram(0) == ERR_NONE);
+  FakeErrno = ETIMEDOUT;
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0, &Data[0], sizeof(Data)) == ERR__SPI_TIMEOUT);
+  FakeErrno = EBUSY;
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0, &Data[0], sizeof(Data)) == ERR__SPI_OTHER_BUSY);
+  FakeErrno = EINVAL;
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0, &Data[0], sizeof(Data)) == ERR__SPI_PARAMETER_ERROR);
+  FakeErrno = EIO;
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0, &Data[0], sizeof(Data)) == ERR__SPI_COMM_ERROR);
+  FakeErrno = 0;
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0, &Data[0], sizeof(Data)) == ERR_NONE);
+  TEST_CHECK(SPILinuxDev_Close(&LinuxDev) == ERR_NONE);
+  TEST_CHECK(SRAM23LCxxx_ReadSRAMData(&Sram, 0, &Data[0], sizeof(Data)) == ERR__SPI_CONFIG_ERROR); // Closed
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  bool Success = true;
+  Success &= Test_LargeTransfer();
+  Success &= Test_MaxMessageSize();
+  Success &= Test_ErrnoMapping();
+  printf("%s\n", (Success ? "All SPI_LinuxDev tests passed" : "SPI_LinuxDev tests FAILED"));
+  return (Success ? 0 : 1);
+}